@@ -0,0 +1,436 @@
+/*
+ * Carves Windows Shell Item lists from a file or device
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fwsitools_libcerror.h"
+#include "fwsitools_libfwsi.h"
+#include "fwsitools_mapped_file.h"
+
+/* The maximum number of worker threads, which matches the maximum of the library
+ */
+#define FWSICARVE_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fwsicarve to carve Windows Shell Item lists from a file or device.\n\n" );
+
+	fprintf( stream, "Usage: fwsicarve [ -c chunk_size ] [ -m minimum_confidence ]\n"
+	                 "                 [ -n minimum_number_of_items ] [ -t number_of_threads ]\n"
+	                 "                 [ -hV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file or device\n\n" );
+	fprintf( stream, "\t-c:     the chunk size in MiB, default is 64\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     the minimum confidence of a shell item list, a value\n"
+	                 "\t        between 0 and 100, default is 50\n" );
+	fprintf( stream, "\t-n:     the minimum number of shell items of a shell item list,\n"
+	                 "\t        default is 1\n" );
+	fprintf( stream, "\t-t:     the number of worker threads, default is the number of\n"
+	                 "\t        processors\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Copies a decimal string into an unsigned integer
+ * Returns 1 if successful or -1 on error
+ */
+int fwsicarve_string_copy_to_integer(
+     const char *string,
+     uint64_t maximum_value,
+     uint64_t *value )
+{
+	char *end_of_string       = NULL;
+	unsigned long long result = 0;
+
+	if( ( string == NULL )
+	 || ( value == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( *string < '0' )
+	 || ( *string > '9' ) )
+	{
+		return( -1 );
+	}
+	result = strtoull(
+	          string,
+	          &end_of_string,
+	          10 );
+
+	if( ( end_of_string == NULL )
+	 || ( *end_of_string != 0 )
+	 || ( (uint64_t) result > maximum_value ) )
+	{
+		return( -1 );
+	}
+	*value = (uint64_t) result;
+
+	return( 1 );
+}
+
+/* Prints a hit
+ * This function is the hit callback of the carver
+ * Returns 1 if successful or -1 on error
+ */
+int fwsicarve_print_hit(
+     void *user_data,
+     const libfwsi_carver_hit_t *hit )
+{
+	uint64_t *number_of_hits = NULL;
+
+	if( ( user_data == NULL )
+	 || ( hit == NULL ) )
+	{
+		return( -1 );
+	}
+	number_of_hits = (uint64_t *) user_data;
+
+	fprintf(
+	 stdout,
+	 "%" PRIzd "\t%" PRIzd "\t%d\t%" PRIu8 "\n",
+	 hit->offset,
+	 hit->size,
+	 hit->number_of_items,
+	 hit->confidence );
+
+	*number_of_hits += 1;
+
+	return( 1 );
+}
+
+/* The main program
+ */
+int main( int argc, char * const argv[] )
+{
+	fwsitools_mapped_file_t *mapped_file = NULL;
+	libcerror_error_t *error             = NULL;
+	libfwsi_carver_t *carver             = NULL;
+	libfwsi_error_t *libfwsi_error       = NULL;
+	char *option_chunk_size              = NULL;
+	char *option_minimum_confidence      = NULL;
+	char *option_minimum_number_of_items = NULL;
+	char *option_number_of_threads       = NULL;
+	char *source                         = NULL;
+	uint64_t number_of_hits              = 0;
+	uint64_t value_64bit                 = 0;
+	size_t chunk_size                    = 0;
+	int number_of_threads                = 1;
+	int option                           = 0;
+
+	while( ( option = getopt(
+	                   argc,
+	                   argv,
+	                   "c:hm:n:t:V" ) ) != -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %s\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'c':
+				option_chunk_size = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				option_minimum_confidence = optarg;
+
+				break;
+
+			case 'n':
+				option_minimum_number_of_items = optarg;
+
+				break;
+
+			case 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case 'V':
+				fprintf(
+				 stdout,
+				 "fwsicarve %s\n",
+				 LIBFWSI_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+#if defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_threads = (int) sysconf(
+	                           _SC_NPROCESSORS_ONLN );
+
+	if( number_of_threads < 1 )
+	{
+		number_of_threads = 1;
+	}
+	else if( number_of_threads > FWSICARVE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		number_of_threads = FWSICARVE_MAXIMUM_NUMBER_OF_THREADS;
+	}
+#endif
+	if( option_number_of_threads != NULL )
+	{
+		if( fwsicarve_string_copy_to_integer(
+		     option_number_of_threads,
+		     FWSICARVE_MAXIMUM_NUMBER_OF_THREADS,
+		     &value_64bit ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %s.\n",
+			 option_number_of_threads );
+
+			goto on_error;
+		}
+		number_of_threads = (int) value_64bit;
+	}
+	if( option_chunk_size != NULL )
+	{
+		if( ( fwsicarve_string_copy_to_integer(
+		       option_chunk_size,
+		       (uint64_t) SSIZE_MAX / ( 1024 * 1024 ),
+		       &value_64bit ) != 1 )
+		 || ( value_64bit == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported chunk size: %s.\n",
+			 option_chunk_size );
+
+			goto on_error;
+		}
+		chunk_size = (size_t) value_64bit * 1024 * 1024;
+	}
+	if( libfwsi_carver_initialize(
+	     &carver,
+	     &libfwsi_error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create carver.\n" );
+
+		goto on_error;
+	}
+	if( option_minimum_confidence != NULL )
+	{
+		if( fwsicarve_string_copy_to_integer(
+		     option_minimum_confidence,
+		     100,
+		     &value_64bit ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported minimum confidence: %s.\n",
+			 option_minimum_confidence );
+
+			goto on_error;
+		}
+		if( libfwsi_carver_set_minimum_confidence(
+		     carver,
+		     (uint8_t) value_64bit,
+		     &libfwsi_error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set minimum confidence.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_minimum_number_of_items != NULL )
+	{
+		if( ( fwsicarve_string_copy_to_integer(
+		       option_minimum_number_of_items,
+		       (uint64_t) INT_MAX,
+		       &value_64bit ) != 1 )
+		 || ( value_64bit == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported minimum number of items: %s.\n",
+			 option_minimum_number_of_items );
+
+			goto on_error;
+		}
+		if( libfwsi_carver_set_minimum_number_of_items(
+		     carver,
+		     (int) value_64bit,
+		     &libfwsi_error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set minimum number of items.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fwsitools_mapped_file_initialize(
+	     &mapped_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create mapped file.\n" );
+
+		goto on_error;
+	}
+	if( fwsitools_mapped_file_open(
+	     mapped_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %s.\n",
+		 source );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Offset\tSize\tNumber of items\tConfidence\n" );
+
+	if( mapped_file->data_size > 0 )
+	{
+		if( libfwsi_carver_scan_data(
+		     carver,
+		     mapped_file->data,
+		     mapped_file->data_size,
+		     chunk_size,
+		     number_of_threads,
+		     &fwsicarve_print_hit,
+		     (void *) &number_of_hits,
+		     &libfwsi_error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to carve: %s.\n",
+			 source );
+
+			goto on_error;
+		}
+	}
+	if( fwsitools_mapped_file_free(
+	     &mapped_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free mapped file.\n" );
+
+		goto on_error;
+	}
+	if( libfwsi_carver_free(
+	     &carver,
+	     &libfwsi_error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free carver.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stderr,
+	 "Carved %" PRIu64 " shell item lists.\n",
+	 number_of_hits );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( libfwsi_error != NULL )
+	{
+		libfwsi_error_backtrace_fprint(
+		 libfwsi_error,
+		 stderr );
+		libfwsi_error_free(
+		 &libfwsi_error );
+	}
+	if( mapped_file != NULL )
+	{
+		fwsitools_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
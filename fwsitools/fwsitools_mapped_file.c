@@ -0,0 +1,391 @@
+/*
+ * Memory-mapped file functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fwsitools_libcerror.h"
+#include "fwsitools_mapped_file.h"
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int fwsitools_mapped_file_initialize(
+     fwsitools_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fwsitools_mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                fwsitools_mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( fwsitools_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	( *mapped_file )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *mapped_file != NULL )
+	{
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int fwsitools_mapped_file_free(
+     fwsitools_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fwsitools_mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( ( *mapped_file )->file_descriptor != -1 )
+		{
+			if( fwsitools_mapped_file_close(
+			     *mapped_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens and maps a file or device read-only
+ * The whole file is mapped, which requires an address space larger than the file
+ * Returns 1 if successful or -1 on error
+ */
+int fwsitools_mapped_file_open(
+     fwsitools_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "fwsitools_mapped_file_open";
+
+#if defined( HAVE_MMAP ) && defined( HAVE_OPEN ) && defined( HAVE_LSEEK )
+	void *data            = NULL;
+	off_t file_size       = 0;
+#endif
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && defined( HAVE_OPEN ) && defined( HAVE_LSEEK )
+	mapped_file->file_descriptor = open(
+	                                filename,
+	                                O_RDONLY );
+
+	if( mapped_file->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The size of a device is not provided by fstat, hence seek to the end
+	 */
+	file_size = lseek(
+	             mapped_file->file_descriptor,
+	             0,
+	             SEEK_END );
+
+	if( file_size < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( (uint64_t) file_size > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	mapped_file->data_size = (size_t) file_size;
+
+	/* An empty file cannot be mapped
+	 */
+	if( mapped_file->data_size > 0 )
+	{
+		data = mmap(
+		        NULL,
+		        mapped_file->data_size,
+		        PROT_READ,
+		        MAP_PRIVATE,
+		        mapped_file->file_descriptor,
+		        0 );
+
+		if( data == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		mapped_file->data = (uint8_t *) data;
+
+#if defined( HAVE_MADVISE ) && defined( MADV_SEQUENTIAL )
+		/* Every chunk is read once front to back, the advice is only a hint
+		 * hence a failure is ignored
+		 */
+		madvise(
+		 data,
+		 mapped_file->data_size,
+		 MADV_SEQUENTIAL );
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( mapped_file->file_descriptor != -1 )
+	{
+		close(
+		 mapped_file->file_descriptor );
+
+		mapped_file->file_descriptor = -1;
+	}
+	mapped_file->data_size = 0;
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory-mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_OPEN ) && defined( HAVE_LSEEK ) */
+}
+
+/* Unmaps and closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int fwsitools_mapped_file_close(
+     fwsitools_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fwsitools_mapped_file_close";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && defined( HAVE_OPEN ) && defined( HAVE_LSEEK )
+	if( mapped_file->data != NULL )
+	{
+		if( munmap(
+		     mapped_file->data,
+		     mapped_file->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		mapped_file->data = NULL;
+	}
+	if( mapped_file->file_descriptor != -1 )
+	{
+		if( close(
+		     mapped_file->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		mapped_file->file_descriptor = -1;
+	}
+#endif
+	mapped_file->data_size = 0;
+
+	return( result );
+}
+
@@ -0,0 +1,73 @@
+/*
+ * Memory-mapped file functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWSITOOLS_MAPPED_FILE_H )
+#define _FWSITOOLS_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fwsitools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fwsitools_mapped_file fwsitools_mapped_file_t;
+
+struct fwsitools_mapped_file
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The size of the mapped data
+	 */
+	size_t data_size;
+};
+
+int fwsitools_mapped_file_initialize(
+     fwsitools_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int fwsitools_mapped_file_free(
+     fwsitools_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int fwsitools_mapped_file_open(
+     fwsitools_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int fwsitools_mapped_file_close(
+     fwsitools_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FWSITOOLS_MAPPED_FILE_H ) */
+
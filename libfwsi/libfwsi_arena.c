@@ -0,0 +1,300 @@
+/*
+ * Arena (region) allocator functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_arena.h"
+#include "libfwsi_libcerror.h"
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_initialize(
+     libfwsi_arena_t **arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libfwsi_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libfwsi_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * This frees all the allocations made from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_free(
+     libfwsi_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	libfwsi_arena_block_t *next_block  = NULL;
+	static char *function              = "libfwsi_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		arena_block = ( *arena )->first_block;
+
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * This invalidates all the allocations made from the arena but retains its blocks for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_reset(
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	static char *function              = "libfwsi_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	for( arena_block = arena->first_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		arena_block->used_data_size = 0;
+	}
+	arena->current_block = arena->first_block;
+
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * The memory is not cleared and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_allocate(
+     libfwsi_arena_t *arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	static char *function              = "libfwsi_arena_allocate";
+	size_t aligned_size                = 0;
+	size_t block_data_size             = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( libfwsi_arena_block_t ) - LIBFWSI_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + ( LIBFWSI_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWSI_ARENA_ALIGNMENT - 1 );
+
+	/* Blocks retained after a reset are reused before new blocks are created
+	 */
+	for( arena_block = arena->current_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		if( aligned_size <= ( arena_block->data_size - arena_block->used_data_size ) )
+		{
+			break;
+		}
+	}
+	if( arena_block == NULL )
+	{
+		if( arena->last_block == NULL )
+		{
+			block_data_size = LIBFWSI_ARENA_MINIMUM_BLOCK_SIZE;
+		}
+		else if( arena->last_block->data_size < ( LIBFWSI_ARENA_MAXIMUM_BLOCK_SIZE / 2 ) )
+		{
+			block_data_size = arena->last_block->data_size * 2;
+		}
+		else
+		{
+			block_data_size = LIBFWSI_ARENA_MAXIMUM_BLOCK_SIZE;
+		}
+		if( block_data_size < aligned_size )
+		{
+			block_data_size = aligned_size;
+		}
+		/* The block data is stored directly after the block
+		 */
+		arena_block = (libfwsi_arena_block_t *) memory_allocate(
+		                                         sizeof( libfwsi_arena_block_t ) + block_data_size );
+
+		if( arena_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arena block.",
+			 function );
+
+			return( -1 );
+		}
+		arena_block->next_block     = NULL;
+		arena_block->data           = &( ( (uint8_t *) arena_block )[ sizeof( libfwsi_arena_block_t ) ] );
+		arena_block->data_size      = block_data_size;
+		arena_block->used_data_size = 0;
+
+		if( arena->last_block == NULL )
+		{
+			arena->first_block = arena_block;
+		}
+		else
+		{
+			arena->last_block->next_block = arena_block;
+		}
+		arena->last_block = arena_block;
+
+		arena->number_of_blocks += 1;
+	}
+	arena->current_block = arena_block;
+
+	*data = &( arena_block->data[ arena_block->used_data_size ] );
+
+	arena_block->used_data_size += aligned_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Arena (region) allocator functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ARENA_H )
+#define _LIBFWSI_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the arena allocations
+ */
+#define LIBFWSI_ARENA_ALIGNMENT			16
+
+/* The minimum and maximum size of an arena block
+ */
+#define LIBFWSI_ARENA_MINIMUM_BLOCK_SIZE	2048
+#define LIBFWSI_ARENA_MAXIMUM_BLOCK_SIZE	65536
+
+typedef struct libfwsi_arena_block libfwsi_arena_block_t;
+
+struct libfwsi_arena_block
+{
+	/* The next block
+	 */
+	libfwsi_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libfwsi_arena libfwsi_arena_t;
+
+struct libfwsi_arena
+{
+	/* The first block
+	 */
+	libfwsi_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	libfwsi_arena_block_t *current_block;
+
+	/* The last block
+	 */
+	libfwsi_arena_block_t *last_block;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+};
+
+int libfwsi_arena_initialize(
+     libfwsi_arena_t **arena,
+     libcerror_error_t **error );
+
+int libfwsi_arena_free(
+     libfwsi_arena_t **arena,
+     libcerror_error_t **error );
+
+int libfwsi_arena_reset(
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwsi_arena_allocate(
+     libfwsi_arena_t *arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ARENA_H ) */
+
@@ -0,0 +1,451 @@
+/*
+ * Shell item list batch parser functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_batch_parser.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_types.h"
+
+/* Parses a batch of shell item lists
+ * An item list is created for every input and stored in item_lists at the index of the input
+ * The result of every input is stored in results at the index of the input,
+ * 1 if the input was parsed or -1 if not, in which case the item list is NULL
+ * parse_flags is a combination of LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM and LIBFWSI_PARSE_FLAG_DEFER_DECODING
+ * if LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM is set the byte streams of the inputs must remain
+ * available as long as the corresponding item lists are used
+ * The inputs are distributed over number_of_threads worker threads, if multi-threading
+ * is not supported or number_of_threads is 0 or 1 the inputs are parsed by the calling thread
+ * Returns 1 if all inputs were parsed, 0 if one or more inputs could not be parsed or -1 on error
+ */
+int libfwsi_item_list_batch_parse(
+     const libfwsi_batch_input_t *inputs,
+     int number_of_inputs,
+     uint8_t parse_flags,
+     int number_of_threads,
+     libfwsi_item_list_t **item_lists,
+     int *results,
+     libcerror_error_t **error )
+{
+	libfwsi_batch_parser_t batch_parser;
+	libfwsi_batch_parser_task_t batch_parser_task;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool     = NULL;
+	libfwsi_batch_parser_task_t *tasks         = NULL;
+	int number_of_tasks                        = 0;
+	int task_index                             = 0;
+#endif
+
+	static char *function                      = "libfwsi_item_list_batch_parse";
+	int input_index                            = 0;
+	int number_of_failed_inputs                = 0;
+
+	if( inputs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inputs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inputs < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of inputs value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parse_flags & ~( LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported parse flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFWSI_BATCH_PARSER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_lists == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item lists.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	for( input_index = 0;
+	     input_index < number_of_inputs;
+	     input_index++ )
+	{
+		item_lists[ input_index ] = NULL;
+		results[ input_index ]    = 0;
+	}
+	batch_parser.inputs           = inputs;
+	batch_parser.number_of_inputs = number_of_inputs;
+	batch_parser.parse_flags      = parse_flags;
+	batch_parser.item_lists       = item_lists;
+	batch_parser.results          = results;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_inputs > LIBFWSI_BATCH_PARSER_TASK_SIZE ) )
+	{
+		number_of_tasks = number_of_inputs / LIBFWSI_BATCH_PARSER_TASK_SIZE;
+
+		if( ( number_of_inputs % LIBFWSI_BATCH_PARSER_TASK_SIZE ) != 0 )
+		{
+			number_of_tasks += 1;
+		}
+		if( number_of_threads > number_of_tasks )
+		{
+			number_of_threads = number_of_tasks;
+		}
+		tasks = (libfwsi_batch_parser_task_t *) memory_allocate(
+		                                         sizeof( libfwsi_batch_parser_task_t ) * number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_threads * LIBFWSI_BATCH_PARSER_QUEUE_SIZE_PER_THREAD,
+		     (int (*)(intptr_t *, void *)) &libfwsi_batch_parser_process_task,
+		     (void *) &batch_parser,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		/* The thread pool queue is bounded, hence pushing blocks
+		 * until a worker thread has taken a previous task
+		 */
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			tasks[ task_index ].first_input_index = task_index * LIBFWSI_BATCH_PARSER_TASK_SIZE;
+			tasks[ task_index ].number_of_inputs  = number_of_inputs - tasks[ task_index ].first_input_index;
+
+			if( tasks[ task_index ].number_of_inputs > LIBFWSI_BATCH_PARSER_TASK_SIZE )
+			{
+				tasks[ task_index ].number_of_inputs = LIBFWSI_BATCH_PARSER_TASK_SIZE;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+	}
+	else
+#endif /* defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT ) */
+	{
+		batch_parser_task.first_input_index = 0;
+		batch_parser_task.number_of_inputs  = number_of_inputs;
+
+		if( libfwsi_batch_parser_process_task(
+		     &batch_parser_task,
+		     &batch_parser ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process task.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( input_index = 0;
+	     input_index < number_of_inputs;
+	     input_index++ )
+	{
+		if( results[ input_index ] != 1 )
+		{
+			number_of_failed_inputs++;
+		}
+	}
+	if( number_of_failed_inputs != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		/* The worker threads can still reference the tasks
+		 */
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+#endif
+	for( input_index = 0;
+	     input_index < number_of_inputs;
+	     input_index++ )
+	{
+		if( item_lists[ input_index ] != NULL )
+		{
+			libfwsi_item_list_free(
+			 &( item_lists[ input_index ] ),
+			 NULL );
+		}
+		results[ input_index ] = 0;
+	}
+	return( -1 );
+}
+
+/* Parses a single input of a batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_parser_parse_input(
+     libfwsi_batch_parser_t *batch_parser,
+     int input_index,
+     libcerror_error_t **error )
+{
+	const libfwsi_batch_input_t *input = NULL;
+	libfwsi_item_list_t *item_list     = NULL;
+	static char *function              = "libfwsi_batch_parser_parse_input";
+
+	if( batch_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_index < 0 )
+	 || ( input_index >= batch_parser->number_of_inputs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	input = &( batch_parser->inputs[ input_index ] );
+
+	if( libfwsi_item_list_initialize(
+	     &item_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwsi_item_list_parse(
+	     item_list,
+	     input->byte_stream,
+	     input->byte_stream_size,
+	     input->ascii_codepage,
+	     batch_parser->parse_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to parse item list: %d.",
+		 function,
+		 input_index );
+
+		goto on_error;
+	}
+	batch_parser->item_lists[ input_index ] = item_list;
+
+	return( 1 );
+
+on_error:
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Processes a batch parser task
+ * This function is the callback of the batch parser worker threads
+ * Every input is written by a single task hence no locking is required
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_parser_process_task(
+     libfwsi_batch_parser_task_t *task,
+     libfwsi_batch_parser_t *batch_parser )
+{
+	libcerror_error_t *error = NULL;
+	int input_index          = 0;
+	int last_input_index     = 0;
+	int result               = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function    = "libfwsi_batch_parser_process_task";
+#endif
+
+	if( ( task == NULL )
+	 || ( batch_parser == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( task->first_input_index < 0 )
+	 || ( task->number_of_inputs < 0 )
+	 || ( task->number_of_inputs > ( batch_parser->number_of_inputs - task->first_input_index ) ) )
+	{
+		return( -1 );
+	}
+	last_input_index = task->first_input_index + task->number_of_inputs;
+
+	for( input_index = task->first_input_index;
+	     input_index < last_input_index;
+	     input_index++ )
+	{
+		result = libfwsi_batch_parser_parse_input(
+		          batch_parser,
+		          input_index,
+		          &error );
+
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to parse input: %d.\n",
+				 function,
+				 input_index );
+
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		batch_parser->results[ input_index ] = result;
+	}
+	return( 1 );
+}
+
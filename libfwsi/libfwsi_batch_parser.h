@@ -0,0 +1,112 @@
+/*
+ * Shell item list batch parser functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_BATCH_PARSER_H )
+#define _LIBFWSI_BATCH_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of worker threads of a batch
+ */
+#define LIBFWSI_BATCH_PARSER_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The number of inputs parsed by a worker thread per task
+ * Handing out inputs in small ranges keeps the queue overhead low
+ * while still balancing uneven inputs over the worker threads
+ */
+#define LIBFWSI_BATCH_PARSER_TASK_SIZE			64
+
+/* The maximum number of tasks queued per worker thread
+ */
+#define LIBFWSI_BATCH_PARSER_QUEUE_SIZE_PER_THREAD	4
+
+typedef struct libfwsi_batch_parser libfwsi_batch_parser_t;
+
+struct libfwsi_batch_parser
+{
+	/* The inputs
+	 */
+	const libfwsi_batch_input_t *inputs;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+
+	/* The parse flags
+	 */
+	uint8_t parse_flags;
+
+	/* The item lists, one per input
+	 */
+	libfwsi_item_list_t **item_lists;
+
+	/* The results, one per input
+	 */
+	int *results;
+};
+
+typedef struct libfwsi_batch_parser_task libfwsi_batch_parser_task_t;
+
+struct libfwsi_batch_parser_task
+{
+	/* The index of the first input
+	 */
+	int first_input_index;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_batch_parse(
+     const libfwsi_batch_input_t *inputs,
+     int number_of_inputs,
+     uint8_t parse_flags,
+     int number_of_threads,
+     libfwsi_item_list_t **item_lists,
+     int *results,
+     libcerror_error_t **error );
+
+int libfwsi_batch_parser_parse_input(
+     libfwsi_batch_parser_t *batch_parser,
+     int input_index,
+     libcerror_error_t **error );
+
+int libfwsi_batch_parser_process_task(
+     libfwsi_batch_parser_task_t *task,
+     libfwsi_batch_parser_t *batch_parser );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_BATCH_PARSER_H ) */
+
@@ -0,0 +1,1002 @@
+/*
+ * Shell item list carver functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_carver.h"
+#include "libfwsi_classifier.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_scanner.h"
+#include "libfwsi_string_scan.h"
+#include "libfwsi_types.h"
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+/* Determines if a 64-bit value contains a byte with a value of 0
+ */
+#define libfwsi_carver_has_zero_byte( value_64bit ) \
+	( ( ( value_64bit ) - 0x0101010101010101ULL ) & ~( value_64bit ) & 0x8080808080808080ULL )
+
+/* Creates a carver
+ * Make sure the value carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_initialize(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_initialize";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = memory_allocate_structure(
+	                   libfwsi_internal_carver_t );
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver,
+	     0,
+	     sizeof( libfwsi_internal_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carver.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->minimum_confidence      = LIBFWSI_CARVER_DEFAULT_MINIMUM_CONFIDENCE;
+	internal_carver->minimum_number_of_items = 1;
+
+	*carver = (libfwsi_carver_t *) internal_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_carver != NULL )
+	{
+		memory_free(
+		 internal_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a carver
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_free(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_free";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		internal_carver = (libfwsi_internal_carver_t *) *carver;
+		*carver         = NULL;
+
+		memory_free(
+		 internal_carver );
+	}
+	return( 1 );
+}
+
+/* Retrieves the minimum confidence
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_get_minimum_confidence(
+     libfwsi_carver_t *carver,
+     uint8_t *minimum_confidence,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_get_minimum_confidence";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( minimum_confidence == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum confidence.",
+		 function );
+
+		return( -1 );
+	}
+	*minimum_confidence = internal_carver->minimum_confidence;
+
+	return( 1 );
+}
+
+/* Sets the minimum confidence
+ * The confidence is a value between 0 and 100, hits with a lower confidence are not reported
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_set_minimum_confidence(
+     libfwsi_carver_t *carver,
+     uint8_t minimum_confidence,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_set_minimum_confidence";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( minimum_confidence > 100 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum confidence value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->minimum_confidence = minimum_confidence;
+
+	return( 1 );
+}
+
+/* Retrieves the minimum number of shell items
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_get_minimum_number_of_items(
+     libfwsi_carver_t *carver,
+     int *minimum_number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_get_minimum_number_of_items";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( minimum_number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum number of items.",
+		 function );
+
+		return( -1 );
+	}
+	*minimum_number_of_items = internal_carver->minimum_number_of_items;
+
+	return( 1 );
+}
+
+/* Sets the minimum number of shell items
+ * Shell item lists with fewer shell items are not reported
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_set_minimum_number_of_items(
+     libfwsi_carver_t *carver,
+     int minimum_number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_set_minimum_number_of_items";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( minimum_number_of_items < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->minimum_number_of_items = minimum_number_of_items;
+
+	return( 1 );
+}
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+
+/* Retrieves the index of the least significant bit that is set
+ * The mask cannot be 0
+ * Returns the index of the bit
+ */
+static size_t libfwsi_carver_get_first_bit_index(
+               uint32_t mask )
+{
+#if defined( __GNUC__ )
+	return( (size_t) __builtin_ctz( mask ) );
+
+#elif defined( _MSC_VER )
+	unsigned long bit_index = 0;
+
+	_BitScanForward(
+	 &bit_index,
+	 (unsigned long) mask );
+
+	return( (size_t) bit_index );
+#else
+	size_t bit_index = 0;
+
+	while( ( mask & 1 ) == 0 )
+	{
+		mask >>= 1;
+
+		bit_index++;
+	}
+	return( bit_index );
+#endif
+}
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) */
+
+/* Determines if the data at a specific offset is a candidate
+ * A candidate is either a root folder shell item: 0x14 0x00 0x1f,
+ * which is the most common start of a shell item list, or the signature
+ * of a file entry extension block: 0x04 0x00 0xef 0xbe
+ * Returns 1 if the data is a candidate or 0 if not
+ */
+#define libfwsi_carver_is_candidate( data, data_size, data_offset ) \
+	( ( ( ( data_offset ) + 3 ) <= ( data_size ) ) \
+	 && ( ( data )[ ( data_offset ) + 1 ] == 0x00 ) \
+	 && ( ( ( ( data )[ ( data_offset ) ] == 0x14 ) \
+	    &&  ( ( data )[ ( data_offset ) + 2 ] == 0x1f ) ) \
+	  || ( ( ( data_offset ) + 4 <= ( data_size ) ) \
+	    &&  ( ( data )[ ( data_offset ) ] == 0x04 ) \
+	    &&  ( ( data )[ ( data_offset ) + 2 ] == 0xef ) \
+	    &&  ( ( data )[ ( data_offset ) + 3 ] == 0xbe ) ) ) )
+
+/* Finds the next candidate using 64-bit words
+ * Returns the offset of the candidate or data_size if not found
+ */
+static size_t libfwsi_carver_find_candidate_portable(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	uint64_t value_64bit = 0;
+
+	/* Both candidates contain a byte of 0x1f or 0xef at offset 2, hence 8 offsets
+	 * can be skipped if the 8 bytes at offset 2 contain neither
+	 */
+	while( ( data_offset + 10 ) <= data_size )
+	{
+		/* The byte tests are independent of the byte order
+		 */
+		memory_copy(
+		 &value_64bit,
+		 &( data[ data_offset + 2 ] ),
+		 8 );
+
+		if( ( libfwsi_carver_has_zero_byte( value_64bit ^ 0x1f1f1f1f1f1f1f1fULL ) != 0 )
+		 || ( libfwsi_carver_has_zero_byte( value_64bit ^ 0xefefefefefefefefULL ) != 0 ) )
+		{
+			break;
+		}
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
+	{
+		if( libfwsi_carver_is_candidate( data, data_size, data_offset ) )
+		{
+			return( data_offset );
+		}
+		data_offset++;
+	}
+	return( data_size );
+}
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+
+/* Finds the next candidate using SSE2
+ * Returns the offset of the candidate or data_size if not found
+ */
+static size_t libfwsi_carver_find_candidate_sse2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	__m128i root_folder_size_vector  = _mm_set1_epi8( (char) 0x14 );
+	__m128i root_folder_class_vector = _mm_set1_epi8( (char) 0x1f );
+	__m128i signature_byte0_vector   = _mm_set1_epi8( (char) 0x04 );
+	__m128i signature_byte2_vector   = _mm_set1_epi8( (char) 0xef );
+	__m128i signature_byte3_vector   = _mm_set1_epi8( (char) 0xbe );
+	__m128i zero_vector              = _mm_setzero_si128();
+	__m128i data_vector0;
+	__m128i data_vector1;
+	__m128i data_vector2;
+	__m128i data_vector3;
+	__m128i root_folder_vector;
+	__m128i signature_vector;
+	uint32_t mask                    = 0;
+
+	/* The 4 overlapping loads test 16 offsets at a time
+	 */
+	while( ( data_offset + 19 ) <= data_size )
+	{
+		data_vector0 = _mm_loadu_si128(
+		                (const __m128i *) &( data[ data_offset ] ) );
+		data_vector1 = _mm_loadu_si128(
+		                (const __m128i *) &( data[ data_offset + 1 ] ) );
+		data_vector2 = _mm_loadu_si128(
+		                (const __m128i *) &( data[ data_offset + 2 ] ) );
+		data_vector3 = _mm_loadu_si128(
+		                (const __m128i *) &( data[ data_offset + 3 ] ) );
+
+		root_folder_vector = _mm_and_si128(
+		                      _mm_cmpeq_epi8(
+		                       data_vector0,
+		                       root_folder_size_vector ),
+		                      _mm_cmpeq_epi8(
+		                       data_vector2,
+		                       root_folder_class_vector ) );
+
+		signature_vector = _mm_and_si128(
+		                    _mm_and_si128(
+		                     _mm_cmpeq_epi8(
+		                      data_vector0,
+		                      signature_byte0_vector ),
+		                     _mm_cmpeq_epi8(
+		                      data_vector2,
+		                      signature_byte2_vector ) ),
+		                    _mm_cmpeq_epi8(
+		                     data_vector3,
+		                     signature_byte3_vector ) );
+
+		mask = (uint32_t) _mm_movemask_epi8(
+		                   _mm_and_si128(
+		                    _mm_cmpeq_epi8(
+		                     data_vector1,
+		                     zero_vector ),
+		                    _mm_or_si128(
+		                     root_folder_vector,
+		                     signature_vector ) ) );
+
+		if( mask != 0 )
+		{
+			return( data_offset + libfwsi_carver_get_first_bit_index( mask ) );
+		}
+		data_offset += 16;
+	}
+	return( libfwsi_carver_find_candidate_portable(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) */
+
+/* Finds the next candidate
+ * Returns the offset of the candidate or data_size if not found
+ */
+size_t libfwsi_carver_find_candidate(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset )
+{
+	if( ( data == NULL )
+	 || ( data_offset >= data_size ) )
+	{
+		return( data_size );
+	}
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+	return( libfwsi_carver_find_candidate_sse2(
+	         data,
+	         data_size,
+	         data_offset ) );
+#else
+	return( libfwsi_carver_find_candidate_portable(
+	         data,
+	         data_size,
+	         data_offset ) );
+#endif
+}
+
+/* Retrieves the offset of the shell item that contains a file entry extension block
+ * The signature offset is the offset of the extension block signature, where
+ * the extension block starts 4 bytes before the signature. The last 2 bytes of
+ * the extension block contain the offset of the first extension block relative
+ * to the start of the shell item
+ * Returns the offset of the shell item or data_size if not available
+ */
+size_t libfwsi_carver_get_item_offset_from_extension_block(
+        const uint8_t *data,
+        size_t data_size,
+        size_t signature_offset )
+{
+	size_t extension_block_offset         = 0;
+	size_t item_offset                    = 0;
+	uint16_t extension_block_size         = 0;
+	uint16_t first_extension_block_offset = 0;
+	uint16_t item_size                    = 0;
+
+	if( ( data == NULL )
+	 || ( signature_offset < 4 )
+	 || ( signature_offset >= data_size ) )
+	{
+		return( data_size );
+	}
+	extension_block_offset = signature_offset - 4;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ extension_block_offset ] ),
+	 extension_block_size );
+
+	if( ( extension_block_size < 16 )
+	 || ( (size_t) extension_block_size > ( data_size - extension_block_offset ) ) )
+	{
+		return( data_size );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ extension_block_offset + extension_block_size - 2 ] ),
+	 first_extension_block_offset );
+
+	if( ( first_extension_block_offset < 4 )
+	 || ( (size_t) first_extension_block_offset > extension_block_offset ) )
+	{
+		return( data_size );
+	}
+	item_offset = extension_block_offset - first_extension_block_offset;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ item_offset ] ),
+	 item_size );
+
+	/* The shell item must contain the extension block
+	 */
+	if( ( (size_t) item_size < ( first_extension_block_offset + (size_t) extension_block_size ) )
+	 || ( (size_t) item_size > ( data_size - item_offset ) ) )
+	{
+		return( data_size );
+	}
+	return( item_offset );
+}
+
+/* Retrieves the offset of the shell item list that contains a shell item
+ * The preceding shell items are located by searching for a shell item size
+ * that corresponds to the distance to the next shell item and a known class type
+ * Returns the offset of the first shell item that was located
+ */
+size_t libfwsi_carver_get_list_offset(
+        const uint8_t *data,
+        size_t item_offset,
+        size_t minimum_offset )
+{
+	size_t distance         = 0;
+	size_t preceding_offset = 0;
+	uint16_t item_size      = 0;
+	int number_of_items     = 0;
+
+	if( data == NULL )
+	{
+		return( item_offset );
+	}
+	while( number_of_items < LIBFWSI_CARVER_MAXIMUM_BACKTRACK_ITEMS )
+	{
+		for( distance = 4;
+		     distance <= LIBFWSI_CARVER_MAXIMUM_BACKTRACK_DISTANCE;
+		     distance++ )
+		{
+			if( ( distance > item_offset )
+			 || ( ( item_offset - distance ) < minimum_offset ) )
+			{
+				break;
+			}
+			preceding_offset = item_offset - distance;
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ preceding_offset ] ),
+			 item_size );
+
+			if( ( (size_t) item_size == distance )
+			 && ( libfwsi_classifier_class_type_table[ data[ preceding_offset + 2 ] ] != 0 ) )
+			{
+				break;
+			}
+		}
+		if( ( distance > LIBFWSI_CARVER_MAXIMUM_BACKTRACK_DISTANCE )
+		 || ( distance > item_offset )
+		 || ( ( item_offset - distance ) < minimum_offset ) )
+		{
+			break;
+		}
+		item_offset = preceding_offset;
+
+		number_of_items++;
+	}
+	return( item_offset );
+}
+
+/* Calculates the confidence of a shell item list
+ * The confidence is a value between 0 and 100 that increases with the number
+ * of shell items, a root folder shell item at the start, the presence of
+ * extension blocks and the absence of unknown shell items
+ * Returns the confidence
+ */
+uint8_t libfwsi_carver_calculate_confidence(
+         const libfwsi_item_scan_entry_t *entries,
+         int number_of_entries,
+         int number_of_items )
+{
+	int confidence           = 30;
+	int entry_index          = 0;
+	int has_extension_blocks = 0;
+	int has_unknown_items    = 0;
+
+	if( ( entries == NULL )
+	 || ( number_of_entries <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( number_of_items >= 3 )
+	{
+		confidence += 30;
+	}
+	else
+	{
+		confidence += 10 * number_of_items;
+	}
+	if( entries[ 0 ].class_type == LIBFWSI_CLASS_TYPE_ROOT_FOLDER )
+	{
+		confidence += 20;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entries[ entry_index ].number_of_extension_blocks > 0 )
+		{
+			has_extension_blocks = 1;
+		}
+		if( entries[ entry_index ].item_type == LIBFWSI_ITEM_TYPE_UNKNOWN )
+		{
+			has_unknown_items = 1;
+		}
+	}
+	if( has_extension_blocks != 0 )
+	{
+		confidence += 10;
+	}
+	if( has_unknown_items == 0 )
+	{
+		confidence += 10;
+	}
+	if( confidence > 100 )
+	{
+		confidence = 100;
+	}
+	return( (uint8_t) confidence );
+}
+
+/* Scans a buffer for shell item lists
+ * Candidates are located with a prefilter and validated with the allocation-free
+ * structural scan of libfwsi_item_list_scan, no item objects are created
+ * Only the first search_size bytes of the buffer are searched for candidates,
+ * the shell item lists are scanned until they terminate, up to buffer_size
+ * buffer_offset contains the offset to start scanning and is set to the offset
+ * to continue scanning from, which is search_size if the whole search range was
+ * scanned or the end of the last hit if hits is full
+ * The hits do not overlap and the hit offsets are relative to the start of the buffer
+ * The carver is not modified by the scan, hence multiple threads can scan
+ * different buffers with the same carver
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_carver_scan_buffer(
+     libfwsi_internal_carver_t *internal_carver,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t search_size,
+     size_t *buffer_offset,
+     libfwsi_carver_hit_t *hits,
+     int maximum_number_of_hits,
+     int *number_of_hits,
+     libcerror_error_t **error )
+{
+	libfwsi_item_scan_entry_t entries[ LIBFWSI_CARVER_NUMBER_OF_SCAN_ENTRIES ];
+
+	static char *function   = "libfwsi_internal_carver_scan_buffer";
+	size_t candidate_offset = 0;
+	size_t item_offset      = 0;
+	size_t list_offset      = 0;
+	size_t list_size        = 0;
+	size_t minimum_offset   = 0;
+	size_t scan_offset      = 0;
+	size_t search_end       = 0;
+	uint8_t confidence      = 0;
+	int hit_index           = 0;
+	int number_of_entries   = 0;
+	int number_of_items     = 0;
+	int result              = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( search_size > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid search size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_offset > search_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_hits <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of hits value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	minimum_offset = *buffer_offset;
+	scan_offset    = *buffer_offset;
+
+	/* A candidate is at most 4 bytes of size, so that candidates that start
+	 * in the search range are found
+	 */
+	search_end = buffer_size;
+
+	if( search_end > ( search_size + 3 ) )
+	{
+		search_end = search_size + 3;
+	}
+	while( scan_offset < search_size )
+	{
+		candidate_offset = libfwsi_carver_find_candidate(
+		                    buffer,
+		                    search_end,
+		                    scan_offset );
+
+		if( candidate_offset >= search_size )
+		{
+			break;
+		}
+		scan_offset = candidate_offset + 1;
+
+		if( buffer[ candidate_offset ] == 0x04 )
+		{
+			item_offset = libfwsi_carver_get_item_offset_from_extension_block(
+			               buffer,
+			               buffer_size,
+			               candidate_offset );
+
+			if( ( item_offset >= buffer_size )
+			 || ( item_offset < minimum_offset ) )
+			{
+				continue;
+			}
+			list_offset = libfwsi_carver_get_list_offset(
+			               buffer,
+			               item_offset,
+			               minimum_offset );
+		}
+		else
+		{
+			item_offset = candidate_offset;
+			list_offset = candidate_offset;
+		}
+		/* Invalid data is not reported as an error, which would require an allocation
+		 */
+		result = libfwsi_item_list_scan(
+		          &( buffer[ list_offset ] ),
+		          buffer_size - list_offset,
+		          entries,
+		          LIBFWSI_CARVER_NUMBER_OF_SCAN_ENTRIES,
+		          &number_of_items,
+		          &list_size,
+		          NULL );
+
+		if( ( result != 1 )
+		 && ( list_offset != item_offset ) )
+		{
+			list_offset = item_offset;
+
+			result = libfwsi_item_list_scan(
+			          &( buffer[ list_offset ] ),
+			          buffer_size - list_offset,
+			          entries,
+			          LIBFWSI_CARVER_NUMBER_OF_SCAN_ENTRIES,
+			          &number_of_items,
+			          &list_size,
+			          NULL );
+		}
+		if( ( result != 1 )
+		 || ( number_of_items < internal_carver->minimum_number_of_items ) )
+		{
+			continue;
+		}
+		number_of_entries = number_of_items;
+
+		if( number_of_entries > LIBFWSI_CARVER_NUMBER_OF_SCAN_ENTRIES )
+		{
+			number_of_entries = LIBFWSI_CARVER_NUMBER_OF_SCAN_ENTRIES;
+		}
+		confidence = libfwsi_carver_calculate_confidence(
+		              entries,
+		              number_of_entries,
+		              number_of_items );
+
+		if( confidence < internal_carver->minimum_confidence )
+		{
+			continue;
+		}
+		hits[ hit_index ].offset          = list_offset;
+		hits[ hit_index ].size            = list_size;
+		hits[ hit_index ].number_of_items = number_of_items;
+		hits[ hit_index ].confidence      = confidence;
+
+		hit_index++;
+
+		/* Candidates within a hit are not considered
+		 */
+		minimum_offset = list_offset + list_size;
+		scan_offset    = minimum_offset;
+
+		if( hit_index >= maximum_number_of_hits )
+		{
+			break;
+		}
+	}
+	if( hit_index < maximum_number_of_hits )
+	{
+		scan_offset = search_size;
+	}
+	*buffer_offset  = scan_offset;
+	*number_of_hits = hit_index;
+
+	return( 1 );
+}
+
+/* Scans a buffer for shell item lists
+ * buffer_offset contains the offset to start scanning and is set to the offset
+ * to continue scanning from, which is buffer_size if the whole buffer was scanned
+ * or the end of the last hit if hits is full
+ * The hits do not overlap and the hit offsets are relative to the start of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_scan_buffer(
+     libfwsi_carver_t *carver,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     libfwsi_carver_hit_t *hits,
+     int maximum_number_of_hits,
+     int *number_of_hits,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_carver_scan_buffer";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_carver_scan_buffer(
+	     (libfwsi_internal_carver_t *) carver,
+	     buffer,
+	     buffer_size,
+	     buffer_size,
+	     buffer_offset,
+	     hits,
+	     maximum_number_of_hits,
+	     number_of_hits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
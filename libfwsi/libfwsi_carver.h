@@ -0,0 +1,148 @@
+/*
+ * Shell item list carver functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_CARVER_H )
+#define _LIBFWSI_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default minimum confidence of a carved shell item list
+ */
+#define LIBFWSI_CARVER_DEFAULT_MINIMUM_CONFIDENCE	50
+
+/* The maximum distance between the start of a shell item and the start of
+ * the preceding shell item that is considered when locating the start of
+ * a shell item list from a file entry extension block
+ */
+#define LIBFWSI_CARVER_MAXIMUM_BACKTRACK_DISTANCE	1024
+
+/* The maximum number of preceding shell items that are located
+ */
+#define LIBFWSI_CARVER_MAXIMUM_BACKTRACK_ITEMS		32
+
+/* The number of scan entries used to determine the confidence
+ */
+#define LIBFWSI_CARVER_NUMBER_OF_SCAN_ENTRIES		16
+
+typedef struct libfwsi_internal_carver libfwsi_internal_carver_t;
+
+struct libfwsi_internal_carver
+{
+	/* The minimum confidence of a hit
+	 */
+	uint8_t minimum_confidence;
+
+	/* The minimum number of shell items of a hit
+	 */
+	int minimum_number_of_items;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_initialize(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_free(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_get_minimum_confidence(
+     libfwsi_carver_t *carver,
+     uint8_t *minimum_confidence,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_set_minimum_confidence(
+     libfwsi_carver_t *carver,
+     uint8_t minimum_confidence,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_get_minimum_number_of_items(
+     libfwsi_carver_t *carver,
+     int *minimum_number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_set_minimum_number_of_items(
+     libfwsi_carver_t *carver,
+     int minimum_number_of_items,
+     libcerror_error_t **error );
+
+size_t libfwsi_carver_find_candidate(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset );
+
+size_t libfwsi_carver_get_item_offset_from_extension_block(
+        const uint8_t *data,
+        size_t data_size,
+        size_t signature_offset );
+
+size_t libfwsi_carver_get_list_offset(
+        const uint8_t *data,
+        size_t item_offset,
+        size_t minimum_offset );
+
+uint8_t libfwsi_carver_calculate_confidence(
+         const libfwsi_item_scan_entry_t *entries,
+         int number_of_entries,
+         int number_of_items );
+
+int libfwsi_internal_carver_scan_buffer(
+     libfwsi_internal_carver_t *internal_carver,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t search_size,
+     size_t *buffer_offset,
+     libfwsi_carver_hit_t *hits,
+     int maximum_number_of_hits,
+     int *number_of_hits,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_scan_buffer(
+     libfwsi_carver_t *carver,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     libfwsi_carver_hit_t *hits,
+     int maximum_number_of_hits,
+     int *number_of_hits,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_CARVER_H ) */
+
@@ -0,0 +1,581 @@
+/*
+ * Shell item list carver driver functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_carver.h"
+#include "libfwsi_carver_driver.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_types.h"
+
+/* Carves shell item lists from data
+ * The data is split into chunks of chunk_size, where chunk_size 0 represents
+ * LIBFWSI_CARVER_DRIVER_DEFAULT_CHUNK_SIZE. Every chunk is searched for candidates
+ * including an overlap with the next chunk and the shell item lists are scanned
+ * until they terminate, so that shell item lists that cross a chunk boundary
+ * are carved by the chunk they start in
+ * The chunks are distributed over number_of_threads worker threads, if multi-threading
+ * is not supported or number_of_threads is 0 or 1 the chunks are carved by the calling thread
+ * The hit callback is invoked by the calling thread for every hit in offset order,
+ * where the hit offsets are relative to the start of the data. Hits that overlap
+ * a previous hit, such as a part of a shell item list found by the next chunk, are not reported
+ * The hit callback returns 1 to continue carving, 0 to stop carving or -1 on error
+ * Returns 1 if successful, 0 if carving was stopped by the hit callback or -1 on error
+ */
+int libfwsi_carver_scan_data(
+     libfwsi_carver_t *carver,
+     const uint8_t *data,
+     size_t data_size,
+     size_t chunk_size,
+     int number_of_threads,
+     int (*hit_callback)(
+            void *user_data,
+            const libfwsi_carver_hit_t *hit ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libfwsi_carver_driver_t carver_driver;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	libfwsi_carver_chunk_t *chunk          = NULL;
+	libfwsi_carver_chunk_t *chunks         = NULL;
+	static char *function                  = "libfwsi_carver_scan_data";
+	size_t chunk_offset                    = 0;
+	size_t hits_end_offset                 = 0;
+	size_t number_of_chunks                = 0;
+	int chunk_index                        = 0;
+	int hit_index                          = 0;
+	int maximum_number_of_chunks           = 1;
+	int number_of_batch_chunks             = 0;
+	int result                             = 1;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFWSI_CARVER_DRIVER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hit_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		chunk_size = LIBFWSI_CARVER_DRIVER_DEFAULT_CHUNK_SIZE;
+	}
+	number_of_chunks = data_size / chunk_size;
+
+	if( ( data_size % chunk_size ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		maximum_number_of_chunks = number_of_threads * LIBFWSI_CARVER_DRIVER_CHUNKS_PER_THREAD;
+
+		if( (size_t) maximum_number_of_chunks > number_of_chunks )
+		{
+			maximum_number_of_chunks = (int) number_of_chunks;
+		}
+	}
+#endif
+	chunks = (libfwsi_carver_chunk_t *) memory_allocate(
+	                                     sizeof( libfwsi_carver_chunk_t ) * maximum_number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     chunks,
+	     0,
+	     sizeof( libfwsi_carver_chunk_t ) * maximum_number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		memory_free(
+		 chunks );
+
+		return( -1 );
+	}
+	carver_driver.carver    = carver;
+	carver_driver.data      = data;
+	carver_driver.data_size = data_size;
+
+	/* The chunks are carved in batches to bound the number of hits kept in memory
+	 */
+	while( ( result == 1 )
+	    && ( chunk_offset < data_size ) )
+	{
+		for( number_of_batch_chunks = 0;
+		     number_of_batch_chunks < maximum_number_of_chunks;
+		     number_of_batch_chunks++ )
+		{
+			if( chunk_offset >= data_size )
+			{
+				break;
+			}
+			chunk = &( chunks[ number_of_batch_chunks ] );
+
+			chunk->offset         = chunk_offset;
+			chunk->size           = data_size - chunk_offset;
+			chunk->number_of_hits = 0;
+			chunk->result         = 0;
+
+			if( chunk->size > chunk_size )
+			{
+				chunk->size = chunk_size;
+			}
+			chunk_offset += chunk->size;
+		}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( number_of_batch_chunks > 1 )
+		{
+			/* Joining the thread pool is the only way to wait for all the chunks
+			 * of the batch, hence a thread pool is created per batch
+			 */
+			if( libcthreads_thread_pool_create(
+			     &thread_pool,
+			     NULL,
+			     ( number_of_threads < number_of_batch_chunks ) ? number_of_threads : number_of_batch_chunks,
+			     maximum_number_of_chunks,
+			     (int (*)(intptr_t *, void *)) &libfwsi_carver_driver_process_chunk,
+			     (void *) &carver_driver,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( chunk_index = 0;
+			     chunk_index < number_of_batch_chunks;
+			     chunk_index++ )
+			{
+				if( libcthreads_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( chunks[ chunk_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push chunk: %d onto thread pool queue.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+#endif /* defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT ) */
+		{
+			for( chunk_index = 0;
+			     chunk_index < number_of_batch_chunks;
+			     chunk_index++ )
+			{
+				libfwsi_carver_driver_process_chunk(
+				 &( chunks[ chunk_index ] ),
+				 &carver_driver );
+			}
+		}
+		/* Merge the hits of the chunks in offset order
+		 */
+		for( chunk_index = 0;
+		     chunk_index < number_of_batch_chunks;
+		     chunk_index++ )
+		{
+			chunk = &( chunks[ chunk_index ] );
+
+			if( chunk->result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to carve chunk at offset: %" PRIzd ".",
+				 function,
+				 chunk->offset );
+
+				goto on_error;
+			}
+			for( hit_index = 0;
+			     hit_index < chunk->number_of_hits;
+			     hit_index++ )
+			{
+				if( chunk->hits[ hit_index ].offset < hits_end_offset )
+				{
+					continue;
+				}
+				hits_end_offset = chunk->hits[ hit_index ].offset + chunk->hits[ hit_index ].size;
+
+				result = hit_callback(
+				          user_data,
+				          &( chunk->hits[ hit_index ] ) );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to process hit at offset: %" PRIzd ".",
+					 function,
+					 chunk->hits[ hit_index ].offset );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+			}
+			if( result == 0 )
+			{
+				break;
+			}
+		}
+	}
+	for( chunk_index = 0;
+	     chunk_index < maximum_number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].hits != NULL )
+		{
+			memory_free(
+			 chunks[ chunk_index ].hits );
+		}
+	}
+	memory_free(
+	 chunks );
+
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		/* The worker threads can still reference the chunks
+		 */
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < maximum_number_of_chunks;
+		     chunk_index++ )
+		{
+			if( chunks[ chunk_index ].hits != NULL )
+			{
+				memory_free(
+				 chunks[ chunk_index ].hits );
+			}
+		}
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
+/* Carves a chunk
+ * The chunk is searched for candidates including the overlap with the next chunk
+ * and the shell item lists are scanned up to the end of the data,
+ * but only the hits that start within the chunk are kept
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_driver_carve_chunk(
+     libfwsi_carver_driver_t *carver_driver,
+     libfwsi_carver_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libfwsi_carver_hit_t scan_hits[ LIBFWSI_CARVER_DRIVER_NUMBER_OF_SCAN_HITS ];
+
+	libfwsi_carver_hit_t *hits = NULL;
+	static char *function      = "libfwsi_carver_driver_carve_chunk";
+	size_t buffer_size         = 0;
+	size_t scan_offset         = 0;
+	size_t search_size         = 0;
+	int hit_index              = 0;
+	int number_of_scan_hits    = 0;
+
+	if( carver_driver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver driver.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->offset >= carver_driver->data_size )
+	 || ( chunk->size > ( carver_driver->data_size - chunk->offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_size = carver_driver->data_size - chunk->offset;
+	search_size = buffer_size;
+
+	if( search_size > ( chunk->size + LIBFWSI_CARVER_DRIVER_OVERLAP_SIZE ) )
+	{
+		search_size = chunk->size + LIBFWSI_CARVER_DRIVER_OVERLAP_SIZE;
+	}
+	chunk->number_of_hits = 0;
+
+	while( scan_offset < search_size )
+	{
+		if( libfwsi_internal_carver_scan_buffer(
+		     (libfwsi_internal_carver_t *) carver_driver->carver,
+		     &( carver_driver->data[ chunk->offset ] ),
+		     buffer_size,
+		     search_size,
+		     &scan_offset,
+		     scan_hits,
+		     LIBFWSI_CARVER_DRIVER_NUMBER_OF_SCAN_HITS,
+		     &number_of_scan_hits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunk.",
+			 function );
+
+			return( -1 );
+		}
+		for( hit_index = 0;
+		     hit_index < number_of_scan_hits;
+		     hit_index++ )
+		{
+			/* The hits are in offset order, hence the remaining hits
+			 * start in the overlap and are carved by the next chunk
+			 */
+			if( scan_hits[ hit_index ].offset >= chunk->size )
+			{
+				scan_offset = search_size;
+
+				break;
+			}
+			if( chunk->number_of_hits >= chunk->number_of_allocated_hits )
+			{
+				if( chunk->number_of_allocated_hits == 0 )
+				{
+					chunk->number_of_allocated_hits = LIBFWSI_CARVER_DRIVER_NUMBER_OF_SCAN_HITS;
+				}
+				else
+				{
+					chunk->number_of_allocated_hits *= 2;
+				}
+				hits = (libfwsi_carver_hit_t *) memory_reallocate(
+				                                 chunk->hits,
+				                                 sizeof( libfwsi_carver_hit_t ) * chunk->number_of_allocated_hits );
+
+				if( hits == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize hits.",
+					 function );
+
+					return( -1 );
+				}
+				chunk->hits = hits;
+			}
+			chunk->hits[ chunk->number_of_hits ] = scan_hits[ hit_index ];
+
+			chunk->hits[ chunk->number_of_hits ].offset += chunk->offset;
+
+			chunk->number_of_hits += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Processes a carver driver chunk
+ * This function is the callback of the carver driver worker threads
+ * Every chunk is written by a single worker thread hence no locking is required
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_driver_process_chunk(
+     libfwsi_carver_chunk_t *chunk,
+     libfwsi_carver_driver_t *carver_driver )
+{
+	libcerror_error_t *error = NULL;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function    = "libfwsi_carver_driver_process_chunk";
+#endif
+
+	if( ( chunk == NULL )
+	 || ( carver_driver == NULL ) )
+	{
+		return( -1 );
+	}
+	chunk->result = libfwsi_carver_driver_carve_chunk(
+	                 carver_driver,
+	                 chunk,
+	                 &error );
+
+	if( chunk->result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to carve chunk at offset: %" PRIzd ".\n",
+			 function,
+			 chunk->offset );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+}
+
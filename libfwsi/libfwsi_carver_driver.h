@@ -0,0 +1,135 @@
+/*
+ * Shell item list carver driver functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_CARVER_DRIVER_H )
+#define _LIBFWSI_CARVER_DRIVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_carver.h"
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of worker threads of a carver driver
+ */
+#define LIBFWSI_CARVER_DRIVER_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The default size of a chunk
+ */
+#define LIBFWSI_CARVER_DRIVER_DEFAULT_CHUNK_SIZE		( 64 * 1024 * 1024 )
+
+/* The size of the overlap of a chunk with the next chunk that is searched for candidates
+ * A shell item list is found from a candidate at its start or from the extension block
+ * signature of a shell item, which is at most 4 + 0xffff bytes after the start of
+ * the shell item that is at most the backtrack distance of the carver after the start
+ * of the shell item list. The shell item lists themselves are scanned until they
+ * terminate, hence they are not bounded by the overlap
+ */
+#define LIBFWSI_CARVER_DRIVER_OVERLAP_SIZE		( ( LIBFWSI_CARVER_MAXIMUM_BACKTRACK_ITEMS * LIBFWSI_CARVER_MAXIMUM_BACKTRACK_DISTANCE ) + 0xffff + 4 )
+
+/* The number of chunks carved per worker thread before the hits are merged
+ */
+#define LIBFWSI_CARVER_DRIVER_CHUNKS_PER_THREAD		4
+
+/* The number of hits retrieved per scan of a chunk
+ */
+#define LIBFWSI_CARVER_DRIVER_NUMBER_OF_SCAN_HITS	64
+
+typedef struct libfwsi_carver_driver libfwsi_carver_driver_t;
+
+struct libfwsi_carver_driver
+{
+	/* The carver
+	 */
+	libfwsi_carver_t *carver;
+
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libfwsi_carver_chunk libfwsi_carver_chunk_t;
+
+struct libfwsi_carver_chunk
+{
+	/* The offset of the chunk relative to the start of the data
+	 */
+	size_t offset;
+
+	/* The size of the chunk without the overlap
+	 */
+	size_t size;
+
+	/* The hits that start within the chunk
+	 */
+	libfwsi_carver_hit_t *hits;
+
+	/* The number of hits
+	 */
+	int number_of_hits;
+
+	/* The number of allocated hits
+	 */
+	int number_of_allocated_hits;
+
+	/* The result, 1 if the chunk was carved or -1 on error
+	 */
+	int result;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_scan_data(
+     libfwsi_carver_t *carver,
+     const uint8_t *data,
+     size_t data_size,
+     size_t chunk_size,
+     int number_of_threads,
+     int (*hit_callback)(
+            void *user_data,
+            const libfwsi_carver_hit_t *hit ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libfwsi_carver_driver_carve_chunk(
+     libfwsi_carver_driver_t *carver_driver,
+     libfwsi_carver_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libfwsi_carver_driver_process_chunk(
+     libfwsi_carver_chunk_t *chunk,
+     libfwsi_carver_driver_t *carver_driver );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_CARVER_DRIVER_H ) */
+
@@ -0,0 +1,815 @@
+/*
+ * Shell item classifier functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_classifier.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_delegate_folder_values.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_shell_folder_identifier.h"
+
+/* The item type per class type indicator
+ * The values correspond to LIBFWSI_ITEM_TYPE_UNKNOWN (0), LIBFWSI_ITEM_TYPE_CONTROL_PANEL_ITEM (4),
+ * LIBFWSI_ITEM_TYPE_FILE_ENTRY (7), LIBFWSI_ITEM_TYPE_NETWORK_LOCATION (11), LIBFWSI_ITEM_TYPE_ROOT_FOLDER (12),
+ * LIBFWSI_ITEM_TYPE_URI (13) and LIBFWSI_ITEM_TYPE_VOLUME (16)
+ */
+const uint8_t libfwsi_classifier_class_type_table[ 256 ] = {
+	/* 0x00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0x10 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,
+	/* 0x20 */ 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	/* 0x30 */  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+	/* 0x40 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	/* 0x50 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0x60 */  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0x70 */  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0x80 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0x90 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0xa0 */ 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	/* 0xb0 */  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+	/* 0xc0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	/* 0xd0 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0xe0 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	/* 0xf0 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 };
+
+/* The signature table, indexed by libfwsi_classifier_signature_hash( signature )
+ */
+const libfwsi_classifier_signature_t libfwsi_classifier_signature_table[ LIBFWSI_CLASSIFIER_NUMBER_OF_SIGNATURE_TABLE_ENTRIES ] = {
+	/* 0 */
+	{ 0x3b93afbbUL, 6, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 4 "AugM" */
+	{ 0x4d677541UL, 4, LIBFWSI_ITEM_TYPE_CDBURN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 6 */
+	{ 0x10141981UL, 6, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 8 "GFSI" */
+	{ 0x49534647UL, 4, LIBFWSI_ITEM_TYPE_GAME_FOLDER },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 11 */
+	{ 0xc001b000UL, 4, LIBFWSI_ITEM_TYPE_WEB_SITE },
+	/* 12 */
+	{ 0xffffff38UL, 4, LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 14 */
+	{ 0xacb16752UL, 2, LIBFWSI_ITEM_TYPE_ACRONIS_TIB_FILE },
+	/* 15 */
+	{ 0x39de2184UL, 4, LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 18 */
+	{ 0x07192006UL, 6, LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY },
+	/* 19 */
+	{ 0xbeebee00UL, 6, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 21 */
+	{ 0x23febbeeUL, 6, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 23 "ARPI" */
+	{ 0x49505241UL, 6, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	/* 24 */
+	{ 0x23a3dfd5UL, 6, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	/* 28 */
+	{ 0x10312005UL, 6, LIBFWSI_ITEM_TYPE_MTP_VOLUME },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0, 0, LIBFWSI_ITEM_TYPE_UNKNOWN } };
+
+/* The compressed folder patterns
+ * The patterns match the UTF-16 little-endian date and time strings
+ * of the different compressed folder shell item layouts
+ */
+const libfwsi_classifier_pattern_t libfwsi_classifier_compressed_folder_patterns[ 3 ] = {
+	/* "/" at 28, "/" at 34, "  " at 40, ":" at 48 and 0 at 54 */
+	{ 56, 3,
+	  { 28, 40, 48, 0 },
+	  { 0xffff00000000ffffULL, 0x00000000ffffffffULL, 0xffff00000000ffffULL, 0 },
+	  { 0x002f00000000002fULL, 0x0000000000200020ULL, 0x000000000000003aULL, 0 } },
+
+	/* "N/A" at 36 */
+	{ 78, 1,
+	  { 36, 0, 0, 0 },
+	  { 0xffffffffffffffffULL, 0, 0, 0 },
+	  { 0x00000041002f004eULL, 0, 0, 0 } },
+
+	/* "/" at 40, "/" at 46, "  " at 56, ":" at 64, ":" at 70 and 0 at 76 */
+	{ 78, 4,
+	  { 40, 56, 64, 70 },
+	  { 0xffff00000000ffffULL, 0x00000000ffffffffULL, 0xffff00000000ffffULL, 0xffff00000000ffffULL },
+	  { 0x002f00000000002fULL, 0x0000000000200020ULL, 0x003a00000000003aULL, 0x000000000000003aULL } } };
+
+/* Retrieves the item type based on the signature at offset 2, 4 or 6
+ * The signature is set to the last value read, which is the matching
+ * signature if the item type is known
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_classifier_get_signature_item_type(
+     const uint8_t *data,
+     size_t data_size,
+     int *item_type,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	const libfwsi_classifier_signature_t *table_entry = NULL;
+	static char *function                             = "libfwsi_classifier_get_signature_item_type";
+	size_t data_offset                                = 0;
+	uint32_t value_32bit                              = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	*item_type = LIBFWSI_ITEM_TYPE_UNKNOWN;
+
+	for( data_offset = 2;
+	     data_offset <= 6;
+	     data_offset += 2 )
+	{
+		if( ( data_offset + 4 ) > data_size )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		*signature = value_32bit;
+
+		table_entry = &( libfwsi_classifier_signature_table[ libfwsi_classifier_signature_hash( value_32bit ) ] );
+
+		if( ( table_entry->signature == value_32bit )
+		 && ( table_entry->offset == (uint8_t) data_offset )
+		 && ( table_entry->item_type != LIBFWSI_ITEM_TYPE_UNKNOWN ) )
+		{
+			*item_type = (int) table_entry->item_type;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the data matches a pattern
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int libfwsi_classifier_match_pattern(
+     const libfwsi_classifier_pattern_t *pattern,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwsi_classifier_match_pattern";
+	uint64_t value_64bit     = 0;
+	uint8_t comparison_index = 0;
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern->number_of_comparisons > 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pattern - number of comparisons value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < (size_t) pattern->minimum_data_size )
+	{
+		return( 0 );
+	}
+	for( comparison_index = 0;
+	     comparison_index < pattern->number_of_comparisons;
+	     comparison_index++ )
+	{
+		if( ( (size_t) pattern->offsets[ comparison_index ] + 8 ) > data_size )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ pattern->offsets[ comparison_index ] ] ),
+		 value_64bit );
+
+		if( ( value_64bit & pattern->masks[ comparison_index ] ) != pattern->values[ comparison_index ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the item values data of an item type is supported
+ * The checks correspond to those of the item values read functions, so that
+ * the item type is final once the shell item has been classified
+ * Returns 1 if supported, 0 if not or -1 on error
+ */
+int libfwsi_classifier_is_supported_data(
+     int item_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_classifier_is_supported_data";
+	size_t minimum_size   = 0;
+	int pattern_index     = 0;
+	int result            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( item_type )
+	{
+		case LIBFWSI_ITEM_TYPE_ACRONIS_TIB_FILE:
+			minimum_size = 50;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CDBURN:
+			minimum_size = 18;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+			minimum_size = 68;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY:
+			minimum_size = 12;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE:
+		case LIBFWSI_ITEM_TYPE_WEB_SITE:
+			minimum_size = 24;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_ITEM:
+			minimum_size = 30;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+		case LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW:
+			minimum_size = 14;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_GAME_FOLDER:
+			minimum_size = 32;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY:
+		case LIBFWSI_ITEM_TYPE_MTP_VOLUME:
+			minimum_size = 10;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
+		case LIBFWSI_ITEM_TYPE_URI:
+			minimum_size = 6;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			minimum_size = 20;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_URI_SUB_VALUES:
+			minimum_size = 38;
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( data_size < minimum_size )
+	{
+		return( 0 );
+	}
+	/* The signature based item types were matched on their signature
+	 * and the class type based item types on a range of class types,
+	 * of which only specific class types are supported
+	 */
+	switch( item_type )
+	{
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+			for( pattern_index = 0;
+			     pattern_index < 3;
+			     pattern_index++ )
+			{
+				/* The layouts without a Windows XP date and time string require 92 bytes of data
+				 */
+				if( ( pattern_index > 0 )
+				 && ( data_size < 92 ) )
+				{
+					break;
+				}
+				result = libfwsi_classifier_match_pattern(
+				          &( libfwsi_classifier_compressed_folder_patterns[ pattern_index ] ),
+				          data,
+				          data_size,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to match compressed folder pattern: %d.",
+				 function,
+				 pattern_index );
+
+				return( -1 );
+			}
+			return( result );
+
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+			if( ( data[ 2 ] != 0x30 )
+			 && ( data[ 2 ] != 0x31 )
+			 && ( data[ 2 ] != 0x32 )
+			 && ( data[ 2 ] != 0x35 )
+			 && ( data[ 2 ] != 0x36 )
+			 && ( data[ 2 ] != 0xb1 ) )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
+			if( ( data[ 2 ] != 0x41 )
+			 && ( data[ 2 ] != 0x42 )
+			 && ( data[ 2 ] != 0x46 )
+			 && ( data[ 2 ] != 0x47 )
+			 && ( data[ 2 ] != 0x4c )
+			 && ( data[ 2 ] != 0xc3 ) )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			if( ( data[ 2 ] != 0x23 )
+			 && ( data[ 2 ] != 0x25 )
+			 && ( data[ 2 ] != 0x29 )
+			 && ( data[ 2 ] != 0x2a )
+			 && ( data[ 2 ] != 0x2e )
+			 && ( data[ 2 ] != 0x2f ) )
+			{
+				return( 0 );
+			}
+			/* A volume without a shell folder identifier contains a drive letter
+			 */
+			if( ( data[ 2 ] != 0x2e )
+			 && ( data_size < 25 ) )
+			{
+				return( 0 );
+			}
+			break;
+
+		default:
+			break;
+	}
+	return( 1 );
+}
+
+/* Classifies shell item data
+ * The data should start with the 16-bit shell item size and data_size should be the shell item size
+ * The parent item type is used to determine the type of items contained in compressed folder and URI items
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_classifier_classify_data(
+     const uint8_t *data,
+     size_t data_size,
+     int parent_item_type,
+     libfwsi_classifier_result_t *result,
+     libcerror_error_t **error )
+{
+	libfwsi_delegate_folder_values_t delegate_folder_values;
+
+	static char *function                   = "libfwsi_classifier_classify_data";
+	const uint8_t *shell_item_data          = NULL;
+	size_t delegate_class_identifier_offset = 0;
+	size_t delegate_shell_item_data_size    = 0;
+	size_t shell_item_data_size             = 0;
+	uint32_t signature                      = 0;
+	int item_type                           = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	int pattern_index                       = 0;
+	int result_value                        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     result,
+	     0,
+	     sizeof( libfwsi_classifier_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result.",
+		 function );
+
+		return( -1 );
+	}
+	shell_item_data      = data;
+	shell_item_data_size = data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( shell_item_data[ 2 ] ),
+		 shell_item_data_size - 2,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( shell_item_data_size >= 38 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_size - 2 ] ),
+		 delegate_class_identifier_offset );
+
+		if( ( delegate_class_identifier_offset >= 32 )
+		 && ( delegate_class_identifier_offset < ( shell_item_data_size - 2 ) ) )
+		{
+			delegate_shell_item_data_size = delegate_class_identifier_offset;
+		}
+		else
+		{
+			delegate_class_identifier_offset = shell_item_data_size;
+			delegate_shell_item_data_size    = shell_item_data_size;
+		}
+		delegate_class_identifier_offset -= 32;
+
+		if( memory_compare(
+		     &( shell_item_data[ delegate_class_identifier_offset ] ),
+		     libfwsi_delegate_class_identifier,
+		     16 ) == 0 )
+		{
+			/* The delegate folder values only reference the shell item data
+			 * hence they are kept on the stack
+			 */
+			if( memory_set(
+			     &delegate_folder_values,
+			     0,
+			     sizeof( libfwsi_delegate_folder_values_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear delegate folder values.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwsi_delegate_folder_values_read_data(
+			     &delegate_folder_values,
+			     shell_item_data,
+			     delegate_shell_item_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read delegate folder values.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     result->delegate_folder_identifier,
+			     delegate_folder_values.identifier,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy delegate folder identifier.",
+				 function );
+
+				return( -1 );
+			}
+			result->has_delegate_folder_identifier = 1;
+
+			if( memory_compare(
+			     delegate_folder_values.identifier,
+			     libfwsi_shell_folder_identifier_search_folder,
+			     16 ) == 0 )
+			{
+				/* Do not realign shell_item_data */
+			}
+			else if( memory_compare(
+			          delegate_folder_values.identifier,
+			          libfwsi_shell_folder_identifier_users_files_folder_delegate_folder,
+			          16 ) == 0 )
+			{
+/* TODO debug print unknown data */
+				shell_item_data      = &( delegate_folder_values.inner_data[ 4 ] );
+				shell_item_data_size = delegate_folder_values.inner_data_size - 4;
+			}
+			else if( memory_compare(
+			          delegate_folder_values.identifier,
+			          libfwsi_shell_folder_identifier_removable_drives,
+			          16 ) == 0 )
+			{
+/* TODO debug print unknown data */
+				shell_item_data      = &( delegate_folder_values.inner_data[ 4 ] );
+				shell_item_data_size = delegate_folder_values.inner_data_size - 4;
+			}
+			else
+			{
+				shell_item_data      = delegate_folder_values.inner_data;
+				shell_item_data_size = delegate_folder_values.inner_data_size;
+			}
+		}
+	}
+	if( libfwsi_classifier_get_signature_item_type(
+	     shell_item_data,
+	     shell_item_data_size,
+	     &item_type,
+	     &signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature item type.",
+		 function );
+
+		return( -1 );
+	}
+	for( pattern_index = 0;
+	     ( item_type == LIBFWSI_ITEM_TYPE_UNKNOWN ) && ( pattern_index < 3 );
+	     pattern_index++ )
+	{
+		result_value = libfwsi_classifier_match_pattern(
+		                &( libfwsi_classifier_compressed_folder_patterns[ pattern_index ] ),
+		                shell_item_data,
+		                shell_item_data_size,
+		                error );
+
+		if( result_value == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match compressed folder pattern: %d.",
+			 function,
+			 pattern_index );
+
+			return( -1 );
+		}
+		else if( result_value != 0 )
+		{
+			item_type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
+		}
+	}
+	if( ( item_type == LIBFWSI_ITEM_TYPE_UNKNOWN )
+	 && ( shell_item_data_size >= 3 ) )
+	{
+		result->class_type = shell_item_data[ 2 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: class type indicator\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 result->class_type );
+		}
+#endif
+		item_type = (int) libfwsi_classifier_class_type_table[ result->class_type ];
+	}
+	switch( parent_item_type )
+	{
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+			item_type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_URI:
+			item_type = LIBFWSI_ITEM_TYPE_URI_SUB_VALUES;
+			break;
+
+		default:
+			break;
+	}
+	/* Items of which the values are not supported are unknown, which is determined
+	 * here rather than when reading the item values, so that the item type does not
+	 * change when the reading of the item values is deferred
+	 */
+	if( item_type != LIBFWSI_ITEM_TYPE_UNKNOWN )
+	{
+		result_value = libfwsi_classifier_is_supported_data(
+		                item_type,
+		                shell_item_data,
+		                shell_item_data_size,
+		                error );
+
+		if( result_value == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if item values data is supported.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result_value == 0 )
+		{
+			item_type = LIBFWSI_ITEM_TYPE_UNKNOWN;
+		}
+	}
+	switch( item_type )
+	{
+		case LIBFWSI_ITEM_TYPE_CDBURN:
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+		case LIBFWSI_ITEM_TYPE_GAME_FOLDER:
+		case LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY:
+		case LIBFWSI_ITEM_TYPE_MTP_VOLUME:
+			result->signature = signature;
+			break;
+
+		case LIBFWSI_ITEM_TYPE_UNKNOWN:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unsupported shell item type.\n",
+				 function );
+			}
+#endif
+			result->class_type = 0;
+			break;
+
+		default:
+			break;
+	}
+	result->item_type        = item_type;
+	result->values_data      = shell_item_data;
+	result->values_data_size = shell_item_data_size;
+
+	return( 1 );
+}
+
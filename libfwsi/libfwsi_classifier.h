@@ -0,0 +1,156 @@
+/*
+ * Shell item classifier functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_CLASSIFIER_H )
+#define _LIBFWSI_CLASSIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of entries in the signature table
+ */
+#define LIBFWSI_CLASSIFIER_NUMBER_OF_SIGNATURE_TABLE_ENTRIES	32
+
+/* The signature table hash
+ * The multiplier was chosen so that the known signatures map to distinct entries
+ */
+#define libfwsi_classifier_signature_hash( signature ) \
+	(int) ( ( (uint32_t) ( ( signature ) * 0x9e3779b9UL ) ) >> 27 )
+
+typedef struct libfwsi_classifier_signature libfwsi_classifier_signature_t;
+
+struct libfwsi_classifier_signature
+{
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* The offset of the signature relative to the start of the shell item
+	 */
+	uint8_t offset;
+
+	/* The item type
+	 */
+	uint8_t item_type;
+};
+
+typedef struct libfwsi_classifier_pattern libfwsi_classifier_pattern_t;
+
+struct libfwsi_classifier_pattern
+{
+	/* The minimum data size
+	 */
+	uint8_t minimum_data_size;
+
+	/* The number of comparisons
+	 */
+	uint8_t number_of_comparisons;
+
+	/* The offsets of the 64-bit little-endian values to compare
+	 */
+	uint8_t offsets[ 4 ];
+
+	/* The masks applied to the values
+	 */
+	uint64_t masks[ 4 ];
+
+	/* The expected masked values
+	 */
+	uint64_t values[ 4 ];
+};
+
+typedef struct libfwsi_classifier_result libfwsi_classifier_result_t;
+
+struct libfwsi_classifier_result
+{
+	/* The item type
+	 */
+	int item_type;
+
+	/* The class type
+	 */
+	uint8_t class_type;
+
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* Value to indicate the delegate folder identifier is set
+	 */
+	uint8_t has_delegate_folder_identifier;
+
+	/* The delegate folder identifier
+	 */
+	uint8_t delegate_folder_identifier[ 16 ];
+
+	/* The item values data
+	 */
+	const uint8_t *values_data;
+
+	/* The item values data size
+	 */
+	size_t values_data_size;
+};
+
+extern const uint8_t libfwsi_classifier_class_type_table[ 256 ];
+
+extern const libfwsi_classifier_signature_t libfwsi_classifier_signature_table[ LIBFWSI_CLASSIFIER_NUMBER_OF_SIGNATURE_TABLE_ENTRIES ];
+
+extern const libfwsi_classifier_pattern_t libfwsi_classifier_compressed_folder_patterns[ 3 ];
+
+int libfwsi_classifier_get_signature_item_type(
+     const uint8_t *data,
+     size_t data_size,
+     int *item_type,
+     uint32_t *signature,
+     libcerror_error_t **error );
+
+int libfwsi_classifier_match_pattern(
+     const libfwsi_classifier_pattern_t *pattern,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwsi_classifier_is_supported_data(
+     int item_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwsi_classifier_classify_data(
+     const uint8_t *data,
+     size_t data_size,
+     int parent_item_type,
+     libfwsi_classifier_result_t *result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_CLASSIFIER_H ) */
+
@@ -29,6 +29,8 @@
 #include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_cache.h"
+#include "libfwsi_utf8_string.h"
 
 /* Retrieves the size of the UTF-8 formatted name
  * Returns 1 if successful or -1 on error
@@ -65,6 +67,19 @@ int libfwsi_compressed_folder_get_utf8_name_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_compressed_folder_values_get_utf8_name_size(
 	     (libfwsi_compressed_folder_values_t *) internal_item->value,
 	     utf8_string_size,
@@ -118,6 +133,19 @@ int libfwsi_compressed_folder_get_utf8_name(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_compressed_folder_values_get_utf8_name(
 	     (libfwsi_compressed_folder_values_t *) internal_item->value,
 	     utf8_string,
@@ -171,6 +199,19 @@ int libfwsi_compressed_folder_get_utf16_name_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_compressed_folder_values_get_utf16_name_size(
 	     (libfwsi_compressed_folder_values_t *) internal_item->value,
 	     utf16_string_size,
@@ -224,6 +265,19 @@ int libfwsi_compressed_folder_get_utf16_name(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_compressed_folder_values_get_utf16_name(
 	     (libfwsi_compressed_folder_values_t *) internal_item->value,
 	     utf16_string,
@@ -242,6 +296,134 @@ int libfwsi_compressed_folder_get_utf16_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted name
+ * The name is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_compressed_folder_get_cached_utf8_name(
+     libfwsi_item_t *compressed_folder,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_compressed_folder_get_cached_utf8_name";
+	int result                             = 0;
+
+	if( compressed_folder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed folder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) compressed_folder;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_NAME,
+	          (intptr_t *) compressed_folder,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_compressed_folder_get_utf8_name_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_compressed_folder_get_utf8_name,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted name
+ * The name is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_compressed_folder_get_cached_utf16_name(
+     libfwsi_item_t *compressed_folder,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_compressed_folder_get_cached_utf16_name";
+	int result                             = 0;
+
+	if( compressed_folder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed folder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) compressed_folder;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_NAME,
+	          (intptr_t *) compressed_folder,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_compressed_folder_get_utf16_name_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_compressed_folder_get_utf16_name,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 formatted name
  * The size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -264,7 +446,7 @@ int libfwsi_compressed_folder_values_get_utf8_name_size(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libfwsi_utf8_string_size_from_utf16_stream(
 	     compressed_folder_values->name,
 	     compressed_folder_values->name_size,
 	     LIBUNA_ENDIAN_LITTLE,
@@ -306,7 +488,7 @@ int libfwsi_compressed_folder_values_get_utf8_name(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libfwsi_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     compressed_folder_values->name,
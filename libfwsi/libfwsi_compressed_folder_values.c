@@ -128,11 +128,6 @@ int libfwsi_compressed_folder_values_free(
 	}
 	if( *compressed_folder_values != NULL )
 	{
-		if( ( *compressed_folder_values )->name != NULL )
-		{
-			memory_free(
-			 ( *compressed_folder_values )->name );
-		}
 		memory_free(
 		 *compressed_folder_values );
 
@@ -504,45 +499,7 @@ int libfwsi_compressed_folder_values_read_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( name_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid name string size value exceeds maximum.",
-		 function );
-
-		goto on_error;
-	}
-	compressed_folder_values->name = (uint8_t *) memory_allocate(
-	                                              sizeof( uint8_t ) * name_string_size );
-
-	if( compressed_folder_values->name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create name.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     compressed_folder_values->name,
-	     &( data[ data_offset ] ),
-	     name_string_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy name.",
-		 function );
-
-		goto on_error;
-	}
+	compressed_folder_values->name = &( data[ data_offset ] );
 	compressed_folder_values->name_size = name_string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -646,13 +603,7 @@ int libfwsi_compressed_folder_values_read_data(
 	return( 1 );
 
 on_error:
-	if( compressed_folder_values->name != NULL )
-	{
-		memory_free(
-		 compressed_folder_values->name );
-
-		compressed_folder_values->name = NULL;
-	}
+	compressed_folder_values->name = NULL;
 	compressed_folder_values->name_size = 0;
 
 	return( -1 );
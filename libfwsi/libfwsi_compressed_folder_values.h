@@ -37,7 +37,7 @@ struct libfwsi_compressed_folder_values
 {
 	/* The name
 	 */
-	uint8_t *name;
+	const uint8_t *name;
 
 	/* The name size
 	 */
@@ -66,6 +66,19 @@ int libfwsi_control_panel_category_get_identifier(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -29,6 +29,7 @@
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_scan.h"
 
 /* Creates control panel CPL file values
  * Make sure the value control_panel_cpl_file_values is referencing, is set to NULL
@@ -264,18 +265,10 @@ int libfwsi_control_panel_cpl_file_values_read_data(
 
 	if( data_offset <= ( data_size - 2 ) )
 	{
-		for( string_size = data_offset;
-		     string_size < data_size;
-		     string_size += 2 )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= data_offset;
+		string_size = libfwsi_string_scan_get_utf16_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -303,18 +296,10 @@ int libfwsi_control_panel_cpl_file_values_read_data(
 	}
 	if( data_offset <= ( data_size - 2 ) )
 	{
-		for( string_size = data_offset;
-		     string_size < data_size;
-		     string_size += 2 )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= data_offset;
+		string_size = libfwsi_string_scan_get_utf16_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -342,18 +327,10 @@ int libfwsi_control_panel_cpl_file_values_read_data(
 	}
 	if( data_offset <= ( data_size - 2 ) )
 	{
-		for( string_size = data_offset;
-		     string_size < data_size;
-		     string_size += 2 )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= data_offset;
+		string_size = libfwsi_string_scan_get_utf16_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
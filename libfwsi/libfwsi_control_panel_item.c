@@ -67,6 +67,19 @@ int libfwsi_control_panel_item_get_identifier(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_control_panel_item_values_get_identifier(
 	     (libfwsi_control_panel_item_values_t *) internal_item->value,
 	     guid_data,
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -259,191 +260,256 @@ uint8_t libfwsi_control_panel_item_identifier_unknown[ 16 ] = {
 	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
 
 /* The control panel item identifiers
+ * The definitions are sorted by identifier byte value, the unknown identifier is used as terminator
  */
 libfwsi_control_panel_item_identifier_definition_t libfwsi_control_panel_item_identifier_definitions[ ] = {
-
-	{ libfwsi_control_panel_item_identifier_action_center_cpl,
-	  "Action Center CPL" },
-	{ libfwsi_control_panel_item_identifier_add_new_hardware,
-	  "Add New Hardware" },
-	{ libfwsi_control_panel_item_identifier_administrative_tools,
-	  "Administrative Tools" },
+	{ libfwsi_control_panel_item_identifier_storage_spaces,
+	  "Storage Spaces" },
+	{ libfwsi_control_panel_item_identifier_windows_anytime_upgrade,
+	  "Windows Anytime Upgrade" },
+	{ libfwsi_control_panel_item_identifier_infrared,
+	  "Infrared" },
+	{ libfwsi_control_panel_item_identifier_region_and_language,
+	  "Region and Language" },
+	{ libfwsi_control_panel_item_identifier_mouse,
+	  "Mouse" },
+	{ libfwsi_control_panel_item_identifier_network_map,
+	  "Network Map" },
 	{ libfwsi_control_panel_item_identifier_autoplay,
 	  "AutoPlay" },
-	{ libfwsi_control_panel_item_identifier_backup_and_restore,
-	  "Backup And Restore" },
-	{ libfwsi_control_panel_item_identifier_backup_and_restore_center,
-	  "Backup and Restore Center" },
-	{ libfwsi_control_panel_item_identifier_biometrics,
-	  "Biometrics" },
-	{ libfwsi_control_panel_item_identifier_cardspace,
-	  "CardSpace" },
-	{ libfwsi_control_panel_item_identifier_color_management,
-	  "Color Management" },
-	{ libfwsi_control_panel_item_identifier_company_settings_sync,
-	  "Company Settings Sync" },
-	{ libfwsi_control_panel_item_identifier_credential_manager,
-	  "Credential Manager" },
-	{ libfwsi_control_panel_item_identifier_date_and_time,
-	  "Date and Time" },
-	{ libfwsi_control_panel_item_identifier_device_center,
-	  "Device Center" },
-	{ libfwsi_control_panel_item_identifier_device_manager,
-	  "Device Manager" },
-	{ libfwsi_control_panel_item_identifier_dialup_networking,
-	  "Dial-Up Networking" },
-	{ libfwsi_control_panel_item_identifier_display,
-	  "Display" },
-	{ libfwsi_control_panel_item_identifier_ease_of_access,
-	  "Ease of Access" },
 	{ libfwsi_control_panel_item_identifier_ecs,
 	  "ECS" },
-	{ libfwsi_control_panel_item_identifier_folder_options,
-	  "Folder Options" },
-	{ libfwsi_control_panel_item_identifier_font_folder,
-	  "Font Folder" },
-	{ libfwsi_control_panel_item_identifier_fonts,
-	  "Fonts" },
-	{ libfwsi_control_panel_item_identifier_get_programs_online,
-	  "Get Programs Online" },
-	{ libfwsi_control_panel_item_identifier_history_vault,
-	  "History Vault" },
-	{ libfwsi_control_panel_item_identifier_homegroup_control_panel,
-	  "HomeGroup Control Panel" },
-	{ libfwsi_control_panel_item_identifier_indexing_options,
-	  "Indexing Options" },
-	{ libfwsi_control_panel_item_identifier_infrared,
-	  "Infrared" },
+	{ libfwsi_control_panel_item_identifier_secure_startup,
+	  "Secure Startup" },
+	{ libfwsi_control_panel_item_identifier_view_available_networks,
+	  "View Available Networks" },
 	{ libfwsi_control_panel_item_identifier_install_new_programs,
 	  "Install New Programs" },
-	{ libfwsi_control_panel_item_identifier_internet_options,
-	  "Internet Options" },
-	{ libfwsi_control_panel_item_identifier_iscsi_initiator,
-	  "iSCSI Initiator" },
-	{ libfwsi_control_panel_item_identifier_keyboard,
-	  "Keyboard" },
-	{ libfwsi_control_panel_item_identifier_language_settings,
-	  "Language Settings" },
+	{ libfwsi_control_panel_item_identifier_windows_firewall,
+	  "Windows Firewall" },
+	{ libfwsi_control_panel_item_identifier_scanners_and_cameras,
+	  "Scanners & Cameras" },
+	{ libfwsi_control_panel_item_identifier_power_options,
+	  "Power Options" },
+	{ libfwsi_control_panel_item_identifier_indexing_options,
+	  "Indexing Options" },
+	{ libfwsi_control_panel_item_identifier_speech_recognition,
+	  "Speech Recognition" },
 	{ libfwsi_control_panel_item_identifier_mobility_center,
 	  "Mobility Center" },
-	{ libfwsi_control_panel_item_identifier_mouse,
-	  "Mouse" },
-	{ libfwsi_control_panel_item_identifier_network_and_sharing_center,
-	  "Network and Sharing Center" },
-	{ libfwsi_control_panel_item_identifier_network_connections,
-	  "Network Connections" },
-	{ libfwsi_control_panel_item_identifier_network_map,
-	  "Network Map" },
-	{ libfwsi_control_panel_item_identifier_parental_controls,
-	  "Parental Controls" },
-	{ libfwsi_control_panel_item_identifier_pen_and_touch,
-	  "Pen and Touch" },
+	{ libfwsi_control_panel_item_identifier_date_and_time,
+	  "Date and Time" },
+	{ libfwsi_control_panel_item_identifier_get_programs_online,
+	  "Get Programs Online" },
+	{ libfwsi_control_panel_item_identifier_windows_sidebar_properties,
+	  "Windows Sidebar Properties" },
+	{ libfwsi_control_panel_item_identifier_homegroup_control_panel,
+	  "HomeGroup Control Panel" },
+	{ libfwsi_control_panel_item_identifier_sensors,
+	  "Sensors" },
+	{ libfwsi_control_panel_item_identifier_user_accounts,
+	  "User Accounts" },
+	{ libfwsi_control_panel_item_identifier_folder_options,
+	  "Folder Options" },
+	{ libfwsi_control_panel_item_identifier_ease_of_access,
+	  "Ease of Access" },
 	{ libfwsi_control_panel_item_identifier_performance_information_and_tools,
 	  "Performance Information and Tools" },
-	{ libfwsi_control_panel_item_identifier_personalization,
-	  "Personalization" },
-	{ libfwsi_control_panel_item_identifier_phone_and_modem,
-	  "Phone and Modem" },
-	{ libfwsi_control_panel_item_identifier_portable_media_devices,
-	  "Portable Media Devices" },
-	{ libfwsi_control_panel_item_identifier_portable_workspace_creator,
-	  "Portable Workspace Creator" },
-	{ libfwsi_control_panel_item_identifier_power_options,
-	  "Power Options" },
-	{ libfwsi_control_panel_item_identifier_printers,
-	  "Printers" },
-	{ libfwsi_control_panel_item_identifier_problem_reports_and_solutions,
-	  "Problem Reports and Solutions" },
+	{ libfwsi_control_panel_item_identifier_windows_sideshow,
+	  "Windows SideShow" },
+	{ libfwsi_control_panel_item_identifier_add_new_hardware,
+	  "Add New Hardware" },
+	{ libfwsi_control_panel_item_identifier_company_settings_sync,
+	  "Company Settings Sync" },
+	{ libfwsi_control_panel_item_identifier_history_vault,
+	  "History Vault" },
+	{ libfwsi_control_panel_item_identifier_device_center,
+	  "Device Center" },
 	{ libfwsi_control_panel_item_identifier_programs_and_features,
 	  "Programs and Features" },
-	{ libfwsi_control_panel_item_identifier_recovery,
-	  "Recovery" },
-	{ libfwsi_control_panel_item_identifier_region_and_language,
-	  "Region and Language" },
+	{ libfwsi_control_panel_item_identifier_text_to_speech,
+	  "Text to Speech" },
 	{ libfwsi_control_panel_item_identifier_scanner_and_camera_control_panel,
 	  "Scanner and Camera Control Panel" },
-	{ libfwsi_control_panel_item_identifier_scanners_and_cameras,
-	  "Scanners & Cameras" },
-	{ libfwsi_control_panel_item_identifier_scheduled_tasks,
-	  "Scheduled Tasks" },
-	{ libfwsi_control_panel_item_identifier_secure_startup,
-	  "Secure Startup" },
-	{ libfwsi_control_panel_item_identifier_sensors,
-	  "Sensors" },
-	{ libfwsi_control_panel_item_identifier_set_user_defaults,
-	  "Set User Defaults" },
+	{ libfwsi_control_panel_item_identifier_cardspace,
+	  "CardSpace" },
+	{ libfwsi_control_panel_item_identifier_printers,
+	  "Printers" },
+	{ libfwsi_control_panel_item_identifier_font_folder,
+	  "Font Folder" },
 	{ libfwsi_control_panel_item_identifier_sound,
 	  "Sound" },
-	{ libfwsi_control_panel_item_identifier_speech_recognition,
-	  "Speech Recognition" },
-	{ libfwsi_control_panel_item_identifier_storage_spaces,
-	  "Storage Spaces" },
-	{ libfwsi_control_panel_item_identifier_sync_center_folder,
-	  "Sync Center Folder" },
-	{ libfwsi_control_panel_item_identifier_system,
-	  "System" },
-	{ libfwsi_control_panel_item_identifier_tablet_pc_settings,
-	  "Tablet PC Settings" },
-	{ libfwsi_control_panel_item_identifier_taskbar_and_start_menu,
-	  "Taskbar and Start Menu" },
-	{ libfwsi_control_panel_item_identifier_taskbar_notification_icons_control_panel,
-	  "Taskbar Notification Icons Control Panel" },
-	{ libfwsi_control_panel_item_identifier_text_to_speech,
-	  "Text to Speech" },
-	{ libfwsi_control_panel_item_identifier_troubleshooting,
-	  "Troubleshooting" },
-	{ libfwsi_control_panel_item_identifier_user_accounts,
-	  "User Accounts" },
-	{ libfwsi_control_panel_item_identifier_view_available_networks,
-	  "View Available Networks" },
+	{ libfwsi_control_panel_item_identifier_parental_controls,
+	  "Parental Controls" },
+	{ libfwsi_control_panel_item_identifier_phone_and_modem,
+	  "Phone and Modem" },
+	{ libfwsi_control_panel_item_identifier_set_user_defaults,
+	  "Set User Defaults" },
+	{ libfwsi_control_panel_item_identifier_display,
+	  "Display" },
 	{ libfwsi_control_panel_item_identifier_welcome_center,
 	  "Welcome Center" },
-	{ libfwsi_control_panel_item_identifier_windows_anytime_upgrade,
-	  "Windows Anytime Upgrade" },
-	{ libfwsi_control_panel_item_identifier_windows_defender,
-	  "Windows Defender" },
-	{ libfwsi_control_panel_item_identifier_windows_firewall,
-	  "Windows Firewall" },
-	{ libfwsi_control_panel_item_identifier_windows_sidebar_properties,
-	  "Windows Sidebar Properties" },
-	{ libfwsi_control_panel_item_identifier_windows_sideshow,
-	  "Windows SideShow" },
-	{ libfwsi_control_panel_item_identifier_windows_update,
-	  "Windows Update" },
+	{ libfwsi_control_panel_item_identifier_scheduled_tasks,
+	  "Scheduled Tasks" },
+	{ libfwsi_control_panel_item_identifier_internet_options,
+	  "Internet Options" },
+	{ libfwsi_control_panel_item_identifier_troubleshooting,
+	  "Troubleshooting" },
 	{ libfwsi_control_panel_item_identifier_workspaces_center,
 	  "Workspaces Center" },
+	{ libfwsi_control_panel_item_identifier_iscsi_initiator,
+	  "iSCSI Initiator" },
+	{ libfwsi_control_panel_item_identifier_portable_workspace_creator,
+	  "Portable Workspace Creator" },
+	{ libfwsi_control_panel_item_identifier_dialup_networking,
+	  "Dial-Up Networking" },
 	{ libfwsi_control_panel_item_identifier_x86_control_panel,
 	  "x86 Control Panel" },
+	{ libfwsi_control_panel_item_identifier_action_center_cpl,
+	  "Action Center CPL" },
+	{ libfwsi_control_panel_item_identifier_taskbar_and_start_menu,
+	  "Taskbar and Start Menu" },
+	{ libfwsi_control_panel_item_identifier_problem_reports_and_solutions,
+	  "Problem Reports and Solutions" },
+	{ libfwsi_control_panel_item_identifier_portable_media_devices,
+	  "Portable Media Devices" },
+	{ libfwsi_control_panel_item_identifier_windows_defender,
+	  "Windows Defender" },
+	{ libfwsi_control_panel_item_identifier_color_management,
+	  "Color Management" },
+	{ libfwsi_control_panel_item_identifier_network_connections,
+	  "Network Connections" },
+	{ libfwsi_control_panel_item_identifier_language_settings,
+	  "Language Settings" },
+	{ libfwsi_control_panel_item_identifier_network_and_sharing_center,
+	  "Network and Sharing Center" },
+	{ libfwsi_control_panel_item_identifier_biometrics,
+	  "Biometrics" },
+	{ libfwsi_control_panel_item_identifier_tablet_pc_settings,
+	  "Tablet PC Settings" },
+	{ libfwsi_control_panel_item_identifier_personalization,
+	  "Personalization" },
+	{ libfwsi_control_panel_item_identifier_windows_update,
+	  "Windows Update" },
+	{ libfwsi_control_panel_item_identifier_backup_and_restore_center,
+	  "Backup and Restore Center" },
+	{ libfwsi_control_panel_item_identifier_fonts,
+	  "Fonts" },
+	{ libfwsi_control_panel_item_identifier_administrative_tools,
+	  "Administrative Tools" },
+	{ libfwsi_control_panel_item_identifier_system,
+	  "System" },
+	{ libfwsi_control_panel_item_identifier_sync_center_folder,
+	  "Sync Center Folder" },
+	{ libfwsi_control_panel_item_identifier_backup_and_restore,
+	  "Backup And Restore" },
+	{ libfwsi_control_panel_item_identifier_credential_manager,
+	  "Credential Manager" },
+	{ libfwsi_control_panel_item_identifier_taskbar_notification_icons_control_panel,
+	  "Taskbar Notification Icons Control Panel" },
+	{ libfwsi_control_panel_item_identifier_keyboard,
+	  "Keyboard" },
+	{ libfwsi_control_panel_item_identifier_pen_and_touch,
+	  "Pen and Touch" },
+	{ libfwsi_control_panel_item_identifier_device_manager,
+	  "Device Manager" },
+	{ libfwsi_control_panel_item_identifier_recovery,
+	  "Recovery" },
 
 	{ libfwsi_control_panel_item_identifier_unknown,
 	  "Unknown" } };
 
+/* Retrieves the number of definitions, excluding the unknown identifier terminator
+ * Returns the number of definitions
+ */
+int libfwsi_control_panel_item_identifier_get_number_of_definitions(
+     void )
+{
+	return( (int) ( sizeof( libfwsi_control_panel_item_identifier_definitions ) / sizeof( libfwsi_control_panel_item_identifier_definition_t ) ) - 1 );
+}
+
+/* Retrieves the index of the definition of a control panel item identifier
+ * Returns the index if found or -1 if not
+ */
+int libfwsi_control_panel_item_identifier_get_definition_index(
+     const uint8_t *control_panel_item_identifier )
+{
+	const libfwsi_control_panel_item_identifier_definition_t *definition = NULL;
+	size_t number_of_definitions                                         = 0;
+	size_t half_number_of_definitions                                    = 0;
+	uint64_t identifier_lower                                            = 0;
+	uint64_t identifier_upper                                            = 0;
+	uint64_t value_64bit                                                 = 0;
+
+	if( control_panel_item_identifier == NULL )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 control_panel_item_identifier,
+	 identifier_upper );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( control_panel_item_identifier[ 8 ] ),
+	 identifier_lower );
+
+	definition            = libfwsi_control_panel_item_identifier_definitions;
+	number_of_definitions = ( sizeof( libfwsi_control_panel_item_identifier_definitions ) / sizeof( libfwsi_control_panel_item_identifier_definition_t ) ) - 1;
+
+	/* Binary search the sorted definitions, the comparison only selects the next definition
+	 * so that the compiler can use a conditional move instead of a branch
+	 */
+	while( number_of_definitions > 1 )
+	{
+		half_number_of_definitions = number_of_definitions / 2;
+
+		byte_stream_copy_to_uint64_big_endian(
+		 definition[ half_number_of_definitions ].identifier,
+		 value_64bit );
+
+		if( value_64bit == identifier_upper )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( ( definition[ half_number_of_definitions ].identifier )[ 8 ] ),
+			 value_64bit );
+
+			definition = ( value_64bit <= identifier_lower ) ? &( definition[ half_number_of_definitions ] ) : definition;
+		}
+		else
+		{
+			definition = ( value_64bit < identifier_upper ) ? &( definition[ half_number_of_definitions ] ) : definition;
+		}
+		number_of_definitions -= half_number_of_definitions;
+	}
+	if( memory_compare(
+	     definition->identifier,
+	     control_panel_item_identifier,
+	     16 ) != 0 )
+	{
+		return( -1 );
+	}
+	return( (int) ( definition - libfwsi_control_panel_item_identifier_definitions ) );
+}
+
 /* Retrieves a string containing the name of the folder identifier
  */
 const char *libfwsi_control_panel_item_identifier_get_name(
              const uint8_t *control_panel_item_identifier )
 {
-	int iterator = 0;
+	int definition_index = 0;
 
 	if( control_panel_item_identifier == NULL )
 	{
 		return( "Invalid control panel item identifier" );
 	}
-	while( memory_compare(
-	        ( libfwsi_control_panel_item_identifier_definitions[ iterator ] ).identifier,
-	        libfwsi_control_panel_item_identifier_unknown,
-	        16 ) != 0 )
+	definition_index = libfwsi_control_panel_item_identifier_get_definition_index(
+	                    control_panel_item_identifier );
+
+	if( definition_index == -1 )
 	{
-		if( memory_compare(
-		     ( libfwsi_control_panel_item_identifier_definitions[ iterator ] ).identifier,
-		     control_panel_item_identifier,
-		     16 ) == 0 )
-		{
-			break;
-		}
-		iterator++;
+		definition_index = libfwsi_control_panel_item_identifier_get_number_of_definitions();
 	}
 	return(
-	 ( libfwsi_control_panel_item_identifier_definitions[ iterator ] ).name );
+	 ( libfwsi_control_panel_item_identifier_definitions[ definition_index ] ).name );
 }
 
@@ -126,6 +126,14 @@ extern uint8_t libfwsi_control_panel_item_identifier_x86_control_panel[ 16 ];
 
 extern uint8_t libfwsi_control_panel_item_identifier_unknown[ 16 ];
 
+extern libfwsi_control_panel_item_identifier_definition_t libfwsi_control_panel_item_identifier_definitions[ ];
+
+int libfwsi_control_panel_item_identifier_get_number_of_definitions(
+     void );
+
+int libfwsi_control_panel_item_identifier_get_definition_index(
+     const uint8_t *control_panel_item_identifier );
+
 LIBFWSI_EXTERN \
 const char *libfwsi_control_panel_item_identifier_get_name(
              const uint8_t *control_panel_item_identifier );
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block.h"
 #include "libfwsi_extension_block_0xbeef0000_values.h"
@@ -42,6 +43,7 @@
 #include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_types.h"
 
 /* Creates an extension block
@@ -52,10 +54,39 @@ int libfwsi_extension_block_initialize(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error )
 {
-	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
-	static char *function                                        = "libfwsi_extension_block_initialize";
+	static char *function = "libfwsi_extension_block_initialize";
 
-	if( extension_block == NULL )
+	if( libfwsi_internal_extension_block_initialize(
+	     (libfwsi_internal_extension_block_t **) extension_block,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extension block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an extension block
+ * Make sure the value internal_extension_block is referencing, is set to NULL
+ * If an arena is provided the extension block is allocated from the arena and
+ * is freed together with the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_extension_block_initialize(
+     libfwsi_internal_extension_block_t **internal_extension_block,
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_extension_block_initialize";
+
+	if( internal_extension_block == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -66,7 +97,7 @@ int libfwsi_extension_block_initialize(
 
 		return( -1 );
 	}
-	if( *extension_block != NULL )
+	if( *internal_extension_block != NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -77,22 +108,43 @@ int libfwsi_extension_block_initialize(
 
 		return( -1 );
 	}
-	internal_extension_block = memory_allocate_structure(
-	                            libfwsi_internal_extension_block_t );
+	if( arena != NULL )
+	{
+		if( libfwsi_arena_allocate(
+		     arena,
+		     sizeof( libfwsi_internal_extension_block_t ),
+		     (uint8_t **) internal_extension_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate extension block from arena.",
+			 function );
 
-	if( internal_extension_block == NULL )
+			return( -1 );
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create extension block.",
-		 function );
+		*internal_extension_block = memory_allocate_structure(
+		                             libfwsi_internal_extension_block_t );
 
-		goto on_error;
+		if( *internal_extension_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extension block.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
-	     internal_extension_block,
+	     *internal_extension_block,
 	     0,
 	     sizeof( libfwsi_internal_extension_block_t ) ) == NULL )
 	{
@@ -103,18 +155,28 @@ int libfwsi_extension_block_initialize(
 		 "%s: unable to clear extension block.",
 		 function );
 
-		goto on_error;
+		if( arena == NULL )
+		{
+			memory_free(
+			 *internal_extension_block );
+		}
+		*internal_extension_block = NULL;
+
+		return( -1 );
 	}
-	*extension_block = (libfwsi_extension_block_t *) internal_extension_block;
+	( *internal_extension_block )->arena = arena;
 
 	return( 1 );
 
 on_error:
-	if( internal_extension_block != NULL )
+	if( ( *internal_extension_block != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
-		 internal_extension_block );
+		 *internal_extension_block );
 	}
+	*internal_extension_block = NULL;
+
 	return( -1 );
 }
 
@@ -187,33 +249,48 @@ int libfwsi_internal_extension_block_free(
 				}
 			}
 		}
-		memory_free(
-		 *internal_extension_block );
+		if( libfwsi_string_cache_clear(
+		     &( ( *internal_extension_block )->string_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear string cache.",
+			 function );
 
+			result = -1;
+		}
+		/* Extension blocks allocated from an arena are freed together with the arena
+		 */
+		if( ( *internal_extension_block )->arena == NULL )
+		{
+			memory_free(
+			 *internal_extension_block );
+		}
 		*internal_extension_block = NULL;
 	}
 	return( result );
 }
 
-/* Copies a shell extension block from a byte stream
- * Returns 1 if successful, 0 if not able to read or -1 on error
+/* Creates the extension block value
+ * If the extension block is backed by an arena the value is allocated from the arena,
+ * otherwise initialize_value is used and free_value is set as the free function
+ * Returns 1 if successful or -1 on error
  */
-int libfwsi_extension_block_copy_from_byte_stream(
+int libfwsi_internal_extension_block_initialize_value(
      libfwsi_internal_extension_block_t *internal_extension_block,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
-     int ascii_codepage,
+     size_t value_size,
+     int (*initialize_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
      libcerror_error_t **error )
 {
-	static char *function     = "libfwsi_extension_block_copy_from_byte_stream";
-	size_t byte_stream_offset = 0;
-	uint32_t signature        = 0;
-	uint16_t data_size        = 0;
-	int result                = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t value_16bit      = 0;
-#endif
+	static char *function = "libfwsi_internal_extension_block_initialize_value";
 
 	if( internal_extension_block == NULL )
 	{
@@ -226,6 +303,98 @@ int libfwsi_extension_block_copy_from_byte_stream(
 
 		return( -1 );
 	}
+	if( internal_extension_block->value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extension block - value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialize_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialize value function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->arena != NULL )
+	{
+		if( libfwsi_arena_allocate(
+		     internal_extension_block->arena,
+		     value_size,
+		     (uint8_t **) &( internal_extension_block->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate value from arena.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     internal_extension_block->value,
+		     0,
+		     value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value.",
+			 function );
+
+			internal_extension_block->value = NULL;
+
+			return( -1 );
+		}
+		internal_extension_block->free_value = NULL;
+	}
+	else
+	{
+		internal_extension_block->free_value = free_value;
+
+		if( initialize_value(
+		     &( internal_extension_block->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the header of a shell extension block from a byte stream
+ * A data size of 0 indicates the terminator, in which case data size is set to 2
+ * Returns 1 if successful, 0 if not able to read or -1 on error
+ */
+int libfwsi_extension_block_read_header(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint16_t *data_size,
+     uint16_t *version,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_extension_block_read_header";
+
 	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
@@ -248,6 +417,39 @@ int libfwsi_extension_block_copy_from_byte_stream(
 
 		return( -1 );
 	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
 	/* Do not try to parse unsupported byte stream sizes
 	 */
 	if( byte_stream_size < 2 )
@@ -256,17 +458,19 @@ int libfwsi_extension_block_copy_from_byte_stream(
 	}
 	byte_stream_copy_to_uint16_little_endian(
 	 byte_stream,
-	 data_size );
+	 *data_size );
 
-	if( data_size == 0 )
+	if( *data_size == 0 )
 	{
-		internal_extension_block->data_size = 2;
+		*data_size = 2;
+		*version   = 0;
+		*signature = 0;
 
 		return( 1 );
 	}
 	/* Do not try to parse unsupported extension block sizes
 	 */
-	if( data_size < 10 )
+	if( *data_size < 10 )
 	{
 		return( 0 );
 	}
@@ -278,17 +482,17 @@ int libfwsi_extension_block_copy_from_byte_stream(
 	}
 	byte_stream_copy_to_uint32_little_endian(
 	 &( byte_stream[ 4 ] ),
-	 signature );
+	 *signature );
 
 	/* Do not try to parse unsupported extension block signatures
 	 */
-	if( ( signature >> 16 ) != 0xbeef )
+	if( ( *signature >> 16 ) != 0xbeef )
 	{
 		return( 0 );
 	}
 	byte_stream_copy_to_uint16_little_endian(
 	 &( byte_stream[ 2 ] ),
-	 internal_extension_block->version );
+	 *version );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -296,21 +500,21 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		libcnotify_printf(
 		 "%s: size\t\t\t: %" PRIu16 "\n",
 		 function,
-		 data_size );
+		 *data_size );
 
 		libcnotify_printf(
 		 "%s: version\t\t\t: %" PRIu16 "\n",
 		 function,
-		 internal_extension_block->version );
+		 *version );
 
 		libcnotify_printf(
 		 "%s: signature\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 signature );
+		 *signature );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( (size_t) data_size > byte_stream_size )
+	if( (size_t) *data_size > byte_stream_size )
 	{
 		libcerror_error_set(
 		 error,
@@ -319,18 +523,107 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		 "%s: invalid extension block size value out of bounds.",
 		 function );
 
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a shell extension block from a byte stream
+ * The extension block values reference the byte stream
+ * Returns 1 if successful, 0 if not able to read or -1 on error
+ */
+int libfwsi_extension_block_copy_from_byte_stream(
+     libfwsi_internal_extension_block_t *internal_extension_block,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_extension_block_copy_from_byte_stream";
+	size_t byte_stream_offset = 0;
+	uint32_t signature        = 0;
+	uint16_t data_size        = 0;
+	int result                = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t value_16bit      = 0;
+#endif
+
+	if( internal_extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_extension_block_read_header(
+	          byte_stream,
+	          byte_stream_size,
+	          &data_size,
+	          &( internal_extension_block->version ),
+	          &signature,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extension block header.",
+		 function );
+
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	internal_extension_block->data      = byte_stream;
 	internal_extension_block->data_size = data_size;
+
+	/* The terminator has no signature
+	 */
+	if( signature == 0 )
+	{
+		return( 1 );
+	}
 	internal_extension_block->signature = signature;
 
 	switch( internal_extension_block->signature )
 	{
 		case 0xbeef0000UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_free;
-
-			if( libfwsi_extension_block_0xbeef0000_values_initialize(
-			     (libfwsi_extension_block_0xbeef0000_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0000_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -362,10 +655,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0001UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_free;
-
-			if( libfwsi_extension_block_0xbeef0001_values_initialize(
-			     (libfwsi_extension_block_0xbeef0001_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0001_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -397,10 +691,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0003UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_free;
-
-			if( libfwsi_extension_block_0xbeef0003_values_initialize(
-			     (libfwsi_extension_block_0xbeef0003_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0003_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -432,10 +727,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0004UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_free;
-
-			if( libfwsi_file_entry_extension_values_initialize(
-			     (libfwsi_file_entry_extension_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_file_entry_extension_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -468,10 +764,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0005UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_free;
-
-			if( libfwsi_extension_block_0xbeef0005_values_initialize(
-			     (libfwsi_extension_block_0xbeef0005_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0005_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -503,10 +800,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0006UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_free;
-
-			if( libfwsi_extension_block_0xbeef0006_values_initialize(
-			     (libfwsi_extension_block_0xbeef0006_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0006_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -538,10 +836,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef000aUL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef000a_values_free;
-
-			if( libfwsi_extension_block_0xbeef000a_values_initialize(
-			     (libfwsi_extension_block_0xbeef000a_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef000a_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef000a_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef000a_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -573,10 +872,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0013UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0013_values_free;
-
-			if( libfwsi_extension_block_0xbeef0013_values_initialize(
-			     (libfwsi_extension_block_0xbeef0013_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0013_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0013_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0013_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -608,10 +908,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0014UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_free;
-
-			if( libfwsi_extension_block_0xbeef0014_values_initialize(
-			     (libfwsi_extension_block_0xbeef0014_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0014_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -643,10 +944,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0019UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_free;
-
-			if( libfwsi_extension_block_0xbeef0019_values_initialize(
-			     (libfwsi_extension_block_0xbeef0019_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0019_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -678,10 +980,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0025UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_free;
-
-			if( libfwsi_extension_block_0xbeef0025_values_initialize(
-			     (libfwsi_extension_block_0xbeef0025_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0025_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -713,10 +1016,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0026UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0026_values_free;
-
-			if( libfwsi_extension_block_0xbeef0026_values_initialize(
-			     (libfwsi_extension_block_0xbeef0026_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0026_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0026_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0026_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -748,10 +1052,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0027UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0027_values_free;
-
-			if( libfwsi_extension_block_0xbeef0027_values_initialize(
-			     (libfwsi_extension_block_0xbeef0027_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0027_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0027_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0027_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -784,10 +1089,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			break;
 
 		case 0xbeef0029UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0029_values_free;
-
-			if( libfwsi_extension_block_0xbeef0029_values_initialize(
-			     (libfwsi_extension_block_0xbeef0029_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_internal_extension_block_initialize_value(
+			     internal_extension_block,
+			     sizeof( libfwsi_extension_block_0xbeef0029_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0029_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0029_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -970,3 +1276,69 @@ int libfwsi_extension_block_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the data
+ * The data includes the extension block header and references the item data,
+ * it is valid as long as the item is not freed, reset or reparsed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_extension_block_get_data(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_extension_block_get_data";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extension block - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = internal_extension_block->data;
+	*data_size = (size_t) internal_extension_block->data_size;
+
+	return( 1 );
+}
+
@@ -25,8 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_extern.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
@@ -49,6 +51,10 @@ struct libfwsi_internal_extension_block
 	 */
 	uint32_t signature;
 
+	/* The data, which references the item data
+	 */
+	const uint8_t *data;
+
 	/* The extension block value
 	 */
         intptr_t *value;
@@ -58,12 +64,29 @@ struct libfwsi_internal_extension_block
 	int (*free_value)(
 	       intptr_t **value,
 	       libcerror_error_t **error );
+
+	/* The next extension block of the item
+	 */
+	libfwsi_internal_extension_block_t *next_extension_block;
+
+	/* The arena the extension block is allocated from, NULL if allocated on the heap
+	 */
+	libfwsi_arena_t *arena;
+
+	/* The decoded string cache
+	 */
+	libfwsi_string_cache_t string_cache;
 };
 
 int libfwsi_extension_block_initialize(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error );
 
+int libfwsi_internal_extension_block_initialize(
+     libfwsi_internal_extension_block_t **internal_extension_block,
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_extension_block_free(
      libfwsi_extension_block_t **extension_block,
@@ -73,6 +96,25 @@ int libfwsi_internal_extension_block_free(
      libfwsi_internal_extension_block_t **internal_extension_block,
      libcerror_error_t **error );
 
+int libfwsi_internal_extension_block_initialize_value(
+     libfwsi_internal_extension_block_t *internal_extension_block,
+     size_t value_size,
+     int (*initialize_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libfwsi_extension_block_read_header(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint16_t *data_size,
+     uint16_t *version,
+     uint32_t *signature,
+     libcerror_error_t **error );
+
 int libfwsi_extension_block_copy_from_byte_stream(
      libfwsi_internal_extension_block_t *internal_extension_block,
      const uint8_t *byte_stream,
@@ -92,6 +134,13 @@ int libfwsi_extension_block_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_extension_block_get_data(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -30,6 +30,7 @@
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_scan.h"
 
 /* Creates extension block 0xbeef0006 values
  * Make sure the value extension_block_0xbeef0006_values is referencing, is set to NULL
@@ -199,19 +200,10 @@ int libfwsi_extension_block_0xbeef0006_values_read_data(
 	}
 	data_offset = 8;
 
-	for( string_size = data_offset;
-	     ( string_size + 1 ) < data_size - 2;
-	     string_size += 2 )
-	{
-		if( ( data[ string_size ] == 0 )
-		 && ( data[ string_size + 1 ] == 0 ) )
-		{
-			string_size += 2;
-
-			break;
-		}
-	}
-	string_size -= data_offset;
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               data_size - 2,
+	               data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -0,0 +1,346 @@
+/*
+ * FAT date time functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_fat_date_time.h"
+#include "libfwsi_libcerror.h"
+
+/* Determines the POSIX time of a FAT date time
+ * The FAT date time is stored in local time and no time zone is applied
+ * The lower 16 bits contain the date and the upper 16 bits the time
+ * The calculation uses no branches or lookup tables so that the batch
+ * conversion functions can be vectorized by the compiler
+ * Returns the number of seconds since 1970-01-01 00:00:00
+ * or 0 if the FAT date time is not set or invalid
+ */
+static int64_t libfwsi_fat_date_time_calculate_posix_time(
+                uint32_t fat_date_time )
+{
+	uint32_t day_of_month   = 0;
+	uint32_t days_in_month  = 0;
+	uint32_t hours          = 0;
+	uint32_t is_valid       = 0;
+	uint32_t minutes        = 0;
+	uint32_t month          = 0;
+	uint32_t number_of_days = 0;
+	uint32_t seconds        = 0;
+	uint32_t year           = 0;
+
+	/* The day of month is stored in the lower 5 bits
+	 * followed by 4 bits for the month and 7 bits for the year starting at 1980
+	 */
+	day_of_month = fat_date_time & 0x1f;
+	month        = ( fat_date_time >> 5 ) & 0x0f;
+	year         = ( ( fat_date_time >> 9 ) & 0x7f ) + 1980;
+
+	/* The number of seconds are stored in the lower 5 bits in intervals of 2 seconds
+	 * followed by 6 bits for the minutes and 5 bits for the hours
+	 */
+	seconds = ( ( fat_date_time >> 16 ) & 0x1f ) * 2;
+	minutes = ( fat_date_time >> 21 ) & 0x3f;
+	hours   = ( fat_date_time >> 27 ) & 0x1f;
+
+	/* Months 1, 3, 5, 7, 8, 10 and 12 have 31 days and February has 28 or 29 days,
+	 * where within the FAT date time range 1980 - 2107 only 2100 is a century year
+	 * that is not a leap year
+	 */
+	days_in_month = 30
+	              + ( ( month ^ ( month >> 3 ) ) & 1 )
+	              - ( ( month == 2 ) * ( 2 - ( ( ( year & 3 ) == 0 ) & ( year != 2100 ) ) ) );
+
+	is_valid = ( month >= 1 )
+	         & ( month <= 12 )
+	         & ( day_of_month >= 1 )
+	         & ( day_of_month <= days_in_month )
+	         & ( hours <= 23 )
+	         & ( minutes <= 59 )
+	         & ( seconds <= 59 );
+
+	/* Determine the number of days since 1970-01-01 using years that start in March,
+	 * which places the leap day at the end of the year. Within the years 1979 - 2107
+	 * the number of century years minus the number of 400 year periods is 15,
+	 * or 16 from 2100 onwards
+	 */
+	year -= ( month <= 2 );
+	month = month + 9 - ( 12 * ( month > 2 ) );
+
+	number_of_days = ( 365 * year )
+	               + ( year >> 2 )
+	               - ( year >= 2100 )
+	               + ( ( ( 153 * month ) + 2 ) / 5 )
+	               + day_of_month
+	               - 719484;
+
+	/* 86400 is 675 * 128, which keeps the multiplication within 32 bits
+	 */
+	return( ( ( (int64_t) ( number_of_days * 675 ) << 7 )
+	        + (int64_t) ( ( hours * 3600 ) + ( minutes * 60 ) + seconds ) )
+	      & -( (int64_t) is_valid ) );
+}
+
+/* Copies a FAT date time to a POSIX time
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if the FAT date time is not set or -1 on error
+ */
+int libfwsi_fat_date_time_copy_to_posix_time(
+     uint32_t fat_date_time,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwsi_fat_date_time_copy_to_posix_time";
+	int64_t safe_posix_time = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( fat_date_time == 0 )
+	{
+		return( 0 );
+	}
+	if( libfwsi_fat_date_times_copy_to_posix_times(
+	     &fat_date_time,
+	     1,
+	     &safe_posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FAT date time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_posix_time == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported FAT date time: 0x%08" PRIx32 ".",
+		 function,
+		 fat_date_time );
+
+		return( -1 );
+	}
+	*posix_time = safe_posix_time;
+
+	return( 1 );
+}
+
+/* Copies a FAT date time to a FILETIME
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if the FAT date time is not set or -1 on error
+ */
+int libfwsi_fat_date_time_copy_to_filetime(
+     uint32_t fat_date_time,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_fat_date_time_copy_to_filetime";
+	int64_t posix_time    = 0;
+	int result            = 0;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          fat_date_time,
+	          &posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FAT date time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*filetime = (uint64_t) ( posix_time + LIBFWSI_FAT_DATE_TIME_FILETIME_POSIX_EPOCH_DIFFERENCE )
+		          * LIBFWSI_FAT_DATE_TIME_FILETIME_INTERVALS_PER_SECOND;
+	}
+	return( result );
+}
+
+/* Copies FAT date times to POSIX times
+ * The FAT date times are stored in local time and no time zone is applied
+ * The POSIX time of a FAT date time that is not set or invalid is 0,
+ * which cannot be represented by a FAT date time
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_fat_date_times_copy_to_posix_times(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     int64_t *posix_times,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_fat_date_times_copy_to_posix_times";
+	size_t value_index    = 0;
+
+	if( fat_date_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > ( (size_t) SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX times.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		posix_times[ value_index ] = libfwsi_fat_date_time_calculate_posix_time(
+		                              fat_date_times[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Copies FAT date times to FILETIMEs
+ * The FAT date times are stored in local time and no time zone is applied
+ * The FILETIME of a FAT date time that is not set or invalid is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_fat_date_times_copy_to_filetimes(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     uint64_t *filetimes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_fat_date_times_copy_to_filetimes";
+	int64_t posix_time    = 0;
+	size_t value_index    = 0;
+
+	if( fat_date_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > ( (size_t) SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	/* The FILETIMEs are determined from the POSIX times in place, which keeps
+	 * the calculation of the POSIX time in a single vectorizable loop
+	 */
+	if( libfwsi_fat_date_times_copy_to_posix_times(
+	     fat_date_times,
+	     number_of_values,
+	     (int64_t *) filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FAT date times to POSIX times.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		posix_time = (int64_t) filetimes[ value_index ];
+
+		/* Keep the FILETIME 0 if the FAT date time is not set or invalid
+		 */
+		filetimes[ value_index ] = (uint64_t) ( ( posix_time + LIBFWSI_FAT_DATE_TIME_FILETIME_POSIX_EPOCH_DIFFERENCE )
+		                         * LIBFWSI_FAT_DATE_TIME_FILETIME_INTERVALS_PER_SECOND )
+		                         & -( (uint64_t) ( posix_time != 0 ) );
+	}
+	return( 1 );
+}
+
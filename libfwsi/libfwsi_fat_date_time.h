@@ -0,0 +1,74 @@
+/*
+ * FAT date time functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_FAT_DATE_TIME_H )
+#define _LIBFWSI_FAT_DATE_TIME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of seconds between 1601-01-01 and 1970-01-01
+ */
+#define LIBFWSI_FAT_DATE_TIME_FILETIME_POSIX_EPOCH_DIFFERENCE	11644473600LL
+
+/* The number of 100th nano seconds in a second
+ */
+#define LIBFWSI_FAT_DATE_TIME_FILETIME_INTERVALS_PER_SECOND	10000000LL
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_time_copy_to_posix_time(
+     uint32_t fat_date_time,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_time_copy_to_filetime(
+     uint32_t fat_date_time,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_times_copy_to_posix_times(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     int64_t *posix_times,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_times_copy_to_filetimes(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     uint64_t *filetimes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_FAT_DATE_TIME_H ) */
+
@@ -24,11 +24,13 @@
 
 #include "libfwsi_codepage.h"
 #include "libfwsi_definitions.h"
+#include "libfwsi_fat_date_time.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_file_entry.h"
 #include "libfwsi_file_entry_values.h"
 #include "libfwsi_item.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_cache.h"
 
 /* Retrieves the file size
  * Returns 1 if successful or -1 on error
@@ -66,6 +68,19 @@ int libfwsi_file_entry_get_file_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -132,6 +147,19 @@ int libfwsi_file_entry_get_modification_time(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -161,6 +189,98 @@ int libfwsi_file_entry_get_modification_time(
 	return( 1 );
 }
 
+/* Retrieves the modification time as a POSIX time
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libfwsi_file_entry_get_modification_time_as_posix_time(
+     libfwsi_item_t *file_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_file_entry_get_modification_time_as_posix_time";
+	uint32_t fat_date_time = 0;
+	int result             = 0;
+
+	if( libfwsi_file_entry_get_modification_time(
+	     file_entry,
+	     &fat_date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          fat_date_time,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy modification time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the modification time as a FILETIME
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libfwsi_file_entry_get_modification_time_as_filetime(
+     libfwsi_item_t *file_entry,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_file_entry_get_modification_time_as_filetime";
+	uint32_t fat_date_time = 0;
+	int result             = 0;
+
+	if( libfwsi_file_entry_get_modification_time(
+	     file_entry,
+	     &fat_date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fat_date_time,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy modification time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the file attribute flags
  * Returns 1 if successful or -1 on error
  */
@@ -197,6 +317,19 @@ int libfwsi_file_entry_get_file_attribute_flags(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -263,6 +396,19 @@ int libfwsi_file_entry_get_utf8_name_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_file_entry_values_get_utf8_name_size(
 	     (libfwsi_file_entry_values_t *) internal_item->value,
 	     utf8_string_size,
@@ -319,6 +465,19 @@ int libfwsi_file_entry_get_utf8_name(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_file_entry_values_get_utf8_name(
 	     (libfwsi_file_entry_values_t *) internal_item->value,
 	     utf8_string,
@@ -375,6 +534,19 @@ int libfwsi_file_entry_get_utf16_name_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_file_entry_values_get_utf16_name_size(
 	     (libfwsi_file_entry_values_t *) internal_item->value,
 	     utf16_string_size,
@@ -431,6 +603,19 @@ int libfwsi_file_entry_get_utf16_name(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfwsi_file_entry_values_get_utf16_name(
 	     (libfwsi_file_entry_values_t *) internal_item->value,
 	     utf16_string,
@@ -450,3 +635,131 @@ int libfwsi_file_entry_get_utf16_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted name
+ * The name is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_entry_get_cached_utf8_name(
+     libfwsi_item_t *file_entry,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_file_entry_get_cached_utf8_name";
+	int result                             = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file_entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) file_entry;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_NAME,
+	          (intptr_t *) file_entry,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_file_entry_get_utf8_name_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_file_entry_get_utf8_name,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted name
+ * The name is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_entry_get_cached_utf16_name(
+     libfwsi_item_t *file_entry,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_file_entry_get_cached_utf16_name";
+	int result                             = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file_entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) file_entry;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_NAME,
+	          (intptr_t *) file_entry,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_file_entry_get_utf16_name_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_file_entry_get_utf16_name,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
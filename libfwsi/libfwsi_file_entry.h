@@ -45,6 +45,18 @@ int libfwsi_file_entry_get_modification_time(
      uint32_t *fat_date_time,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_modification_time_as_posix_time(
+     libfwsi_item_t *file_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_modification_time_as_filetime(
+     libfwsi_item_t *file_entry,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_get_file_attribute_flags(
      libfwsi_item_t *file_entry,
@@ -77,6 +89,20 @@ int libfwsi_file_entry_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_cached_utf8_name(
+     libfwsi_item_t *file_entry,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_cached_utf16_name(
+     libfwsi_item_t *file_entry,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,10 +24,13 @@
 #include <types.h>
 
 #include "libfwsi_extension_block.h"
+#include "libfwsi_fat_date_time.h"
 #include "libfwsi_file_entry_extension.h"
 #include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_cache.h"
+#include "libfwsi_utf8_string.h"
 
 /* Retrieves the creation time
  * The returned time is a 32-bit version of a FAT date time value
@@ -161,6 +164,190 @@ int libfwsi_file_entry_extension_get_access_time(
 	return( 1 );
 }
 
+/* Retrieves the creation time as a POSIX time
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libfwsi_file_entry_extension_get_creation_time_as_posix_time(
+     libfwsi_extension_block_t *file_entry_extension,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_file_entry_extension_get_creation_time_as_posix_time";
+	uint32_t fat_date_time = 0;
+	int result             = 0;
+
+	if( libfwsi_file_entry_extension_get_creation_time(
+	     file_entry_extension,
+	     &fat_date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          fat_date_time,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy creation time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the creation time as a FILETIME
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libfwsi_file_entry_extension_get_creation_time_as_filetime(
+     libfwsi_extension_block_t *file_entry_extension,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_file_entry_extension_get_creation_time_as_filetime";
+	uint32_t fat_date_time = 0;
+	int result             = 0;
+
+	if( libfwsi_file_entry_extension_get_creation_time(
+	     file_entry_extension,
+	     &fat_date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fat_date_time,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy creation time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the access time as a POSIX time
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libfwsi_file_entry_extension_get_access_time_as_posix_time(
+     libfwsi_extension_block_t *file_entry_extension,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_file_entry_extension_get_access_time_as_posix_time";
+	uint32_t fat_date_time = 0;
+	int result             = 0;
+
+	if( libfwsi_file_entry_extension_get_access_time(
+	     file_entry_extension,
+	     &fat_date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          fat_date_time,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy access time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the access time as a FILETIME
+ * The FAT date time is stored in local time and no time zone is applied
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libfwsi_file_entry_extension_get_access_time_as_filetime(
+     libfwsi_extension_block_t *file_entry_extension,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_file_entry_extension_get_access_time_as_filetime";
+	uint32_t fat_date_time = 0;
+	int result             = 0;
+
+	if( libfwsi_file_entry_extension_get_access_time(
+	     file_entry_extension,
+	     &fat_date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fat_date_time,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy access time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the NTFS file reference
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -287,7 +474,7 @@ int libfwsi_file_entry_extension_get_utf8_long_name_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libfwsi_utf8_string_size_from_utf16_stream(
 	     file_entry_extension_values->long_name,
 	     file_entry_extension_values->long_name_size,
 	     LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -363,7 +550,7 @@ int libfwsi_file_entry_extension_get_utf8_long_name(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libfwsi_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     file_entry_extension_values->long_name,
@@ -535,6 +722,134 @@ int libfwsi_file_entry_extension_get_utf16_long_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted long name
+ * The long name is converted on first use and cached on the extension block, the string must not be freed
+ * and remains valid until the extension block is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_cached_utf8_long_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_file_entry_extension_get_cached_utf8_long_name";
+	int result                                                   = 0;
+
+	if( file_entry_extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry extension.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) file_entry_extension;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_extension_block->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_LONG_NAME,
+	          (intptr_t *) file_entry_extension,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf8_long_name_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf8_long_name,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted long name
+ * The long name is converted on first use and cached on the extension block, the string must not be freed
+ * and remains valid until the extension block is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_cached_utf16_long_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_file_entry_extension_get_cached_utf16_long_name";
+	int result                                                   = 0;
+
+	if( file_entry_extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry extension.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) file_entry_extension;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_extension_block->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_LONG_NAME,
+	          (intptr_t *) file_entry_extension,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf16_long_name_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf16_long_name,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 formatted localized name
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -592,7 +907,7 @@ int libfwsi_file_entry_extension_get_utf8_localized_name_size(
 	}
 	if( internal_extension_block->version >= 7 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = libfwsi_utf8_string_size_from_utf16_stream(
 		          file_entry_extension_values->localized_name,
 		          file_entry_extension_values->localized_name_size,
 		          LIBUNA_ENDIAN_LITTLE,
@@ -601,7 +916,7 @@ int libfwsi_file_entry_extension_get_utf8_localized_name_size(
 	}
 	else if( internal_extension_block->version >= 3 )
 	{
-		result = libuna_utf8_string_size_from_byte_stream(
+		result = libfwsi_utf8_string_size_from_byte_stream(
 		          file_entry_extension_values->localized_name,
 		          file_entry_extension_values->localized_name_size,
 		          file_entry_extension_values->ascii_codepage,
@@ -684,7 +999,7 @@ int libfwsi_file_entry_extension_get_utf8_localized_name(
 	}
 	if( internal_extension_block->version >= 7 )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = libfwsi_utf8_string_copy_from_utf16_stream(
 		          utf8_string,
 		          utf8_string_size,
 		          file_entry_extension_values->localized_name,
@@ -694,7 +1009,7 @@ int libfwsi_file_entry_extension_get_utf8_localized_name(
 	}
 	else if( internal_extension_block->version >= 3 )
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
+		result = libfwsi_utf8_string_copy_from_byte_stream(
 		          utf8_string,
 		          utf8_string_size,
 		          file_entry_extension_values->localized_name,
@@ -905,3 +1220,131 @@ int libfwsi_file_entry_extension_get_utf16_localized_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted localized name
+ * The localized name is converted on first use and cached on the extension block, the string must not be freed
+ * and remains valid until the extension block is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_file_entry_extension_get_cached_utf8_localized_name";
+	int result                                                   = 0;
+
+	if( file_entry_extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry extension.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) file_entry_extension;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_extension_block->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_LOCALIZED_NAME,
+	          (intptr_t *) file_entry_extension,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf8_localized_name_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf8_localized_name,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted localized name
+ * The localized name is converted on first use and cached on the extension block, the string must not be freed
+ * and remains valid until the extension block is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_cached_utf16_localized_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_file_entry_extension_get_cached_utf16_localized_name";
+	int result                                                   = 0;
+
+	if( file_entry_extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry extension.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) file_entry_extension;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_extension_block->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_LOCALIZED_NAME,
+	          (intptr_t *) file_entry_extension,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf16_localized_name_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_file_entry_extension_get_utf16_localized_name,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -45,6 +45,30 @@ int libfwsi_file_entry_extension_get_access_time(
      uint32_t *fat_date_time,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_creation_time_as_posix_time(
+     libfwsi_extension_block_t *file_entry_extension,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_creation_time_as_filetime(
+     libfwsi_extension_block_t *file_entry_extension,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_access_time_as_posix_time(
+     libfwsi_extension_block_t *file_entry_extension,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_access_time_as_filetime(
+     libfwsi_extension_block_t *file_entry_extension,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_extension_get_file_reference(
      libfwsi_extension_block_t *file_entry_extension,
@@ -77,6 +101,20 @@ int libfwsi_file_entry_extension_get_utf16_long_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_cached_utf8_long_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_cached_utf16_long_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_extension_get_utf8_localized_name_size(
      libfwsi_extension_block_t *file_entry_extension,
@@ -103,6 +141,20 @@ int libfwsi_file_entry_extension_get_utf16_localized_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_cached_utf16_localized_name(
+     libfwsi_extension_block_t *file_entry_extension,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
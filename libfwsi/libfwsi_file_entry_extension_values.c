@@ -31,6 +31,7 @@
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfdatetime.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_scan.h"
 
 /* Creates file entry extension values
  * Make sure the value file_entry_extension_values is referencing, is set to NULL
@@ -127,16 +128,6 @@ int libfwsi_file_entry_extension_values_free(
 	}
 	if( *file_entry_extension_values != NULL )
 	{
-		if( ( *file_entry_extension_values )->long_name != NULL )
-		{
-			memory_free(
-			 ( *file_entry_extension_values )->long_name );
-		}
-		if( ( *file_entry_extension_values )->localized_name != NULL )
-		{
-			memory_free(
-			 ( *file_entry_extension_values )->localized_name );
-		}
 		memory_free(
 		 *file_entry_extension_values );
 
@@ -425,22 +416,12 @@ int libfwsi_file_entry_extension_values_read_data(
 	}
 	/* Determine the long name size
 	 */
-	for( string_size = data_offset;
-	     ( string_size + 1 ) < data_size - 2;
-	     string_size += 2 )
-	{
-		if( ( data[ string_size ] == 0 )
-		 && ( data[ string_size + 1 ] == 0 ) )
-		{
-			string_size += 2;
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               data_size - 2,
+	               data_offset );
 
-			break;
-		}
-	}
-	string_size -= data_offset;
-
-	if( ( string_size == 0 )
-	 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( string_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -451,34 +432,7 @@ int libfwsi_file_entry_extension_values_read_data(
 
 		goto on_error;
 	}
-	file_entry_extension_values->long_name = (uint8_t *) memory_allocate(
-	                                                      sizeof( uint8_t ) * string_size );
-
-	if( file_entry_extension_values->long_name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create long name.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     file_entry_extension_values->long_name,
-	     &( data[ data_offset ] ),
-	     string_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy long name.",
-		 function );
-
-		goto on_error;
-	}
+	file_entry_extension_values->long_name = &( data[ data_offset ] );
 	file_entry_extension_values->long_name_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -518,22 +472,12 @@ int libfwsi_file_entry_extension_values_read_data(
 		{
 			/* Determine the localized name size
 			 */
-			for( string_size = data_offset;
-			     ( string_size + 1 ) < data_size - 2;
-			     string_size += 2 )
-			{
-				if( ( data[ string_size ] == 0 )
-				 && ( data[ string_size + 1 ] == 0 ) )
-				{
-					string_size += 2;
+			string_size = libfwsi_string_scan_get_utf16_string_size(
+			               data,
+			               data_size - 2,
+			               data_offset );
 
-					break;
-				}
-			}
-			string_size -= data_offset;
-
-			if( ( string_size == 0 )
-			 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			if( string_size == 0 )
 			{
 				libcerror_error_set(
 				 error,
@@ -544,34 +488,7 @@ int libfwsi_file_entry_extension_values_read_data(
 
 				goto on_error;
 			}
-			file_entry_extension_values->localized_name = (uint8_t *) memory_allocate(
-			                                                           sizeof( uint8_t ) * string_size );
-
-			if( file_entry_extension_values->localized_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create localized name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     file_entry_extension_values->localized_name,
-			     &( data[ data_offset ] ),
-			     string_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy localized name.",
-				 function );
-
-				goto on_error;
-			}
+			file_entry_extension_values->localized_name = &( data[ data_offset ] );
 			file_entry_extension_values->localized_name_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -601,21 +518,12 @@ int libfwsi_file_entry_extension_values_read_data(
 		{
 			/* Determine the localized name size
 			 */
-			for( string_size = data_offset;
-			     string_size < data_size - 2;
-			     string_size += 1 )
-			{
-				if( data[ string_size ] == 0 )
-				{
-					string_size += 1;
+			string_size = libfwsi_string_scan_get_byte_string_size(
+			               data,
+			               data_size - 2,
+			               data_offset );
 
-					break;
-				}
-			}
-			string_size -= data_offset;
-
-			if( ( string_size == 0 )
-			 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			if( string_size == 0 )
 			{
 				libcerror_error_set(
 				 error,
@@ -626,34 +534,7 @@ int libfwsi_file_entry_extension_values_read_data(
 
 				goto on_error;
 			}
-			file_entry_extension_values->localized_name = (uint8_t *) memory_allocate(
-			                                                           sizeof( uint8_t ) * string_size );
-
-			if( file_entry_extension_values->localized_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create localized name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     file_entry_extension_values->localized_name,
-			     &( data[ data_offset ] ),
-			     string_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy localized name.",
-				 function );
-
-				goto on_error;
-			}
+			file_entry_extension_values->localized_name = &( data[ data_offset ] );
 			file_entry_extension_values->localized_name_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -684,22 +565,10 @@ int libfwsi_file_entry_extension_values_read_data(
 	return( 1 );
 
 on_error:
-	if( file_entry_extension_values->localized_name != NULL )
-	{
-		memory_free(
-		 file_entry_extension_values->localized_name );
-
-		file_entry_extension_values->localized_name = NULL;
-	}
+	file_entry_extension_values->localized_name = NULL;
 	file_entry_extension_values->localized_name_size = 0;
 
-	if( file_entry_extension_values->long_name != NULL )
-	{
-		memory_free(
-		 file_entry_extension_values->long_name );
-
-		file_entry_extension_values->long_name = NULL;
-	}
+	file_entry_extension_values->long_name = NULL;
 	file_entry_extension_values->long_name_size = 0;
 
 	return( -1 );
@@ -50,7 +50,7 @@ struct libfwsi_file_entry_extension_values
 
 	/* The long name
 	 */
-	uint8_t *long_name;
+	const uint8_t *long_name;
 
 	/* The long name size
 	 */
@@ -58,7 +58,7 @@ struct libfwsi_file_entry_extension_values
 
 	/* The localized name
 	 */
-	uint8_t *localized_name;
+	const uint8_t *localized_name;
 
 	/* The localized name size
 	 */
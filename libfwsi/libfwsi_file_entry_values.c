@@ -34,7 +34,9 @@
 #include "libfwsi_libfguid.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string_scan.h"
 #include "libfwsi_unused.h"
+#include "libfwsi_utf8_string.h"
 
 /* Creates file entry values
  * Make sure the value file_entry_values is referencing, is set to NULL
@@ -131,11 +133,6 @@ int libfwsi_file_entry_values_free(
 	}
 	if( *file_entry_values != NULL )
 	{
-		if( ( *file_entry_values )->name != NULL )
-		{
-			memory_free(
-			 ( *file_entry_values )->name );
-		}
 		memory_free(
 		 *file_entry_values );
 
@@ -296,43 +293,27 @@ int libfwsi_file_entry_values_read_data(
 	{
 		file_entry_values->is_unicode = 0;
 	}
-	string_size = data_offset;
-
 	/* Determine the size of the primary name
 	 */
 	if( file_entry_values->is_unicode != 0 )
 	{
-		while( ( string_size + 1 ) < data_size )
-		{
-			if( ( data[ string_size ] == 0 )
-			 && ( data[ string_size + 1 ] == 0 ) )
-			{
-				string_size += 2;
+		string_size = libfwsi_string_scan_get_utf16_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
-				break;
-			}
-			string_size += 2;
-		}
-		string_size          -= data_offset;
 		string_alignment_size = 0;
 	}
 	else
 	{
-		while( string_size < data_size )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size++;
+		string_size = libfwsi_string_scan_get_byte_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
-				break;
-			}
-			string_size++;
-		}
-		string_size          -= data_offset;
 		string_alignment_size = string_size % 2;
 	}
-	if( ( string_size == 0 )
-	 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( string_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -343,34 +324,7 @@ int libfwsi_file_entry_values_read_data(
 
 		goto on_error;
 	}
-	file_entry_values->name = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * string_size );
-
-	if( file_entry_values->name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create name.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     file_entry_values->name,
-	     &( data[ data_offset ] ),
-	     string_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy name.",
-		 function );
-
-		goto on_error;
-	}
+	file_entry_values->name = &( data[ data_offset ] );
 	file_entry_values->name_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -440,38 +394,22 @@ int libfwsi_file_entry_values_read_data(
 	{
 		file_entry_values->in_pre_xp_format = 1;
 
-		string_size = data_offset;
-
 		/* Determine the size of the secondary name
 		 */
 		if( file_entry_values->is_unicode != 0 )
 		{
-			while( ( string_size + 1 ) < data_size )
-			{
-				if( ( data[ string_size ] == 0 )
-				 && ( data[ string_size + 1 ] == 0 ) )
-				{
-					string_size += 2;
-
-					break;
-				}
-				string_size += 2;
-			}
+			string_size = libfwsi_string_scan_get_utf16_string_size(
+			               data,
+			               data_size,
+			               data_offset );
 		}
 		else
 		{
-			while( string_size < data_size )
-			{
-				if( data[ string_size ] == 0 )
-				{
-					string_size++;
-
-					break;
-				}
-				string_size++;
-			}
+			string_size = libfwsi_string_scan_get_byte_string_size(
+			               data,
+			               data_size,
+			               data_offset );
 		}
-		string_size -= data_offset;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -659,13 +597,7 @@ int libfwsi_file_entry_values_read_data(
 	return( 1 );
 
 on_error:
-	if( file_entry_values->name != NULL )
-	{
-		memory_free(
-		 file_entry_values->name );
-
-		file_entry_values->name = NULL;
-	}
+	file_entry_values->name = NULL;
 	file_entry_values->name_size = 0;
 
 	return( -1 );
@@ -698,7 +630,7 @@ int libfwsi_file_entry_values_get_utf8_name_size(
 	}
 	if( file_entry_values->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = libfwsi_utf8_string_size_from_utf16_stream(
 			  file_entry_values->name,
 			  file_entry_values->name_size,
 			  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -707,7 +639,7 @@ int libfwsi_file_entry_values_get_utf8_name_size(
 	}
 	else
 	{
-		result = libuna_utf8_string_size_from_byte_stream(
+		result = libfwsi_utf8_string_size_from_byte_stream(
 			  file_entry_values->name,
 			  file_entry_values->name_size,
 		          ascii_codepage,
@@ -756,7 +688,7 @@ int libfwsi_file_entry_values_get_utf8_name(
 	}
 	if( file_entry_values->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = libfwsi_utf8_string_copy_from_utf16_stream(
 		          utf8_string,
 		          utf8_string_size,
 			  file_entry_values->name,
@@ -766,7 +698,7 @@ int libfwsi_file_entry_values_get_utf8_name(
 	}
 	else
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
+		result = libfwsi_utf8_string_copy_from_byte_stream(
 		          utf8_string,
 		          utf8_string_size,
 			  file_entry_values->name,
@@ -49,7 +49,7 @@ struct libfwsi_file_entry_values
 
 	/* The name
 	 */
-	uint8_t *name;
+	const uint8_t *name;
 
 	/* The name size
 	 */
@@ -0,0 +1,643 @@
+/*
+ * GUID registry functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfwsi_control_panel_item_identifier.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_guid_registry.h"
+#include "libfwsi_known_folder_identifier.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_shell_folder_identifier.h"
+
+/* Retrieves the GUID and name of a GUID registry identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_guid_registry_get_definition(
+     int registry_identifier,
+     uint8_t **guid_data,
+     const char **name,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_guid_registry_get_definition";
+	int definition_index  = 0;
+	uint8_t registry_type = 0;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	registry_type    = LIBFWSI_GUID_REGISTRY_IDENTIFIER_GET_TYPE( registry_identifier );
+	definition_index = LIBFWSI_GUID_REGISTRY_IDENTIFIER_GET_DEFINITION_INDEX( registry_identifier );
+
+	if( ( registry_identifier <= 0 )
+	 || ( definition_index < 0 ) )
+	{
+		registry_type = 0;
+	}
+	switch( registry_type )
+	{
+		case LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER:
+			if( definition_index < libfwsi_shell_folder_identifier_get_number_of_definitions() )
+			{
+				*guid_data = libfwsi_shell_folder_identifier_definitions[ definition_index ].identifier;
+				*name      = libfwsi_shell_folder_identifier_definitions[ definition_index ].name;
+
+				return( 1 );
+			}
+			break;
+
+		case LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER:
+			if( definition_index < libfwsi_known_folder_identifier_get_number_of_definitions() )
+			{
+				*guid_data = libfwsi_known_folder_identifier_definitions[ definition_index ].identifier;
+				*name      = libfwsi_known_folder_identifier_definitions[ definition_index ].name;
+
+				return( 1 );
+			}
+			break;
+
+		case LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM:
+			if( definition_index < libfwsi_control_panel_item_identifier_get_number_of_definitions() )
+			{
+				*guid_data = libfwsi_control_panel_item_identifier_definitions[ definition_index ].identifier;
+				*name      = libfwsi_control_panel_item_identifier_definitions[ definition_index ].name;
+
+				return( 1 );
+			}
+			break;
+
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid registry identifier value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Looks up a GUID in the registries
+ * The registries are searched in order: shell folder, known folder and control panel item
+ * If not NULL matching registry types is set to all registries that contain the GUID
+ * Returns the GUID registry identifier of the first registry that contains the GUID or 0 if not found
+ */
+int libfwsi_guid_registry_lookup_guid(
+     const uint8_t *guid_data,
+     uint8_t registry_types,
+     uint8_t *matching_registry_types )
+{
+	int definition_index    = 0;
+	int registry_identifier = 0;
+	uint8_t matching_types  = 0;
+
+	if( ( registry_types & LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER ) != 0 )
+	{
+		definition_index = libfwsi_shell_folder_identifier_get_definition_index(
+		                    guid_data );
+
+		if( definition_index != -1 )
+		{
+			registry_identifier = LIBFWSI_GUID_REGISTRY_IDENTIFIER(
+			                       LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER,
+			                       definition_index );
+
+			matching_types |= LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER;
+		}
+	}
+	/* The known folder and shell folder identifiers do not overlap
+	 */
+	if( ( ( registry_types & LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER ) != 0 )
+	 && ( registry_identifier == 0 ) )
+	{
+		definition_index = libfwsi_known_folder_identifier_get_definition_index(
+		                    guid_data );
+
+		if( definition_index != -1 )
+		{
+			registry_identifier = LIBFWSI_GUID_REGISTRY_IDENTIFIER(
+			                       LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER,
+			                       definition_index );
+
+			matching_types |= LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER;
+		}
+	}
+	if( ( ( registry_types & LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM ) != 0 )
+	 && ( ( registry_identifier == 0 )
+	  || ( matching_registry_types != NULL ) ) )
+	{
+		definition_index = libfwsi_control_panel_item_identifier_get_definition_index(
+		                    guid_data );
+
+		if( definition_index != -1 )
+		{
+			if( registry_identifier == 0 )
+			{
+				registry_identifier = LIBFWSI_GUID_REGISTRY_IDENTIFIER(
+				                       LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM,
+				                       definition_index );
+			}
+			matching_types |= LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM;
+		}
+	}
+	if( matching_registry_types != NULL )
+	{
+		*matching_registry_types = matching_types;
+	}
+	return( registry_identifier );
+}
+
+/* Retrieves the GUID registry identifier of a GUID
+ * The registries are searched in order: shell folder, known folder and control panel item
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfwsi_guid_registry_get_identifier(
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint8_t registry_types,
+     int *registry_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_guid_registry_get_identifier";
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: GUID data size too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*registry_identifier = libfwsi_guid_registry_lookup_guid(
+	                        guid_data,
+	                        registry_types,
+	                        NULL );
+
+	if( *registry_identifier == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the GUID registry identifier of a name
+ * The name is compared case-sensitive, if multiple definitions have the same name the first one is returned
+ * The registries are searched in order: shell folder, known folder and control panel item
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfwsi_guid_registry_get_identifier_by_name(
+     const char *name,
+     size_t name_length,
+     uint8_t registry_types,
+     int *registry_identifier,
+     libcerror_error_t **error )
+{
+	const char *definition_name = NULL;
+	static char *function       = "libfwsi_guid_registry_get_identifier_by_name";
+	int definition_index        = 0;
+	int number_of_definitions   = 0;
+	int registry_index          = 0;
+	uint8_t registry_type       = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*registry_identifier = 0;
+
+	for( registry_index = 0;
+	     registry_index < 3;
+	     registry_index++ )
+	{
+		registry_type = (uint8_t) ( 1 << registry_index );
+
+		if( ( registry_types & registry_type ) == 0 )
+		{
+			continue;
+		}
+		switch( registry_type )
+		{
+			case LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER:
+				number_of_definitions = libfwsi_shell_folder_identifier_get_number_of_definitions();
+				break;
+
+			case LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER:
+				number_of_definitions = libfwsi_known_folder_identifier_get_number_of_definitions();
+				break;
+
+			case LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM:
+				number_of_definitions = libfwsi_control_panel_item_identifier_get_number_of_definitions();
+				break;
+		}
+		for( definition_index = 0;
+		     definition_index < number_of_definitions;
+		     definition_index++ )
+		{
+			switch( registry_type )
+			{
+				case LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER:
+					definition_name = libfwsi_shell_folder_identifier_definitions[ definition_index ].name;
+					break;
+
+				case LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER:
+					definition_name = libfwsi_known_folder_identifier_definitions[ definition_index ].name;
+					break;
+
+				case LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM:
+					definition_name = libfwsi_control_panel_item_identifier_definitions[ definition_index ].name;
+					break;
+			}
+			if( narrow_string_length( definition_name ) != name_length )
+			{
+				continue;
+			}
+			if( narrow_string_compare(
+			     definition_name,
+			     name,
+			     name_length ) == 0 )
+			{
+				*registry_identifier = LIBFWSI_GUID_REGISTRY_IDENTIFIER(
+				                        registry_type,
+				                        definition_index );
+
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+/* Classifies a GUID
+ * Sets registry types to all registries that contain the GUID
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfwsi_guid_registry_classify(
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint8_t *registry_types,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_guid_registry_classify";
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: GUID data size too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry types.",
+		 function );
+
+		return( -1 );
+	}
+	libfwsi_guid_registry_lookup_guid(
+	 guid_data,
+	 LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	 registry_types );
+
+	if( *registry_types == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Classifies multiple GUIDs
+ * The GUIDs data contains consecutive 16-byte GUIDs, one registry identifier is set per GUID
+ * and is 0 if the GUID is not contained in the registries
+ * Returns the number of GUIDs found in the registries or -1 on error
+ */
+int libfwsi_guid_registry_classify_guids(
+     const uint8_t *guids_data,
+     size_t guids_data_size,
+     uint8_t registry_types,
+     int *registry_identifiers,
+     int number_of_registry_identifiers,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_guid_registry_classify_guids";
+	size_t guids_data_offset  = 0;
+	int guid_index            = 0;
+	int number_of_found_guids = 0;
+
+	if( guids_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUIDs data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guids_data_size > (size_t) SSIZE_MAX )
+	 || ( ( guids_data_size % 16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUIDs data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_registry_identifiers < 0 )
+	 || ( (size_t) number_of_registry_identifiers < ( guids_data_size / 16 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of registry identifiers value too small.",
+		 function );
+
+		return( -1 );
+	}
+	while( guids_data_offset < guids_data_size )
+	{
+		registry_identifiers[ guid_index ] = libfwsi_guid_registry_lookup_guid(
+		                                      &( guids_data[ guids_data_offset ] ),
+		                                      registry_types,
+		                                      NULL );
+
+		if( registry_identifiers[ guid_index ] != 0 )
+		{
+			number_of_found_guids++;
+		}
+		guids_data_offset += 16;
+		guid_index++;
+	}
+	return( number_of_found_guids );
+}
+
+/* Retrieves the registry type of a GUID registry identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_guid_registry_get_type(
+     int registry_identifier,
+     uint8_t *registry_type,
+     libcerror_error_t **error )
+{
+	const char *name      = NULL;
+	uint8_t *guid_data    = NULL;
+	static char *function = "libfwsi_guid_registry_get_type";
+
+	if( registry_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_guid_registry_get_definition(
+	     registry_identifier,
+	     &guid_data,
+	     &name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve definition.",
+		 function );
+
+		return( -1 );
+	}
+	*registry_type = LIBFWSI_GUID_REGISTRY_IDENTIFIER_GET_TYPE( registry_identifier );
+
+	return( 1 );
+}
+
+/* Retrieves the GUID of a GUID registry identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_guid_registry_get_guid(
+     int registry_identifier,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	const char *name         = NULL;
+	uint8_t *definition_guid = NULL;
+	static char *function    = "libfwsi_guid_registry_get_guid";
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: GUID data size too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_guid_registry_get_definition(
+	     registry_identifier,
+	     &definition_guid,
+	     &name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     definition_guid,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the name of a GUID registry identifier
+ * The name is a static string and must not be freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_guid_registry_get_name(
+     int registry_identifier,
+     const char **name,
+     libcerror_error_t **error )
+{
+	uint8_t *guid_data    = NULL;
+	static char *function = "libfwsi_guid_registry_get_name";
+
+	if( libfwsi_guid_registry_get_definition(
+	     registry_identifier,
+	     &guid_data,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve definition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
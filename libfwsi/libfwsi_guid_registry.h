@@ -0,0 +1,114 @@
+/*
+ * GUID registry functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_GUID_REGISTRY_H )
+#define _LIBFWSI_GUID_REGISTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A GUID registry identifier consists of the registry type in bits 16 - 23
+ * and the definition index + 1 in bits 0 - 15, 0 represents an unknown GUID
+ */
+#define LIBFWSI_GUID_REGISTRY_IDENTIFIER( registry_type, definition_index ) \
+	( ( (int) ( registry_type ) << 16 ) | ( ( definition_index ) + 1 ) )
+
+#define LIBFWSI_GUID_REGISTRY_IDENTIFIER_GET_TYPE( registry_identifier ) \
+	(uint8_t) ( ( ( registry_identifier ) >> 16 ) & 0xff )
+
+#define LIBFWSI_GUID_REGISTRY_IDENTIFIER_GET_DEFINITION_INDEX( registry_identifier ) \
+	( ( ( registry_identifier ) & 0xffff ) - 1 )
+
+int libfwsi_guid_registry_get_definition(
+     int registry_identifier,
+     uint8_t **guid_data,
+     const char **name,
+     libcerror_error_t **error );
+
+int libfwsi_guid_registry_lookup_guid(
+     const uint8_t *guid_data,
+     uint8_t registry_types,
+     uint8_t *matching_registry_types );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_get_identifier(
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint8_t registry_types,
+     int *registry_identifier,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_get_identifier_by_name(
+     const char *name,
+     size_t name_length,
+     uint8_t registry_types,
+     int *registry_identifier,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_classify(
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint8_t *registry_types,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_classify_guids(
+     const uint8_t *guids_data,
+     size_t guids_data_size,
+     uint8_t registry_types,
+     int *registry_identifiers,
+     int number_of_registry_identifiers,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_get_type(
+     int registry_identifier,
+     uint8_t *registry_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_get_guid(
+     int registry_identifier,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_guid_registry_get_name(
+     int registry_identifier,
+     const char **name,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_GUID_REGISTRY_H ) */
+
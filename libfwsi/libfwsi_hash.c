@@ -0,0 +1,395 @@
+/*
+ * Hash functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_hash.h"
+#include "libfwsi_libcerror.h"
+
+#define LIBFWSI_HASH_PRIME1	0x9e3779b185ebca87ULL
+#define LIBFWSI_HASH_PRIME2	0xc2b2ae3d27d4eb4fULL
+#define LIBFWSI_HASH_PRIME3	0x165667b19e3779f9ULL
+#define LIBFWSI_HASH_PRIME4	0x85ebca77c2b2ae63ULL
+#define LIBFWSI_HASH_PRIME5	0x27d4eb2f165667c5ULL
+
+#define libfwsi_hash_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+#define libfwsi_hash_round( accumulator, value ) \
+	accumulator += ( value ) * LIBFWSI_HASH_PRIME2; \
+	accumulator  = libfwsi_hash_rotate_left( accumulator, 31 ); \
+	accumulator *= LIBFWSI_HASH_PRIME1;
+
+/* Clears a hash context so it can be used to calculate a new hash
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_hash_context_clear(
+     libfwsi_hash_context_t *hash_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_hash_context_clear";
+
+	if( hash_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash context.",
+		 function );
+
+		return( -1 );
+	}
+	hash_context->accumulators[ 0 ] = LIBFWSI_HASH_PRIME1 + LIBFWSI_HASH_PRIME2;
+	hash_context->accumulators[ 1 ] = LIBFWSI_HASH_PRIME2;
+	hash_context->accumulators[ 2 ] = 0;
+	hash_context->accumulators[ 3 ] = (uint64_t) 0 - LIBFWSI_HASH_PRIME1;
+	hash_context->buffer_size       = 0;
+	hash_context->data_size         = 0;
+
+	return( 1 );
+}
+
+/* Updates a hash context with data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_hash_context_update(
+     libfwsi_hash_context_t *hash_context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_hash_context_update";
+	size_t copy_size      = 0;
+	size_t data_offset    = 0;
+	uint64_t value_64bit  = 0;
+	int stripe_index      = 0;
+
+	if( hash_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_context->buffer_size >= 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash context - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hash_context->data_size += (uint64_t) data_size;
+
+	/* Complete a partially filled stripe first
+	 */
+	if( hash_context->buffer_size > 0 )
+	{
+		copy_size = 32 - hash_context->buffer_size;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		if( memory_copy(
+		     &( hash_context->buffer[ hash_context->buffer_size ] ),
+		     data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		hash_context->buffer_size += copy_size;
+		data_offset                = copy_size;
+
+		if( hash_context->buffer_size < 32 )
+		{
+			return( 1 );
+		}
+		for( stripe_index = 0;
+		     stripe_index < 4;
+		     stripe_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( hash_context->buffer[ stripe_index * 8 ] ),
+			 value_64bit );
+
+			libfwsi_hash_round(
+			 hash_context->accumulators[ stripe_index ],
+			 value_64bit );
+		}
+		hash_context->buffer_size = 0;
+	}
+	while( ( data_size - data_offset ) >= 32 )
+	{
+		for( stripe_index = 0;
+		     stripe_index < 4;
+		     stripe_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			libfwsi_hash_round(
+			 hash_context->accumulators[ stripe_index ],
+			 value_64bit );
+
+			data_offset += 8;
+		}
+	}
+	if( data_offset < data_size )
+	{
+		if( memory_copy(
+		     hash_context->buffer,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		hash_context->buffer_size = data_size - data_offset;
+	}
+	return( 1 );
+}
+
+/* Finalizes a hash context
+ * The hash context must be cleared before it can be used again
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_hash_context_finalize(
+     libfwsi_hash_context_t *hash_context,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_hash_context_finalize";
+	size_t buffer_offset  = 0;
+	uint64_t safe_hash    = 0;
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	int stripe_index      = 0;
+
+	if( hash_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_context->buffer_size >= 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash context - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_context->data_size >= 32 )
+	{
+		safe_hash = libfwsi_hash_rotate_left( hash_context->accumulators[ 0 ], 1 )
+		          + libfwsi_hash_rotate_left( hash_context->accumulators[ 1 ], 7 )
+		          + libfwsi_hash_rotate_left( hash_context->accumulators[ 2 ], 12 )
+		          + libfwsi_hash_rotate_left( hash_context->accumulators[ 3 ], 18 );
+
+		for( stripe_index = 0;
+		     stripe_index < 4;
+		     stripe_index++ )
+		{
+			value_64bit = 0;
+
+			libfwsi_hash_round(
+			 value_64bit,
+			 hash_context->accumulators[ stripe_index ] );
+
+			safe_hash ^= value_64bit;
+			safe_hash  = ( safe_hash * LIBFWSI_HASH_PRIME1 ) + LIBFWSI_HASH_PRIME4;
+		}
+	}
+	else
+	{
+		safe_hash = LIBFWSI_HASH_PRIME5;
+	}
+	safe_hash += hash_context->data_size;
+
+	while( ( buffer_offset + 8 ) <= hash_context->buffer_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( hash_context->buffer[ buffer_offset ] ),
+		 value_64bit );
+
+		value_64bit *= LIBFWSI_HASH_PRIME2;
+		value_64bit  = libfwsi_hash_rotate_left( value_64bit, 31 );
+		value_64bit *= LIBFWSI_HASH_PRIME1;
+
+		safe_hash ^= value_64bit;
+		safe_hash  = ( libfwsi_hash_rotate_left( safe_hash, 27 ) * LIBFWSI_HASH_PRIME1 ) + LIBFWSI_HASH_PRIME4;
+
+		buffer_offset += 8;
+	}
+	if( ( buffer_offset + 4 ) <= hash_context->buffer_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( hash_context->buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		safe_hash ^= (uint64_t) value_32bit * LIBFWSI_HASH_PRIME1;
+		safe_hash  = ( libfwsi_hash_rotate_left( safe_hash, 23 ) * LIBFWSI_HASH_PRIME2 ) + LIBFWSI_HASH_PRIME3;
+
+		buffer_offset += 4;
+	}
+	while( buffer_offset < hash_context->buffer_size )
+	{
+		safe_hash ^= (uint64_t) hash_context->buffer[ buffer_offset ] * LIBFWSI_HASH_PRIME5;
+		safe_hash  = libfwsi_hash_rotate_left( safe_hash, 11 ) * LIBFWSI_HASH_PRIME1;
+
+		buffer_offset += 1;
+	}
+	safe_hash ^= safe_hash >> 33;
+	safe_hash *= LIBFWSI_HASH_PRIME2;
+	safe_hash ^= safe_hash >> 29;
+	safe_hash *= LIBFWSI_HASH_PRIME3;
+	safe_hash ^= safe_hash >> 32;
+
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the 64-bit hash of data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_hash_calculate(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libfwsi_hash_context_t hash_context;
+
+	static char *function = "libfwsi_hash_calculate";
+
+	if( libfwsi_hash_context_clear(
+	     &hash_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear hash context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_hash_context_update(
+	     &hash_context,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update hash context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_hash_context_finalize(
+	     &hash_context,
+	     hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize hash context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,83 @@
+/*
+ * Hash functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_HASH_H )
+#define _LIBFWSI_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_hash_context libfwsi_hash_context_t;
+
+/* The 64-bit hash is an xxHash64 hash with seed 0
+ */
+struct libfwsi_hash_context
+{
+	/* The accumulators
+	 */
+	uint64_t accumulators[ 4 ];
+
+	/* The buffer of data that does not fill a stripe
+	 */
+	uint8_t buffer[ 32 ];
+
+	/* The number of bytes in the buffer
+	 */
+	size_t buffer_size;
+
+	/* The total number of bytes hashed
+	 */
+	uint64_t data_size;
+};
+
+int libfwsi_hash_context_clear(
+     libfwsi_hash_context_t *hash_context,
+     libcerror_error_t **error );
+
+int libfwsi_hash_context_update(
+     libfwsi_hash_context_t *hash_context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwsi_hash_context_finalize(
+     libfwsi_hash_context_t *hash_context,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+int libfwsi_hash_calculate(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_HASH_H ) */
+
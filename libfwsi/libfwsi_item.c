@@ -25,19 +25,22 @@
 #include <types.h>
 
 #include "libfwsi_acronis_tib_file_values.h"
+#include "libfwsi_arena.h"
 #include "libfwsi_cdburn_values.h"
+#include "libfwsi_classifier.h"
 #include "libfwsi_compressed_folder_values.h"
 #include "libfwsi_codepage.h"
 #include "libfwsi_control_panel_category_values.h"
 #include "libfwsi_control_panel_cpl_file_values.h"
 #include "libfwsi_control_panel_item_values.h"
 #include "libfwsi_definitions.h"
-#include "libfwsi_delegate_folder_values.h"
 #include "libfwsi_extension_block.h"
 #include "libfwsi_file_attributes.h"
 #include "libfwsi_file_entry_values.h"
 #include "libfwsi_game_folder_values.h"
+#include "libfwsi_hash.h"
 #include "libfwsi_item.h"
+#include "libfwsi_item_cache.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
@@ -48,7 +51,7 @@
 #include "libfwsi_mtp_volume_values.h"
 #include "libfwsi_network_location_values.h"
 #include "libfwsi_root_folder_values.h"
-#include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_types.h"
 #include "libfwsi_uri_values.h"
 #include "libfwsi_uri_sub_values.h"
@@ -91,6 +94,7 @@ int libfwsi_item_initialize(
 	}
 	if( libfwsi_internal_item_initialize(
 	     &internal_item,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -109,10 +113,13 @@ int libfwsi_item_initialize(
 
 /* Creates an item
  * Make sure the value item is referencing, is set to NULL
+ * If an arena is provided the item is allocated from the arena and
+ * is freed together with the arena
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_internal_item_initialize(
      libfwsi_internal_item_t **internal_item,
+     libfwsi_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function = "libfwsi_internal_item_initialize";
@@ -139,19 +146,40 @@ int libfwsi_internal_item_initialize(
 
 		return( -1 );
 	}
-	*internal_item = memory_allocate_structure(
-	                  libfwsi_internal_item_t );
+	if( arena != NULL )
+	{
+		if( libfwsi_arena_allocate(
+		     arena,
+		     sizeof( libfwsi_internal_item_t ),
+		     (uint8_t **) internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate item from arena.",
+			 function );
 
-	if( *internal_item == NULL )
+			return( -1 );
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create item.",
-		 function );
+		*internal_item = memory_allocate_structure(
+		                  libfwsi_internal_item_t );
 
-		goto on_error;
+		if( *internal_item == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create item.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     *internal_item,
@@ -165,32 +193,28 @@ int libfwsi_internal_item_initialize(
 		 "%s: unable to clear item.",
 		 function );
 
-		goto on_error;
-	}
-	if( libcdata_array_initialize(
-	     &( ( *internal_item )->extension_blocks_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extension blocks array.",
-		 function );
+		if( arena == NULL )
+		{
+			memory_free(
+			 *internal_item );
+		}
+		*internal_item = NULL;
 
-		goto on_error;
+		return( -1 );
 	}
+	( *internal_item )->arena = arena;
+
 	return( 1 );
 
 on_error:
-	if( *internal_item != NULL )
+	if( ( *internal_item != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 *internal_item );
-
-		*internal_item = NULL;
 	}
+	*internal_item = NULL;
+
 	return( -1 );
 }
 
@@ -283,55 +307,60 @@ int libfwsi_internal_item_free(
 				}
 			}
 		}
-		if( libcdata_array_free(
-		     &( ( *internal_item )->extension_blocks_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_extension_block_free,
+		if( libfwsi_internal_item_free_extension_blocks(
+		     *internal_item,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free extension blocks array.",
+			 "%s: unable to free extension blocks.",
 			 function );
 
 			result = -1;
 		}
-		memory_free(
-		 *internal_item );
+		if( libfwsi_string_cache_clear(
+		     &( ( *internal_item )->string_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear string cache.",
+			 function );
 
+			result = -1;
+		}
+		if( ( *internal_item )->data_copy != NULL )
+		{
+			memory_free(
+			 ( *internal_item )->data_copy );
+		}
+		/* Items allocated from an arena are freed together with the arena
+		 */
+		if( ( *internal_item )->arena == NULL )
+		{
+			memory_free(
+			 *internal_item );
+		}
 		*internal_item = NULL;
 	}
 	return( result );
 }
 
-/* Copies a shell item from a byte stream
+/* Releases an item managed by an item list
+ * A shared item is released to the item cache that manages it, other items are freed
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_copy_from_byte_stream(
-     libfwsi_item_t *item,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
-     int ascii_codepage,
+int libfwsi_internal_item_release(
+     libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error )
 {
-	libfwsi_delegate_folder_values_t *delegate_folder_values = NULL;
-        libfwsi_internal_extension_block_t *extension_block      = NULL;
-	libfwsi_internal_item_t *internal_item                   = NULL;
-	libfwsi_internal_item_t *internal_parent_item            = NULL;
-	static char *function                                    = "libfwsi_item_copy_from_byte_stream";
-	const uint8_t *shell_item_data                           = NULL;
-	size_t byte_stream_offset                                = 0;
-	size_t delegate_class_identifier_offset                  = 0;
-	size_t delegate_shell_item_data_size                     = 0;
-	size_t shell_item_data_size                              = 0;
-	uint32_t signature                                       = 0;
-	uint16_t first_extension_block_offset                    = 0;
-	int entry_index                                          = 0;
-	int number_of_extension_blocks                           = 0;
-	int result                                               = 0;
+	static char *function = "libfwsi_internal_item_release";
 
-	if( item == NULL )
+	if( internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -342,400 +371,270 @@ int libfwsi_item_copy_from_byte_stream(
 
 		return( -1 );
 	}
-	internal_item = (libfwsi_internal_item_t *) item;
+	if( *internal_item == NULL )
+	{
+		return( 1 );
+	}
+	if( ( *internal_item )->item_cache != NULL )
+	{
+		if( libfwsi_internal_item_cache_release_item(
+		     (libfwsi_internal_item_cache_t *) ( *internal_item )->item_cache,
+		     *internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release shared item.",
+			 function );
 
-	if( byte_stream == NULL )
+			return( -1 );
+		}
+		*internal_item = NULL;
+	}
+	else if( libfwsi_internal_item_free(
+	          internal_item,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( byte_stream_size < 2 )
-	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	return( 1 );
+}
+
+/* Frees the extension blocks of an item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_free_extension_blocks(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_internal_item_free_extension_blocks";
+	int result                                                   = 1;
+
+	if( internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: byte stream size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	while( internal_item->first_extension_block != NULL )
+	{
+		internal_extension_block = internal_item->first_extension_block;
+
+		internal_item->first_extension_block = internal_extension_block->next_extension_block;
+
+		if( libfwsi_internal_extension_block_free(
+		     &internal_extension_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extension block.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_item->last_extension_block            = NULL;
+	internal_item->number_of_extension_blocks      = 0;
+	internal_item->extension_block_signatures_mask = 0;
+
+	return( result );
+}
+
+/* Resets an item so it can be reused to copy another shell item
+ * The data copy buffer is retained and only grows when needed
+ * Items that are managed by an item list or item list iterator cannot be reset
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_reset(
+     libfwsi_item_t *item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_reset";
+
+	if( item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint16_little_endian(
-	 byte_stream,
-	 internal_item->data_size );
+	internal_item = (libfwsi_internal_item_t *) item;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: size\t\t\t\t: %" PRIu16 "\n",
-		 function,
-		 internal_item->data_size );
-	}
-#endif
-	if( internal_item->data_size == 0 )
+	if( internal_item->is_managed != 0 )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item - item is managed by an item list or iterator.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( internal_item->data_size < 4 )
-	 || ( (size_t) internal_item->data_size > byte_stream_size ) )
+	if( libfwsi_internal_item_clear(
+	     internal_item,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid shell item size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear item.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	shell_item_data      = byte_stream;
-	shell_item_data_size = internal_item->data_size;
+	return( 1 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+/* Clears an item so it can be reused to read another shell item
+ * The arena, managed state, read/write lock and data copy buffer of the item are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_clear(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_t *arena                         = NULL;
+	uint8_t *data_copy                             = NULL;
+	static char *function                          = "libfwsi_internal_item_clear";
+	size_t data_copy_size                          = 0;
+	uint8_t is_managed                             = 0;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_t *read_write_lock = NULL;
+#endif
+
+	if( internal_item == NULL )
 	{
-		libcnotify_printf(
-		 "%s: data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
 		 function );
-		libcnotify_print_data(
-		 &( shell_item_data[ 2 ] ),
-		 shell_item_data_size - 2,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		return( -1 );
 	}
-#endif
-	if( shell_item_data_size >= 38 )
+	if( internal_item->value != NULL )
 	{
-		byte_stream_copy_to_uint16_little_endian(
-		 &( byte_stream[ internal_item->data_size - 2 ] ),
-		 delegate_class_identifier_offset );
-
-		if( ( delegate_class_identifier_offset >= 32 )
-		 && ( delegate_class_identifier_offset < ( shell_item_data_size - 2 ) ) )
-		{
-			delegate_shell_item_data_size = delegate_class_identifier_offset;
-		}
-		else
-		{
-			delegate_class_identifier_offset = shell_item_data_size;
-			delegate_shell_item_data_size    = shell_item_data_size;
-		}
-		delegate_class_identifier_offset -= 32;
-
-		if( memory_compare(
-		     &( shell_item_data[ delegate_class_identifier_offset ] ),
-		     libfwsi_delegate_class_identifier,
-		     16 ) == 0 )
+		if( internal_item->free_value != NULL )
 		{
-			if( libfwsi_delegate_folder_values_initialize(
-			     &delegate_folder_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create delegate folder values.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfwsi_delegate_folder_values_read_data(
-			     delegate_folder_values,
-			     shell_item_data,
-			     delegate_shell_item_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read delegate folder values.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     internal_item->delegate_folder_identifier,
-			     delegate_folder_values->identifier,
-			     16 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy delegate folder identifier.",
-				 function );
-
-				goto on_error;
-			}
-			internal_item->has_delegate_folder_identifier = 1;
-
-			if( memory_compare(
-			     delegate_folder_values->identifier,
-			     libfwsi_shell_folder_identifier_search_folder,
-			     16 ) == 0 )
-			{
-				/* Do not realign shell_item_data */
-			}
-			else if( memory_compare(
-			          delegate_folder_values->identifier,
-			          libfwsi_shell_folder_identifier_users_files_folder_delegate_folder,
-			          16 ) == 0 )
-			{
-/* TODO debug print unknown data */
-				shell_item_data      = &( delegate_folder_values->inner_data[ 4 ] );
-				shell_item_data_size = delegate_folder_values->inner_data_size - 4;
-			}
-			else if( memory_compare(
-			          delegate_folder_values->identifier,
-			          libfwsi_shell_folder_identifier_removable_drives,
-			          16 ) == 0 )
-			{
-/* TODO debug print unknown data */
-				shell_item_data      = &( delegate_folder_values->inner_data[ 4 ] );
-				shell_item_data_size = delegate_folder_values->inner_data_size - 4;
-			}
-			else
-			{
-				shell_item_data      = delegate_folder_values->inner_data;
-				shell_item_data_size = delegate_folder_values->inner_data_size;
-			}
-			if( libfwsi_delegate_folder_values_free(
-			     &delegate_folder_values,
+			if( internal_item->free_value(
+			     &( internal_item->value ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free delegate folder values.",
+				 "%s: unable to free item value.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
+		internal_item->value = NULL;
 	}
-	if( ( internal_item->type == 0 )
-	 && ( shell_item_data_size >= 6 ) )
+	if( libfwsi_internal_item_free_extension_blocks(
+	     internal_item,
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( shell_item_data[ 2 ] ),
-		 signature );
-
-		switch( signature )
-		{
-			case 0xacb16752UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_ACRONIS_TIB_FILE;
-				break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extension blocks.",
+		 function );
 
-			default:
-				break;
-		}
+		return( -1 );
 	}
-	if( ( internal_item->type == 0 )
-	 && ( shell_item_data_size >= 8 ) )
+	if( libfwsi_string_cache_clear(
+	     &( internal_item->string_cache ),
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( shell_item_data[ 4 ] ),
-		 signature );
-
-		switch( signature )
-		{
-			case 0x39de2184UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY;
-				break;
-
-			/* "AugM" */
-			case 0x4d677541UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CDBURN;
-				break;
-
-			/* "GFSI" */
-			case 0x49534647UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_GAME_FOLDER;
-				break;
-
-			case 0xc001b000UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_WEB_SITE;
-				break;
-
-			case 0xffffff38UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE;
-				break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear string cache.",
+		 function );
 
-			default:
-				break;
-		}
+		return( -1 );
 	}
-	if( ( internal_item->type == 0 )
-	 && ( shell_item_data_size >= 10 ) )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( shell_item_data[ 6 ] ),
-		 signature );
+	arena          = internal_item->arena;
+	data_copy      = internal_item->data_copy;
+	data_copy_size = internal_item->data_copy_size;
+	is_managed     = internal_item->is_managed;
 
-		switch( signature )
-		{
-			case 0x07192006UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY;
-				break;
-
-			case 0x10312005UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_MTP_VOLUME;
-				break;
-
-			case 0x10141981UL:
-			case 0x23a3dfd5UL:
-			case 0x23febbeeUL:
-			case 0x3b93afbbUL:
-			case 0x49505241UL:
-			case 0xbeebee00UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW;
-				break;
-
-			default:
-				break;
-		}
-	}
-	if( ( internal_item->type == 0 )
-	 && ( shell_item_data_size >= 56 ) )
-	{
-		if( ( shell_item_data[ 28 ] == (uint8_t) '/' )
-		 && ( shell_item_data[ 29 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 34 ] == (uint8_t) '/' )
-		 && ( shell_item_data[ 35 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 40 ] == (uint8_t) ' ' )
-		 && ( shell_item_data[ 41 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 42 ] == (uint8_t) ' ' )
-		 && ( shell_item_data[ 43 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 48 ] == (uint8_t) ':' )
-		 && ( shell_item_data[ 49 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 54 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 55 ] == (uint8_t) 0 ) )
-		{
-			internal_item->type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
-		}
-	}
-	if( ( internal_item->type == 0 )
-	 && ( shell_item_data_size >= 78 ) )
-	{
-		if( ( shell_item_data[ 36 ] == (uint8_t) 'N' )
-		 && ( shell_item_data[ 37 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 38 ] == (uint8_t) '/' )
-		 && ( shell_item_data[ 39 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 40 ] == (uint8_t) 'A' )
-		 && ( shell_item_data[ 41 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 42 ] == (uint8_t) 0 )
-		 && ( shell_item_data[ 43 ] == (uint8_t) 0 ) )
-		{
-			internal_item->type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
-		}
-		else if( ( shell_item_data[ 40 ] == (uint8_t) '/' )
-		      && ( shell_item_data[ 41 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 46 ] == (uint8_t) '/' )
-		      && ( shell_item_data[ 47 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 56 ] == (uint8_t) ' ' )
-		      && ( shell_item_data[ 57 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 58 ] == (uint8_t) ' ' )
-		      && ( shell_item_data[ 59 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 64 ] == (uint8_t) ':' )
-		      && ( shell_item_data[ 65 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 70 ] == (uint8_t) ':' )
-		      && ( shell_item_data[ 71 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 76 ] == (uint8_t) 0 )
-		      && ( shell_item_data[ 77 ] == (uint8_t) 0 ) )
-		{
-			internal_item->type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
-		}
-	}
-	if( ( internal_item->type == 0 )
-	 && ( shell_item_data_size >= 3 ) )
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	read_write_lock = internal_item->read_write_lock;
+#endif
+	if( memory_set(
+	     internal_item,
+	     0,
+	     sizeof( libfwsi_internal_item_t ) ) == NULL )
 	{
-		internal_item->class_type = shell_item_data[ 2 ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: class type indicator\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 internal_item->class_type );
-		}
+		return( -1 );
+	}
+	internal_item->arena          = arena;
+	internal_item->data_copy      = data_copy;
+	internal_item->data_copy_size = data_copy_size;
+	internal_item->is_managed     = is_managed;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	internal_item->read_write_lock              = read_write_lock;
+	internal_item->string_cache.read_write_lock = read_write_lock;
 #endif
-		switch( internal_item->class_type & 0x70 )
-		{
-			case 0x10:
-				if( internal_item->class_type == 0x1f )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_ROOT_FOLDER;
-				}
-				break;
-
-			case 0x20:
-				internal_item->type = LIBFWSI_ITEM_TYPE_VOLUME;
-				break;
-
-			case 0x30:
-				internal_item->type = LIBFWSI_ITEM_TYPE_FILE_ENTRY;
-				break;
-
-			case 0x40:
-				internal_item->type = LIBFWSI_ITEM_TYPE_NETWORK_LOCATION;
-				break;
-
-			case 0x60:
-				if( internal_item->class_type == 0x61 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_URI;
-				}
-				break;
+	return( 1 );
+}
 
-			case 0x70:
-				if( internal_item->class_type == 0x71 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_ITEM;
-				}
-				break;
+/* Copies a shell item from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_copy_from_byte_stream(
+     libfwsi_item_t *item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_parent_item = NULL;
+	static char *function                         = "libfwsi_item_copy_from_byte_stream";
+	int parent_item_type                          = LIBFWSI_ITEM_TYPE_UNKNOWN;
 
-			default:
-				break;
-		}
-	}
 	if( libfwsi_item_get_parent_item(
-	     (libfwsi_item_t *) internal_item,
+	     item,
 	     (libfwsi_item_t **) &internal_parent_item,
 	     error ) != 1 )
 	{
@@ -746,115 +645,1127 @@ int libfwsi_item_copy_from_byte_stream(
 		 "%s: unable to retrieve parent shell item.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( internal_parent_item != NULL )
 	{
-		switch( internal_parent_item->type )
-		{
-			case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
-				internal_item->type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
-				break;
-
-			case LIBFWSI_ITEM_TYPE_URI:
-				internal_item->type = LIBFWSI_ITEM_TYPE_URI_SUB_VALUES;
-				break;
-		}
+		parent_item_type = internal_parent_item->type;
 	}
-	switch( internal_item->type )
+	if( libfwsi_internal_item_copy_from_byte_stream(
+	     (libfwsi_internal_item_t *) item,
+	     byte_stream,
+	     byte_stream_size,
+	     parent_item_type,
+	     ascii_codepage,
+	     0,
+	     error ) != 1 )
 	{
-		case LIBFWSI_ITEM_TYPE_ACRONIS_TIB_FILE:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_acronis_tib_file_values_free;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to copy item from byte stream.",
+		 function );
 
-			if( libfwsi_acronis_tib_file_values_initialize(
-			     (libfwsi_acronis_tib_file_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create Acronis True Image (TIB) file values.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			result = libfwsi_acronis_tib_file_values_read_data(
-			          (libfwsi_acronis_tib_file_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          error );
+/* Copies a shell item from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_copy_from_byte_stream(
+     libfwsi_internal_item_t *internal_item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	uint8_t *data_copy    = NULL;
+	static char *function = "libfwsi_internal_item_copy_from_byte_stream";
+	uint16_t data_size    = 0;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read Acronis True Image (TIB) file values.",
-				 function );
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-				goto on_error;
-			}
-			break;
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
 
-		case LIBFWSI_ITEM_TYPE_CDBURN:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_free;
+		return( -1 );
+	}
+	if( ( byte_stream_size < 2 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item - data value already set.",
+		 function );
 
-			if( libfwsi_cdburn_values_initialize(
-			     (libfwsi_cdburn_values_t **) &( internal_item->value ),
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 data_size );
+
+	/* The item references its data hence keep a copy of the shell item data
+	 * an invalid size is handled when reading the byte stream
+	 * if the item is backed by an arena the copy is allocated from the arena
+	 */
+	if( ( data_size >= 4 )
+	 && ( (size_t) data_size <= byte_stream_size ) )
+	{
+		if( internal_item->arena != NULL )
+		{
+			if( libfwsi_arena_allocate(
+			     internal_item->arena,
+			     (size_t) data_size,
+			     &data_copy,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create CD burn values.",
+				 "%s: unable to allocate data copy from arena.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_cdburn_values_read_data(
-			          (libfwsi_cdburn_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          error );
-
-			if( result == -1 )
+		}
+		else
+		{
+			/* The data copy of a reset item is reused if it is large enough
+			 */
+			if( (size_t) data_size > internal_item->data_copy_size )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read CD burn values.",
-				 function );
+				data_copy = (uint8_t *) memory_reallocate(
+				                         internal_item->data_copy,
+				                         sizeof( uint8_t ) * data_size );
 
-				goto on_error;
+				if( data_copy == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize data copy.",
+					 function );
+
+					goto on_error;
+				}
+				internal_item->data_copy      = data_copy;
+				internal_item->data_copy_size = (size_t) data_size;
 			}
-			break;
+			data_copy = internal_item->data_copy;
+		}
+		if( memory_copy(
+		     data_copy,
+		     byte_stream,
+		     (size_t) data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
 
-		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_free;
+			goto on_error;
+		}
+		byte_stream      = data_copy;
+		byte_stream_size = (size_t) data_size;
+	}
+	if( libfwsi_internal_item_read_byte_stream(
+	     internal_item,
+	     byte_stream,
+	     byte_stream_size,
+	     parent_item_type,
+	     ascii_codepage,
+	     read_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read shell item.",
+		 function );
 
-			if( libfwsi_compressed_folder_values_initialize(
-			     (libfwsi_compressed_folder_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_item->data_copy != NULL )
+	{
+		memory_free(
+		 internal_item->data_copy );
+
+		internal_item->data_copy = NULL;
+	}
+	internal_item->data_copy_size = 0;
+
+	return( -1 );
+}
+
+/* Reads a shell item from a byte stream
+ * The item references the byte stream, which must remain available while the item is in use
+ * The parent item type is LIBFWSI_ITEM_TYPE_UNKNOWN if the item has no parent
+ * If LIBFWSI_PARSE_FLAG_DEFER_DECODING is set only the item type is determined
+ * and the item values are read on first access
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_read_byte_stream(
+     libfwsi_internal_item_t *internal_item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_classifier_result_t classifier_result;
+
+	static char *function = "libfwsi_internal_item_read_byte_stream";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 2 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_flags & ~( LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 internal_item->data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: size\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 internal_item->data_size );
+	}
+#endif
+	if( internal_item->data_size == 0 )
+	{
+		internal_item->is_decoded = 1;
+
+		return( 1 );
+	}
+	if( ( internal_item->data_size < 4 )
+	 || ( (size_t) internal_item->data_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shell item size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwsi_classifier_classify_data(
+	     byte_stream,
+	     (size_t) internal_item->data_size,
+	     parent_item_type,
+	     &classifier_result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to classify shell item.",
+		 function );
+
+		goto on_error;
+	}
+	if( classifier_result.has_delegate_folder_identifier != 0 )
+	{
+		if( memory_copy(
+		     internal_item->delegate_folder_identifier,
+		     classifier_result.delegate_folder_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy delegate folder identifier.",
+			 function );
+
+			goto on_error;
+		}
+		internal_item->has_delegate_folder_identifier = 1;
+	}
+	internal_item->type             = classifier_result.item_type;
+	internal_item->class_type       = classifier_result.class_type;
+	internal_item->signature        = classifier_result.signature;
+	internal_item->data             = byte_stream;
+	internal_item->values_data      = classifier_result.values_data;
+	internal_item->values_data_size = classifier_result.values_data_size;
+	internal_item->ascii_codepage   = ascii_codepage;
+
+	/* The item is not yet shared with other threads while it is being read
+	 * hence the values are decoded without locking
+	 */
+	if( ( read_flags & LIBFWSI_PARSE_FLAG_DEFER_DECODING ) == 0 )
+	{
+		if( libfwsi_internal_item_decode_values(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to decode item values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	internal_item->data             = NULL;
+	internal_item->values_data      = NULL;
+	internal_item->values_data_size = 0;
+
+	return( -1 );
+}
+
+/* Determines the item type of a shell item in a byte stream without reading the item values
+ * The parent item type should be LIBFWSI_ITEM_TYPE_UNKNOWN if the shell item has no parent
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_classify_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int *item_type,
+     libcerror_error_t **error )
+{
+	libfwsi_classifier_result_t classifier_result;
+
+	static char *function = "libfwsi_item_classify_byte_stream";
+	uint16_t data_size    = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 2 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item type.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 data_size );
+
+	if( data_size == 0 )
+	{
+		*item_type = LIBFWSI_ITEM_TYPE_UNKNOWN;
+
+		return( 1 );
+	}
+	if( ( data_size < 4 )
+	 || ( (size_t) data_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shell item size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_classifier_classify_data(
+	     byte_stream,
+	     (size_t) data_size,
+	     parent_item_type,
+	     &classifier_result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to classify shell item.",
+		 function );
+
+		return( -1 );
+	}
+	*item_type = classifier_result.item_type;
+
+	return( 1 );
+}
+
+/* Reads the item values and extension blocks
+ * The values are only read once, on subsequent calls this function does nothing
+ * If the item is managed by an item list the decoding is serialized by the
+ * read/write lock of the item list, so that deferred decoding is safe when
+ * the items of a parsed item list are accessed from multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_read_values(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_read_values";
+	int result            = 1;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	uint8_t is_decoded    = 0;
+#endif
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( internal_item->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		is_decoded = internal_item->is_decoded;
+
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		if( is_decoded != 0 )
+		{
+			return( 1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	/* Another thread could have decoded the values before the lock was grabbed for writing,
+	 * in which case decode values does nothing
+	 */
+	if( libfwsi_internal_item_decode_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to decode item values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( internal_item->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Decodes the item values and extension blocks
+ * The values are only decoded once, on subsequent calls this function does nothing
+ * The caller is responsible for serializing concurrent calls
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_decode_values(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *extension_block = NULL;
+	static char *function                               = "libfwsi_internal_item_decode_values";
+	const uint8_t *byte_stream                          = NULL;
+	const uint8_t *shell_item_data                      = NULL;
+	size_t byte_stream_offset                           = 0;
+	size_t shell_item_data_size                         = 0;
+	uint16_t first_extension_block_offset               = 0;
+	int number_of_extension_blocks                      = 0;
+	int result                                          = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->is_decoded != 0 )
+	{
+		return( 1 );
+	}
+	/* An item without data has no values to read
+	 */
+	if( internal_item->data == NULL )
+	{
+		return( 1 );
+	}
+	byte_stream          = internal_item->data;
+	shell_item_data      = internal_item->values_data;
+	shell_item_data_size = internal_item->values_data_size;
+
+	switch( internal_item->type )
+	{
+		case LIBFWSI_ITEM_TYPE_ACRONIS_TIB_FILE:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_acronis_tib_file_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_acronis_tib_file_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_acronis_tib_file_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create Acronis True Image (TIB) file values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_acronis_tib_file_values_read_data(
+			          (libfwsi_acronis_tib_file_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read Acronis True Image (TIB) file values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CDBURN:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_cdburn_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create CD burn values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_cdburn_values_read_data(
+			          (libfwsi_cdburn_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read CD burn values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_compressed_folder_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
 				 "%s: unable to create compressed folder values.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_compressed_folder_values_read_data(
-			          (libfwsi_compressed_folder_values_t *) internal_item->value,
+			result = libfwsi_compressed_folder_values_read_data(
+			          (libfwsi_compressed_folder_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed folder values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_ITEM:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_control_panel_item_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_item_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_item_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create control panel item values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_control_panel_item_values_read_data(
+			          (libfwsi_control_panel_item_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read control panel item values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_control_panel_category_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create control panel category values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_control_panel_category_values_read_data(
+			          (libfwsi_control_panel_category_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read control panel category values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_control_panel_cpl_file_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create control panel CPL file values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_control_panel_cpl_file_values_read_data(
+			          (libfwsi_control_panel_cpl_file_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read control panel CPL file values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_file_entry_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file entry values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_file_entry_values_read_data(
+			          (libfwsi_file_entry_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          internal_item->ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_GAME_FOLDER:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_game_folder_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create game folder values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_game_folder_values_read_data(
+			          (libfwsi_game_folder_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read game folder values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_mtp_file_entry_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create MTP file entry values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_mtp_file_entry_values_read_data(
+			          (libfwsi_mtp_file_entry_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read MTP file entry values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_MTP_VOLUME:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_mtp_volume_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create MTP volume values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_mtp_volume_values_read_data(
+			          (libfwsi_mtp_volume_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read MTP volume values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_network_location_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create network location values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_network_location_values_read_data(
+			          (libfwsi_network_location_values_t *) internal_item->value,
+			          shell_item_data,
+			          shell_item_data_size,
+			          internal_item->ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read network location values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_root_folder_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create root folder values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_root_folder_values_read_data(
+				  (libfwsi_root_folder_values_t *) internal_item->value,
+				  shell_item_data,
+				  shell_item_data_size,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read root folder values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_URI:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_uri_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create URI values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwsi_uri_values_read_data(
+			          (libfwsi_uri_values_t *) internal_item->value,
 			          shell_item_data,
 			          shell_item_data_size,
+			          internal_item->ascii_codepage,
 			          error );
 
 			if( result == -1 )
@@ -863,33 +1774,35 @@ int libfwsi_item_copy_from_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read compressed folder values.",
+				 "%s: unable to read URI values.",
 				 function );
 
 				goto on_error;
 			}
 			break;
 
-		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_ITEM:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_item_values_free;
-
-			if( libfwsi_control_panel_item_values_initialize(
-			     (libfwsi_control_panel_item_values_t **) &( internal_item->value ),
+		case LIBFWSI_ITEM_TYPE_URI_SUB_VALUES:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_uri_sub_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_sub_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_sub_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create control panel item values.",
+				 "%s: unable to create URI sub values.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_control_panel_item_values_read_data(
-			          (libfwsi_control_panel_item_values_t *) internal_item->value,
+			result = libfwsi_uri_sub_values_read_data(
+			          (libfwsi_uri_sub_values_t *) internal_item->value,
 			          shell_item_data,
 			          shell_item_data_size,
+			          internal_item->ascii_codepage,
 			          error );
 
 			if( result == -1 )
@@ -898,33 +1811,35 @@ int libfwsi_item_copy_from_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read control panel item values.",
+				 "%s: unable to read URI sub values.",
 				 function );
 
 				goto on_error;
 			}
 			break;
 
-		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_free;
-
-			if( libfwsi_control_panel_category_values_initialize(
-			     (libfwsi_control_panel_category_values_t **) &( internal_item->value ),
+		case LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_users_property_view_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create control panel category values.",
+				 "%s: unable to create users property view values.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_control_panel_category_values_read_data(
-			          (libfwsi_control_panel_category_values_t *) internal_item->value,
+			result = libfwsi_users_property_view_values_read_data(
+			          (libfwsi_users_property_view_values_t *) internal_item->value,
 			          shell_item_data,
 			          shell_item_data_size,
+			          internal_item->ascii_codepage,
 			          error );
 
 			if( result == -1 )
@@ -933,33 +1848,35 @@ int libfwsi_item_copy_from_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read control panel category values.",
+				 "%s: unable to read users property view values.",
 				 function );
 
 				goto on_error;
 			}
 			break;
 
-		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_free;
-
-			if( libfwsi_control_panel_cpl_file_values_initialize(
-			     (libfwsi_control_panel_cpl_file_values_t **) &( internal_item->value ),
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_volume_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create control panel CPL file values.",
+				 "%s: unable to create volume values.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_control_panel_cpl_file_values_read_data(
-			          (libfwsi_control_panel_cpl_file_values_t *) internal_item->value,
+			result = libfwsi_volume_values_read_data(
+			          (libfwsi_volume_values_t *) internal_item->value,
 			          shell_item_data,
 			          shell_item_data_size,
+			          internal_item->ascii_codepage,
 			          error );
 
 			if( result == -1 )
@@ -968,34 +1885,34 @@ int libfwsi_item_copy_from_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read control panel CPL file values.",
+				 "%s: unable to read volume values.",
 				 function );
 
 				goto on_error;
 			}
 			break;
 
-		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_free;
-
-			if( libfwsi_file_entry_values_initialize(
-			     (libfwsi_file_entry_values_t **) &( internal_item->value ),
+		case LIBFWSI_ITEM_TYPE_WEB_SITE:
+			if( libfwsi_internal_item_initialize_value(
+			     internal_item,
+			     sizeof( libfwsi_web_site_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_web_site_values_initialize,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_web_site_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create file entry values.",
+				 "%s: unable to create web site values.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_file_entry_values_read_data(
-			          (libfwsi_file_entry_values_t *) internal_item->value,
+			result = libfwsi_web_site_values_read_data(
+			          (libfwsi_web_site_values_t *) internal_item->value,
 			          shell_item_data,
 			          shell_item_data_size,
-			          ascii_codepage,
 			          error );
 
 			if( result == -1 )
@@ -1004,680 +1921,1238 @@ int libfwsi_item_copy_from_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file entry values.",
+				 "%s: unable to read web site values.",
 				 function );
 
 				goto on_error;
 			}
 			break;
 
-		case LIBFWSI_ITEM_TYPE_GAME_FOLDER:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_free;
+		case LIBFWSI_ITEM_TYPE_UNKNOWN:
+		default:
+			break;
+	}
+	/* The classifier only assigns an item type if the item values are supported
+	 * hence the item type, class type and signature are not changed here
+	 */
+	if( ( result == 0 )
+	 && ( internal_item->type != LIBFWSI_ITEM_TYPE_UNKNOWN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item values.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ internal_item->data_size - 2 ] ),
+	 first_extension_block_offset );
+
+	if( ( first_extension_block_offset >= 4 )
+	 && ( first_extension_block_offset < ( internal_item->data_size - 2 ) ) )
+	{
+		byte_stream_offset   = (size_t) first_extension_block_offset;
+		shell_item_data_size = internal_item->data_size - byte_stream_offset;
 
-			if( libfwsi_game_folder_values_initialize(
-			     (libfwsi_game_folder_values_t **) &( internal_item->value ),
+		while( shell_item_data_size > 2 )
+		{
+			if( libfwsi_internal_extension_block_initialize(
+			     &extension_block,
+			     internal_item->arena,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create game folder values.",
+				 "%s: unable to create extension block.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+			extension_block->string_cache.read_write_lock = internal_item->read_write_lock;
+#endif
+			result = libfwsi_extension_block_copy_from_byte_stream(
+				  extension_block,
+				  &( byte_stream[ byte_stream_offset ] ),
+				  shell_item_data_size,
+				  internal_item->ascii_codepage,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to extension block.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			byte_stream_offset   += extension_block->data_size;
+			shell_item_data_size -= extension_block->data_size;
+
+			if( extension_block->data_size == 2 )
+			{
+				break;
+			}
+			if( internal_item->last_extension_block == NULL )
+			{
+				internal_item->first_extension_block = extension_block;
+			}
+			else
+			{
+				internal_item->last_extension_block->next_extension_block = extension_block;
+			}
+			internal_item->last_extension_block = extension_block;
+
+			internal_item->number_of_extension_blocks += 1;
+
+			if( ( extension_block->signature & 0xffffffc0UL ) == 0xbeef0000UL )
+			{
+				internal_item->extension_block_signatures_mask |= (uint64_t) 1 << ( extension_block->signature & 0x3f );
+			}
+			extension_block = NULL;
+
+			number_of_extension_blocks++;
+		}
+		if( extension_block != NULL )
+		{
+			if( libfwsi_internal_extension_block_free(
+			     &extension_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extension block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( number_of_extension_blocks > 0 )
+			 && ( shell_item_data_size > 0 ) )
+			{
+				libcnotify_printf(
+				 "%s: trailing data:\n",
 				 function );
+				libcnotify_print_data(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 shell_item_data_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	}
+	internal_item->is_decoded = 1;
+
+	return( 1 );
+
+on_error:
+	if( extension_block != NULL )
+	{
+		libfwsi_internal_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( ( internal_item->value != NULL )
+	 && ( internal_item->free_value != NULL ) )
+	{
+		internal_item->free_value(
+		 &( internal_item->value ),
+		 NULL );
+	}
+	internal_item->value      = NULL;
+	internal_item->free_value = NULL;
+
+	libfwsi_internal_item_free_extension_blocks(
+	 internal_item,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Creates the item value
+ * If the item is backed by an arena the value is allocated from the arena,
+ * otherwise initialize_value is used and free_value is set as the free function
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_initialize_value(
+     libfwsi_internal_item_t *internal_item,
+     size_t value_size,
+     int (*initialize_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_initialize_value";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item - value already set.",
+		 function );
 
-				goto on_error;
-			}
-			result = libfwsi_game_folder_values_read_data(
-			          (libfwsi_game_folder_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          error );
+		return( -1 );
+	}
+	if( initialize_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialize value function.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read game folder values.",
-				 function );
+		return( -1 );
+	}
+	if( internal_item->arena != NULL )
+	{
+		if( libfwsi_arena_allocate(
+		     internal_item->arena,
+		     value_size,
+		     (uint8_t **) &( internal_item->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate value from arena.",
+			 function );
 
-				goto on_error;
-			}
-			break;
+			return( -1 );
+		}
+		if( memory_set(
+		     internal_item->value,
+		     0,
+		     value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value.",
+			 function );
 
-		case LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_free;
+			internal_item->value = NULL;
 
-			if( libfwsi_mtp_file_entry_values_initialize(
-			     (libfwsi_mtp_file_entry_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create MTP file entry values.",
-				 function );
+			return( -1 );
+		}
+		internal_item->free_value = NULL;
+	}
+	else
+	{
+		internal_item->free_value = free_value;
 
-				goto on_error;
-			}
-			result = libfwsi_mtp_file_entry_values_read_data(
-			          (libfwsi_mtp_file_entry_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          error );
+		if( initialize_value(
+		     &( internal_item->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value.",
+			 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read MTP file entry values.",
-				 function );
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			break;
+/* Retrieves the type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_type(
+     libfwsi_item_t *item,
+     int *type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_type";
 
-		case LIBFWSI_ITEM_TYPE_MTP_VOLUME:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_free;
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-			if( libfwsi_mtp_volume_values_initialize(
-			     (libfwsi_mtp_volume_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create MTP volume values.",
-				 function );
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
 
-				goto on_error;
-			}
-			result = libfwsi_mtp_volume_values_read_data(
-			          (libfwsi_mtp_volume_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          error );
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read MTP volume values.",
-				 function );
+		return( -1 );
+	}
+	*type = internal_item->type;
 
-				goto on_error;
-			}
-			break;
+	return( 1 );
+}
 
-		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_free;
+/* Retrieves the class type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_class_type(
+     libfwsi_item_t *item,
+     uint8_t *class_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_class_type";
 
-			if( libfwsi_network_location_values_initialize(
-			     (libfwsi_network_location_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create network location values.",
-				 function );
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-				goto on_error;
-			}
-			result = libfwsi_network_location_values_read_data(
-			          (libfwsi_network_location_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          ascii_codepage,
-			          error );
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read network location values.",
-				 function );
+	if( class_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid class type.",
+		 function );
 
-				goto on_error;
-			}
-			break;
+		return( -1 );
+	}
+	*class_type = internal_item->class_type;
 
-		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_free;
+	return( 1 );
+}
 
-			if( libfwsi_root_folder_values_initialize(
-			     (libfwsi_root_folder_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create root folder values.",
-				 function );
+/* Retrieves the signature
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_signature(
+     libfwsi_item_t *item,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_signature";
 
-				goto on_error;
-			}
-			result = libfwsi_root_folder_values_read_data(
-				  (libfwsi_root_folder_values_t *) internal_item->value,
-				  shell_item_data,
-				  shell_item_data_size,
-				  error );
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read root folder values.",
-				 function );
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
 
-				goto on_error;
-			}
-			break;
+		return( -1 );
+	}
+	*signature = internal_item->signature;
 
-		case LIBFWSI_ITEM_TYPE_URI:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_free;
+	return( 1 );
+}
 
-			if( libfwsi_uri_values_initialize(
-			     (libfwsi_uri_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create URI values.",
-				 function );
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_data_size(
+     libfwsi_item_t *item,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_data_size";
 
-				goto on_error;
-			}
-			result = libfwsi_uri_values_read_data(
-			          (libfwsi_uri_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          ascii_codepage,
-			          error );
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read URI values.",
-				 function );
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
 
-				goto on_error;
-			}
-			break;
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
 
-		case LIBFWSI_ITEM_TYPE_URI_SUB_VALUES:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_sub_values_free;
+		return( -1 );
+	}
+	*data_size = (size_t) internal_item->data_size;
 
-			if( libfwsi_uri_sub_values_initialize(
-			     (libfwsi_uri_sub_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create URI sub values.",
-				 function );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			result = libfwsi_uri_sub_values_read_data(
-			          (libfwsi_uri_sub_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          ascii_codepage,
-			          error );
+/* Finds the next volatile value in the item data
+ * Volatile values are 4 bytes of size and change without the shell item changing,
+ * such as the access time of a file entry extension block (0xbeef0004)
+ * The volatile value that is found is the first one that ends after the search offset
+ * Returns 1 if successful, 0 if no such value was found or -1 on error
+ */
+int libfwsi_internal_item_find_volatile_value(
+     libfwsi_internal_item_t *internal_item,
+     size_t search_offset,
+     size_t *value_offset,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfwsi_internal_item_find_volatile_value";
+	size_t data_offset                    = 0;
+	uint32_t signature                    = 0;
+	uint16_t extension_block_size         = 0;
+	uint16_t first_extension_block_offset = 0;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read URI sub values.",
-				 function );
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-				goto on_error;
-			}
-			break;
+		return( -1 );
+	}
+	if( internal_item->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing data.",
+		 function );
 
-		case LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_free;
+		return( -1 );
+	}
+	if( value_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value offset.",
+		 function );
 
-			if( libfwsi_users_property_view_values_initialize(
-			     (libfwsi_users_property_view_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create users property view values.",
-				 function );
+		return( -1 );
+	}
+	if( internal_item->data_size < 4 )
+	{
+		return( 0 );
+	}
+	/* The extension blocks are located the same way as when the item values are decoded
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 &( internal_item->data[ internal_item->data_size - 2 ] ),
+	 first_extension_block_offset );
 
-				goto on_error;
-			}
-			result = libfwsi_users_property_view_values_read_data(
-			          (libfwsi_users_property_view_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          ascii_codepage,
-			          error );
+	if( ( first_extension_block_offset < 4 )
+	 || ( first_extension_block_offset >= ( internal_item->data_size - 2 ) ) )
+	{
+		return( 0 );
+	}
+	data_offset = (size_t) first_extension_block_offset;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read users property view values.",
-				 function );
+	while( ( data_offset + 2 ) < (size_t) internal_item->data_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( internal_item->data[ data_offset ] ),
+		 extension_block_size );
 
-				goto on_error;
-			}
+		if( ( extension_block_size < 8 )
+		 || ( (size_t) extension_block_size > ( (size_t) internal_item->data_size - data_offset ) ) )
+		{
 			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_item->data[ data_offset + 4 ] ),
+		 signature );
 
-		case LIBFWSI_ITEM_TYPE_VOLUME:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_free;
-
-			if( libfwsi_volume_values_initialize(
-			     (libfwsi_volume_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create volume values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_volume_values_read_data(
-			          (libfwsi_volume_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          ascii_codepage,
-			          error );
+		if( ( signature == 0xbeef0004UL )
+		 && ( extension_block_size >= 16 )
+		 && ( ( data_offset + 16 ) > search_offset ) )
+		{
+			*value_offset = data_offset + 12;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read volume values.",
-				 function );
+			return( 1 );
+		}
+		data_offset += extension_block_size;
+	}
+	return( 0 );
+}
 
-				goto on_error;
-			}
-			break;
+/* Calculates the hashes of the item data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_calculate_hashes(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libfwsi_hash_context_t hash_context;
 
-		case LIBFWSI_ITEM_TYPE_WEB_SITE:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_web_site_values_free;
+	uint8_t volatile_value_data[ 4 ] = { 0, 0, 0, 0 };
 
-			if( libfwsi_web_site_values_initialize(
-			     (libfwsi_web_site_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create web site values.",
-				 function );
+	static char *function            = "libfwsi_internal_item_calculate_hashes";
+	size_t data_offset               = 0;
+	size_t value_offset              = 0;
+	int result                       = 0;
 
-				goto on_error;
-			}
-			result = libfwsi_web_site_values_read_data(
-			          (libfwsi_web_site_values_t *) internal_item->value,
-			          shell_item_data,
-			          shell_item_data_size,
-			          error );
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read web site values.",
-				 function );
+		return( -1 );
+	}
+	if( libfwsi_hash_calculate(
+	     internal_item->data,
+	     (size_t) internal_item->data_size,
+	     &( internal_item->hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash.",
+		 function );
 
-				goto on_error;
-			}
-			break;
+		return( -1 );
+	}
+	/* The semantic hash is calculated over the data with the volatile values set to 0,
+	 * hence it is the same as the hash if the data contains no volatile values
+	 */
+	if( libfwsi_hash_context_clear(
+	     &hash_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear hash context.",
+		 function );
 
-		case LIBFWSI_ITEM_TYPE_UNKNOWN:
-		default:
-			break;
+		return( -1 );
 	}
-	if( result == 0 )
+	do
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		result = libfwsi_internal_item_find_volatile_value(
+		          internal_item,
+		          data_offset,
+		          &value_offset,
+		          error );
+
+		if( result == -1 )
 		{
-			libcnotify_printf(
-			 "%s: unsupported shell item type.\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find volatile value.",
 			 function );
-		}
-#endif
-		internal_item->type       = LIBFWSI_ITEM_TYPE_UNKNOWN;
-		internal_item->class_type = 0;
-		internal_item->signature  = 0;
-	}
-	byte_stream_copy_to_uint16_little_endian(
-	 &( byte_stream[ internal_item->data_size - 2 ] ),
-	 first_extension_block_offset );
 
-	if( ( first_extension_block_offset >= 4 )
-	 && ( first_extension_block_offset < ( internal_item->data_size - 2 ) ) )
-	{
-		byte_stream_offset   = (size_t) first_extension_block_offset;
-		shell_item_data_size = internal_item->data_size - byte_stream_offset;
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			value_offset = (size_t) internal_item->data_size;
+		}
+		if( libfwsi_hash_context_update(
+		     &hash_context,
+		     &( internal_item->data[ data_offset ] ),
+		     value_offset - data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
 
-		while( shell_item_data_size > 2 )
+			return( -1 );
+		}
+		if( result != 0 )
 		{
-			if( libfwsi_extension_block_initialize(
-			     (libfwsi_extension_block_t **) &extension_block,
+			if( libfwsi_hash_context_update(
+			     &hash_context,
+			     volatile_value_data,
+			     4,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update hash context.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			result = libfwsi_extension_block_copy_from_byte_stream(
-				  extension_block,
-				  &( byte_stream[ byte_stream_offset ] ),
-				  shell_item_data_size,
-				  ascii_codepage,
-				  error );
+			data_offset = value_offset + 4;
+		}
+	}
+	while( result != 0 );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block.",
-				 function );
+	if( libfwsi_hash_context_finalize(
+	     &hash_context,
+	     &( internal_item->semantic_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize hash context.",
+		 function );
 
-				goto on_error;
-			}
-			else if( result == 0 )
-			{
-				break;
-			}
-			byte_stream_offset   += extension_block->data_size;
-			shell_item_data_size -= extension_block->data_size;
+		return( -1 );
+	}
+	internal_item->has_hashes = 1;
 
-			if( extension_block->data_size == 2 )
-			{
-				break;
-			}
-			if( libcdata_array_append_entry(
-			     internal_item->extension_blocks_array,
-			     &entry_index,
-			     (intptr_t *) extension_block,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append extension block.",
-				 function );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			extension_block = NULL;
+/* Retrieves the 64-bit hash of the item data
+ * The hashes are only calculated once, on first retrieval
+ * If the item is managed by an item list or item cache the calculation is serialized
+ * by its read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_get_hash(
+     libfwsi_internal_item_t *internal_item,
+     uint8_t compare_flags,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_get_hash";
+	int result            = 1;
 
-			number_of_extension_blocks++;
-		}
-		if( extension_block != NULL )
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	uint8_t has_hashes    = 0;
+#endif
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( internal_item->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
 		{
-			if( libfwsi_internal_extension_block_free(
-			     &extension_block,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free extension block.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-				goto on_error;
-			}
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		has_hashes = internal_item->has_hashes;
+
+		if( has_hashes != 0 )
 		{
-			if( ( number_of_extension_blocks > 0 )
-			 && ( shell_item_data_size > 0 ) )
+			if( ( compare_flags & LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) != 0 )
 			{
-				libcnotify_printf(
-				 "%s: trailing data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( byte_stream[ byte_stream_offset ] ),
-				 shell_item_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				*hash = internal_item->semantic_hash;
+			}
+			else
+			{
+				*hash = internal_item->hash;
 			}
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-	}
-	internal_item->ascii_codepage = ascii_codepage;
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-	return( 1 );
+			return( -1 );
+		}
+		if( has_hashes != 0 )
+		{
+			return( 1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
 
-on_error:
-	if( extension_block != NULL )
+			return( -1 );
+		}
+	}
+#endif
+	/* Another thread could have calculated the hashes before the lock was grabbed for writing
+	 */
+	if( internal_item->has_hashes == 0 )
 	{
-		libfwsi_internal_extension_block_free(
-		 &extension_block,
-		 NULL );
+		if( libfwsi_internal_item_calculate_hashes(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate hashes.",
+			 function );
+
+			result = -1;
+		}
 	}
-	if( delegate_folder_values != NULL )
+	if( result == 1 )
 	{
-		libfwsi_delegate_folder_values_free(
-		 &delegate_folder_values,
-		 NULL );
+		if( ( compare_flags & LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) != 0 )
+		{
+			*hash = internal_item->semantic_hash;
+		}
+		else
+		{
+			*hash = internal_item->hash;
+		}
 	}
-	if( ( internal_item->value != NULL )
-	 && ( internal_item->free_value != NULL ) )
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( internal_item->read_write_lock != NULL )
 	{
-		internal_item->free_value(
-		 &( internal_item->value ),
-		 NULL );
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_item->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	return( -1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the type
+/* Retrieves the 64-bit hash of the shell item data
+ * The hash is a non-cryptographic xxHash64 hash that is calculated on first retrieval
+ * compare_flags can contain LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES to retrieve
+ * the hash of the data without the volatile values, such as the access times of
+ * file entry extension blocks (0xbeef0004)
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_get_type(
+int libfwsi_item_get_hash(
      libfwsi_item_t *item,
-     int *type,
+     uint8_t compare_flags,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_hash";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_flags & ~( LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_get_hash(
+	     internal_item,
+	     compare_flags,
+	     hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares the shell item data of two items
+ * The data is compared byte by byte, where a shorter data that matches
+ * the start of a longer data is considered less
+ * compare_flags can contain LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES to compare
+ * the data as if the volatile values were 0
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL, LIBFWSI_COMPARE_GREATER if successful or -1 on error
+ */
+int libfwsi_item_compare(
+     libfwsi_item_t *first_item,
+     libfwsi_item_t *second_item,
+     uint8_t compare_flags,
      libcerror_error_t **error )
 {
-	libfwsi_internal_item_t *internal_item = NULL;
-	static char *function                  = "libfwsi_item_get_type";
-
-	if( item == NULL )
+	libfwsi_internal_item_t *first_internal_item  = NULL;
+	libfwsi_internal_item_t *second_internal_item = NULL;
+	static char *function                         = "libfwsi_item_compare";
+	size_t compare_size                           = 0;
+	size_t data_offset                            = 0;
+	size_t first_value_offset                     = 0;
+	size_t second_value_offset                    = 0;
+	size_t segment_end_offset                     = 0;
+	uint8_t first_byte_value                      = 0;
+	uint8_t second_byte_value                     = 0;
+	int result                                    = 0;
+
+	if( first_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 "%s: invalid first item.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item = (libfwsi_internal_item_t *) item;
+	first_internal_item = (libfwsi_internal_item_t *) first_item;
 
-	if( type == NULL )
+	if( first_internal_item->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid first item - missing data.",
 		 function );
 
 		return( -1 );
 	}
-	*type = internal_item->type;
-
-	return( 1 );
-}
-
-/* Retrieves the class type
- * Returns 1 if successful or -1 on error
- */
-int libfwsi_item_get_class_type(
-     libfwsi_item_t *item,
-     uint8_t *class_type,
-     libcerror_error_t **error )
-{
-	libfwsi_internal_item_t *internal_item = NULL;
-	static char *function                  = "libfwsi_item_get_class_type";
-
-	if( item == NULL )
+	if( second_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 "%s: invalid second item.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item = (libfwsi_internal_item_t *) item;
+	second_internal_item = (libfwsi_internal_item_t *) second_item;
 
-	if( class_type == NULL )
+	if( second_internal_item->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid second item - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_flags & ~( LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid class type.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags.",
 		 function );
 
 		return( -1 );
 	}
-	*class_type = internal_item->class_type;
+	if( first_internal_item->data_size <= second_internal_item->data_size )
+	{
+		compare_size = (size_t) first_internal_item->data_size;
+	}
+	else
+	{
+		compare_size = (size_t) second_internal_item->data_size;
+	}
+	first_value_offset  = compare_size;
+	second_value_offset = compare_size;
 
-	return( 1 );
+	while( data_offset < compare_size )
+	{
+		if( ( compare_flags & LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) != 0 )
+		{
+			/* Find the next volatile values at the start of the data and
+			 * after the data offset has passed the previous volatile values
+			 */
+			if( ( data_offset == 0 )
+			 || ( ( first_value_offset + 4 ) <= data_offset ) )
+			{
+				result = libfwsi_internal_item_find_volatile_value(
+				          first_internal_item,
+				          data_offset,
+				          &first_value_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to find volatile value in first item.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					first_value_offset = compare_size;
+				}
+			}
+			if( ( data_offset == 0 )
+			 || ( ( second_value_offset + 4 ) <= data_offset ) )
+			{
+				result = libfwsi_internal_item_find_volatile_value(
+				          second_internal_item,
+				          data_offset,
+				          &second_value_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to find volatile value in second item.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					second_value_offset = compare_size;
+				}
+			}
+		}
+		segment_end_offset = compare_size;
+
+		if( first_value_offset < segment_end_offset )
+		{
+			segment_end_offset = first_value_offset;
+		}
+		if( second_value_offset < segment_end_offset )
+		{
+			segment_end_offset = second_value_offset;
+		}
+		if( segment_end_offset > data_offset )
+		{
+			result = memory_compare(
+			          &( first_internal_item->data[ data_offset ] ),
+			          &( second_internal_item->data[ data_offset ] ),
+			          segment_end_offset - data_offset );
+
+			if( result < 0 )
+			{
+				return( LIBFWSI_COMPARE_LESS );
+			}
+			else if( result > 0 )
+			{
+				return( LIBFWSI_COMPARE_GREATER );
+			}
+			data_offset = segment_end_offset;
+
+			continue;
+		}
+		/* The data offset is within a volatile value of at least one of the items
+		 */
+		first_byte_value  = first_internal_item->data[ data_offset ];
+		second_byte_value = second_internal_item->data[ data_offset ];
+
+		if( ( data_offset >= first_value_offset )
+		 && ( data_offset < ( first_value_offset + 4 ) ) )
+		{
+			first_byte_value = 0;
+		}
+		if( ( data_offset >= second_value_offset )
+		 && ( data_offset < ( second_value_offset + 4 ) ) )
+		{
+			second_byte_value = 0;
+		}
+		if( first_byte_value < second_byte_value )
+		{
+			return( LIBFWSI_COMPARE_LESS );
+		}
+		else if( first_byte_value > second_byte_value )
+		{
+			return( LIBFWSI_COMPARE_GREATER );
+		}
+		data_offset++;
+	}
+	if( first_internal_item->data_size < second_internal_item->data_size )
+	{
+		return( LIBFWSI_COMPARE_LESS );
+	}
+	else if( first_internal_item->data_size > second_internal_item->data_size )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	return( LIBFWSI_COMPARE_EQUAL );
 }
 
-/* Retrieves the signature
- * Returns 1 if successful or -1 on error
+/* Determines if two items are equal
+ * The raw data is compared first. If the raw data differs and compare_flags
+ * contains LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES, items of the same type
+ * are compared without their volatile values, where the semantic hashes are
+ * used to skip the comparison of data that differs
+ * Returns 1 if equal, 0 if not or -1 on error
  */
-int libfwsi_item_get_signature(
-     libfwsi_item_t *item,
-     uint32_t *signature,
+int libfwsi_internal_item_is_equal(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item,
+     uint8_t compare_flags,
      libcerror_error_t **error )
 {
-	libfwsi_internal_item_t *internal_item = NULL;
-	static char *function                  = "libfwsi_item_get_signature";
+	static char *function     = "libfwsi_internal_item_is_equal";
+	uint64_t first_item_hash  = 0;
+	uint64_t second_item_hash = 0;
+	int result                = 0;
 
-	if( item == NULL )
+	if( first_internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 "%s: invalid first item.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item = (libfwsi_internal_item_t *) item;
-
-	if( signature == NULL )
+	if( second_internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid signature.",
+		 "%s: invalid second item.",
 		 function );
 
 		return( -1 );
 	}
-	*signature = internal_item->signature;
-
-	return( 1 );
-}
-
-/* Retrieves the data size
- * Returns 1 if successful or -1 on error
- */
-int libfwsi_item_get_data_size(
-     libfwsi_item_t *item,
-     size_t *data_size,
-     libcerror_error_t **error )
-{
-	libfwsi_internal_item_t *internal_item = NULL;
-	static char *function                  = "libfwsi_item_get_data_size";
+	/* Items shared by an item cache are the same item
+	 */
+	if( first_internal_item == second_internal_item )
+	{
+		return( 1 );
+	}
+	/* Volatile values do not change the data size
+	 */
+	if( ( first_internal_item->type != second_internal_item->type )
+	 || ( first_internal_item->data_size != second_internal_item->data_size ) )
+	{
+		return( 0 );
+	}
+	if( ( first_internal_item->data_size == 0 )
+	 || ( memory_compare(
+	       first_internal_item->data,
+	       second_internal_item->data,
+	       (size_t) first_internal_item->data_size ) == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( compare_flags & LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) == 0 )
+	{
+		return( 0 );
+	}
+	if( libfwsi_internal_item_get_hash(
+	     first_internal_item,
+	     LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	     &first_item_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash of first item.",
+		 function );
 
-	if( item == NULL )
+		return( -1 );
+	}
+	if( libfwsi_internal_item_get_hash(
+	     second_internal_item,
+	     LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	     &second_item_hash,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash of second item.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item = (libfwsi_internal_item_t *) item;
+	if( first_item_hash != second_item_hash )
+	{
+		return( 0 );
+	}
+	result = libfwsi_item_compare(
+	          (libfwsi_item_t *) first_internal_item,
+	          (libfwsi_item_t *) second_internal_item,
+	          compare_flags,
+	          error );
 
-	if( data_size == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare items.",
 		 function );
 
 		return( -1 );
 	}
-	*data_size = (size_t) internal_item->data_size;
-
-	return( 1 );
+	return( result == LIBFWSI_COMPARE_EQUAL );
 }
 
 /* Retrieves the delegate folder identifier
@@ -1773,20 +3248,32 @@ int libfwsi_item_get_number_of_extension_blocks(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_item->extension_blocks_array,
-	     number_of_extension_blocks,
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extension_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extension blocks.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_extension_blocks = internal_item->number_of_extension_blocks;
+
 	return( 1 );
 }
 
@@ -1799,8 +3286,10 @@ int libfwsi_item_get_extension_block(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error )
 {
-	libfwsi_internal_item_t *internal_item = NULL;
-	static char *function                  = "libfwsi_item_get_extension_block";
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	libfwsi_internal_item_t *internal_item                       = NULL;
+	static char *function                                        = "libfwsi_item_get_extension_block";
+	int block_index                                              = 0;
 
 	if( item == NULL )
 	{
@@ -1815,25 +3304,128 @@ int libfwsi_item_get_extension_block(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_item->extension_blocks_array,
-	     extension_block_index,
-	     (intptr_t **) extension_block,
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extension block: %d.",
-		 function,
-		 extension_block_index );
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extension_block_index < 0 )
+	 || ( extension_block_index >= internal_item->number_of_extension_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extension block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
 
 		return( -1 );
 	}
+	internal_extension_block = internal_item->first_extension_block;
+
+	for( block_index = 0;
+	     block_index < extension_block_index;
+	     block_index++ )
+	{
+		internal_extension_block = internal_extension_block->next_extension_block;
+	}
+	*extension_block = (libfwsi_extension_block_t *) internal_extension_block;
+
 	return( 1 );
 }
 
+/* Retrieves the first extension block with a specific signature
+ * Returns 1 if successful, 0 if no such extension block or -1 on error
+ */
+int libfwsi_item_get_extension_block_by_signature(
+     libfwsi_item_t *item,
+     uint32_t signature,
+     libfwsi_extension_block_t **extension_block,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	libfwsi_internal_item_t *internal_item                       = NULL;
+	static char *function                                        = "libfwsi_item_get_extension_block_by_signature";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The signatures mask determines without traversing the extension blocks
+	 * if an extension block with a 0xbeef00## signature is not present
+	 */
+	if( ( ( signature & 0xffffffc0UL ) == 0xbeef0000UL )
+	 && ( ( internal_item->extension_block_signatures_mask & ( (uint64_t) 1 << ( signature & 0x3f ) ) ) == 0 ) )
+	{
+		return( 0 );
+	}
+	internal_extension_block = internal_item->first_extension_block;
+
+	while( internal_extension_block != NULL )
+	{
+		if( internal_extension_block->signature == signature )
+		{
+			*extension_block = (libfwsi_extension_block_t *) internal_extension_block;
+
+			return( 1 );
+		}
+		internal_extension_block = internal_extension_block->next_extension_block;
+	}
+	return( 0 );
+}
+
 /* Retrieves the parent shell item
  * Returns 1 if successful or -1 on error
  */
@@ -25,9 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
+#include "libfwsi_extension_block.h"
 #include "libfwsi_extern.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
@@ -54,6 +58,42 @@ struct libfwsi_internal_item
 	 */
 	uint16_t data_size;
 
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data copy
+	 */
+	uint8_t *data_copy;
+
+	/* The allocated size of the data copy
+	 */
+	size_t data_copy_size;
+
+	/* The 64-bit hash of the data
+	 */
+	uint64_t hash;
+
+	/* The 64-bit hash of the data without the volatile values
+	 */
+	uint64_t semantic_hash;
+
+	/* Value to indicate the hashes have been calculated
+	 */
+	uint8_t has_hashes;
+
+	/* The item values data
+	 */
+	const uint8_t *values_data;
+
+	/* The item values data size
+	 */
+	size_t values_data_size;
+
+	/* Value to indicate the item values and extension blocks have been read
+	 */
+	uint8_t is_decoded;
+
 	/* The item value
 	 */
         intptr_t *value;
@@ -72,9 +112,22 @@ struct libfwsi_internal_item
 	 */
 	uint8_t delegate_folder_identifier[ 16 ];
 
-	/* The extension blocks array
+	/* The first extension block
+	 */
+	libfwsi_internal_extension_block_t *first_extension_block;
+
+	/* The last extension block
+	 */
+	libfwsi_internal_extension_block_t *last_extension_block;
+
+	/* The number of extension blocks
 	 */
-	libcdata_array_t *extension_blocks_array;
+	int number_of_extension_blocks;
+
+	/* The extension block signatures mask
+	 * Bit N is set if an extension block with signature 0xbeef0000 + N is present
+	 */
+	uint64_t extension_block_signatures_mask;
 
 	/* The parent shell item
 	 */
@@ -87,6 +140,31 @@ struct libfwsi_internal_item
 	/* Value to indicate if the item is managed by a list
 	 */
 	uint8_t is_managed;
+
+	/* The arena the item is allocated from, NULL if allocated on the heap
+	 */
+	libfwsi_arena_t *arena;
+
+	/* The item cache that shares the item, NULL if not shared
+	 */
+	libfwsi_item_cache_t *item_cache;
+
+	/* The number of item lists that reference the item, only used by shared items
+	 */
+	int reference_count;
+
+	/* The decoded string cache
+	 */
+	libfwsi_string_cache_t string_cache;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the item list or item cache that manages the item, NULL if not managed
+	 * The lock serializes the deferred decoding of the item values
+	 * The type, class type and signature are set when the item is read
+	 * and do not change afterwards, hence they are accessed without the lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBFWSI_EXTERN \
@@ -96,6 +174,7 @@ int libfwsi_item_initialize(
 
 int libfwsi_internal_item_initialize(
      libfwsi_internal_item_t **internal_item,
+     libfwsi_arena_t *arena,
      libcerror_error_t **error );
 
 LIBFWSI_EXTERN \
@@ -107,6 +186,23 @@ int libfwsi_internal_item_free(
      libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_release(
+     libfwsi_internal_item_t **internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_free_extension_blocks(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_reset(
+     libfwsi_item_t *item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_clear(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_copy_from_byte_stream(
      libfwsi_item_t *item,
@@ -115,6 +211,51 @@ int libfwsi_item_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_copy_from_byte_stream(
+     libfwsi_internal_item_t *internal_item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_read_byte_stream(
+     libfwsi_internal_item_t *internal_item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_classify_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int *item_type,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_read_values(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_decode_values(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_initialize_value(
+     libfwsi_internal_item_t *internal_item,
+     size_t value_size,
+     int (*initialize_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_get_type(
      libfwsi_item_t *item,
@@ -139,6 +280,42 @@ int libfwsi_item_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_find_volatile_value(
+     libfwsi_internal_item_t *internal_item,
+     size_t search_offset,
+     size_t *value_offset,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_calculate_hashes(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_get_hash(
+     libfwsi_internal_item_t *internal_item,
+     uint8_t compare_flags,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_get_hash(
+     libfwsi_item_t *item,
+     uint8_t compare_flags,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_compare(
+     libfwsi_item_t *first_item,
+     libfwsi_item_t *second_item,
+     uint8_t compare_flags,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_is_equal(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item,
+     uint8_t compare_flags,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_get_delegate_folder_identifier(
      libfwsi_item_t *item,
@@ -159,6 +336,13 @@ int libfwsi_item_get_extension_block(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_get_extension_block_by_signature(
+     libfwsi_item_t *item,
+     uint32_t signature,
+     libfwsi_extension_block_t **extension_block,
+     libcerror_error_t **error );
+
 int libfwsi_item_get_parent_item(
      libfwsi_item_t *item,
      libfwsi_item_t **parent_item,
@@ -0,0 +1,1006 @@
+/*
+ * Item cache functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_cache.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_types.h"
+
+/* Creates an item cache
+ * Make sure the value item_cache is referencing, is set to NULL
+ * The item cache shares decoded items between the item lists it is set on,
+ * items are identified by their data, the type of their parent item and the codepage
+ * maximum_number_of_items contains the maximum number of items, 0 represents no maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_cache_initialize(
+     libfwsi_item_cache_t **item_cache,
+     int maximum_number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_cache_t *internal_item_cache = NULL;
+	static char *function                              = "libfwsi_item_cache_initialize";
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of items value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_cache = memory_allocate_structure(
+	                       libfwsi_internal_item_cache_t );
+
+	if( internal_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_item_cache,
+	     0,
+	     sizeof( libfwsi_internal_item_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item cache.",
+		 function );
+
+		memory_free(
+		 internal_item_cache );
+
+		return( -1 );
+	}
+	internal_item_cache->buckets = (libfwsi_item_cache_entry_t **) memory_allocate(
+	                                sizeof( libfwsi_item_cache_entry_t * ) * LIBFWSI_ITEM_CACHE_INITIAL_NUMBER_OF_BUCKETS );
+
+	if( internal_item_cache->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_item_cache->buckets,
+	     0,
+	     sizeof( libfwsi_item_cache_entry_t * ) * LIBFWSI_ITEM_CACHE_INITIAL_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_item_cache->number_of_buckets       = LIBFWSI_ITEM_CACHE_INITIAL_NUMBER_OF_BUCKETS;
+	internal_item_cache->maximum_number_of_items = maximum_number_of_items;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_item_cache->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*item_cache = (libfwsi_item_cache_t *) internal_item_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_item_cache != NULL )
+	{
+		if( internal_item_cache->buckets != NULL )
+		{
+			memory_free(
+			 internal_item_cache->buckets );
+		}
+		memory_free(
+		 internal_item_cache );
+	}
+	return( -1 );
+}
+
+/* Frees an item cache
+ * The item cache cannot be freed while items of the cache are referenced by item lists,
+ * hence the item lists it was set on must be freed or reset first
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_cache_free(
+     libfwsi_item_cache_t **item_cache,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_cache_t *internal_item_cache = NULL;
+	libfwsi_item_cache_entry_t *entry                  = NULL;
+	static char *function                              = "libfwsi_item_cache_free";
+	uint32_t bucket_index                              = 0;
+	int result                                         = 1;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_cache != NULL )
+	{
+		internal_item_cache = (libfwsi_internal_item_cache_t *) *item_cache;
+
+		if( internal_item_cache->number_of_references != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid item cache - items still referenced by item lists.",
+			 function );
+
+			return( -1 );
+		}
+		*item_cache = NULL;
+
+		for( bucket_index = 0;
+		     bucket_index < internal_item_cache->number_of_buckets;
+		     bucket_index++ )
+		{
+			while( internal_item_cache->buckets[ bucket_index ] != NULL )
+			{
+				entry = internal_item_cache->buckets[ bucket_index ];
+
+				internal_item_cache->buckets[ bucket_index ] = entry->next_entry;
+
+				if( libfwsi_internal_item_free(
+				     &( entry->internal_item ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free item.",
+					 function );
+
+					result = -1;
+				}
+				memory_free(
+				 entry );
+			}
+		}
+		memory_free(
+		 internal_item_cache->buckets );
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_item_cache->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_item_cache );
+	}
+	return( result );
+}
+
+/* Retrieves the number of items in the item cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_cache_get_number_of_items(
+     libfwsi_item_cache_t *item_cache,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_cache_t *internal_item_cache = NULL;
+	static char *function                              = "libfwsi_item_cache_get_number_of_items";
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_cache = (libfwsi_internal_item_cache_t *) item_cache;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_items = internal_item_cache->number_of_items;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Calculates the hash of a shell item
+ * The hash is a 32-bit FNV-1a hash of the shell item data, the parent item type and the codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_cache_calculate_hash(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_item_cache_calculate_hash";
+	size_t byte_stream_offset = 0;
+	uint32_t safe_hash        = 0x811c9dc5UL;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < byte_stream_size;
+	     byte_stream_offset++ )
+	{
+		safe_hash ^= byte_stream[ byte_stream_offset ];
+		safe_hash *= 0x01000193UL;
+	}
+	safe_hash ^= (uint32_t) parent_item_type & 0xff;
+	safe_hash *= 0x01000193UL;
+
+	safe_hash ^= (uint32_t) ascii_codepage & 0xffff;
+	safe_hash *= 0x01000193UL;
+
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Finds the entry of a shell item in the item cache
+ * The caller is responsible for holding the read/write lock
+ * Returns 1 if found or 0 if not
+ */
+int libfwsi_internal_item_cache_find_entry(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     uint32_t hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     libfwsi_item_cache_entry_t **entry )
+{
+	libfwsi_item_cache_entry_t *safe_entry = NULL;
+
+	safe_entry = internal_item_cache->buckets[ hash & ( internal_item_cache->number_of_buckets - 1 ) ];
+
+	while( safe_entry != NULL )
+	{
+		if( ( safe_entry->hash == hash )
+		 && ( safe_entry->parent_item_type == parent_item_type )
+		 && ( safe_entry->internal_item->ascii_codepage == ascii_codepage )
+		 && ( (size_t) safe_entry->internal_item->data_size == byte_stream_size )
+		 && ( memory_compare(
+		       safe_entry->internal_item->data,
+		       byte_stream,
+		       byte_stream_size ) == 0 ) )
+		{
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+		safe_entry = safe_entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Inserts a shell item into the item cache
+ * The number of buckets is doubled when the number of items exceeds it
+ * The caller is responsible for holding the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_cache_insert_item(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     uint32_t hash,
+     int parent_item_type,
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libfwsi_item_cache_entry_t **buckets = NULL;
+	libfwsi_item_cache_entry_t *entry    = NULL;
+	static char *function                = "libfwsi_internal_item_cache_insert_item";
+	uint32_t bucket_index                = 0;
+	uint32_t number_of_buckets           = 0;
+
+	if( internal_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (uint32_t) internal_item_cache->number_of_items >= internal_item_cache->number_of_buckets )
+	 && ( internal_item_cache->number_of_buckets < (uint32_t) INT32_MAX ) )
+	{
+		number_of_buckets = internal_item_cache->number_of_buckets * 2;
+
+		buckets = (libfwsi_item_cache_entry_t **) memory_allocate(
+		           sizeof( libfwsi_item_cache_entry_t * ) * number_of_buckets );
+
+		if( buckets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buckets.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     buckets,
+		     0,
+		     sizeof( libfwsi_item_cache_entry_t * ) * number_of_buckets ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buckets.",
+			 function );
+
+			memory_free(
+			 buckets );
+
+			return( -1 );
+		}
+		for( bucket_index = 0;
+		     bucket_index < internal_item_cache->number_of_buckets;
+		     bucket_index++ )
+		{
+			while( internal_item_cache->buckets[ bucket_index ] != NULL )
+			{
+				entry = internal_item_cache->buckets[ bucket_index ];
+
+				internal_item_cache->buckets[ bucket_index ] = entry->next_entry;
+
+				entry->next_entry                                  = buckets[ entry->hash & ( number_of_buckets - 1 ) ];
+				buckets[ entry->hash & ( number_of_buckets - 1 ) ] = entry;
+			}
+		}
+		memory_free(
+		 internal_item_cache->buckets );
+
+		internal_item_cache->buckets           = buckets;
+		internal_item_cache->number_of_buckets = number_of_buckets;
+	}
+	entry = memory_allocate_structure(
+	         libfwsi_item_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = hash & ( internal_item_cache->number_of_buckets - 1 );
+
+	entry->hash             = hash;
+	entry->parent_item_type = parent_item_type;
+	entry->internal_item    = internal_item;
+	entry->next_entry       = internal_item_cache->buckets[ bucket_index ];
+
+	internal_item_cache->buckets[ bucket_index ] = entry;
+
+	internal_item_cache->number_of_items += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a shared item for a shell item from the item cache
+ * If the item cache does not contain a matching item, the shell item is read
+ * into a new item and added to the item cache
+ * Shared items always contain a copy of the shell item data and their parent item is not set
+ * The parent item type is only relevant for compressed folder and URI parent items
+ * A reference to the item is added that must be released with libfwsi_internal_item_release
+ * Returns 1 if successful, 0 if the shell item cannot be shared or -1 on error
+ */
+int libfwsi_internal_item_cache_get_item(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libfwsi_internal_item_t **internal_item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *safe_internal_item = NULL;
+	libfwsi_item_cache_entry_t *entry           = NULL;
+	static char *function                       = "libfwsi_internal_item_cache_get_item";
+	uint32_t hash                               = 0;
+	uint16_t data_size                          = 0;
+	uint8_t is_full                             = 0;
+	int result                                  = 0;
+
+	if( internal_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 2 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 data_size );
+
+	/* Shell items with an invalid size are not shared, hence reading them
+	 * behaves the same as without an item cache
+	 */
+	if( ( data_size < 4 )
+	 || ( (size_t) data_size > byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	/* Only compressed folder and URI parent items change how a shell item is read
+	 */
+	if( ( parent_item_type != LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER )
+	 && ( parent_item_type != LIBFWSI_ITEM_TYPE_URI ) )
+	{
+		parent_item_type = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	}
+	if( libfwsi_item_cache_calculate_hash(
+	     byte_stream,
+	     (size_t) data_size,
+	     parent_item_type,
+	     ascii_codepage,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfwsi_internal_item_cache_find_entry(
+	          internal_item_cache,
+	          hash,
+	          byte_stream,
+	          (size_t) data_size,
+	          parent_item_type,
+	          ascii_codepage,
+	          &entry );
+
+	if( result != 0 )
+	{
+		entry->internal_item->reference_count += 1;
+
+		internal_item_cache->number_of_references += 1;
+	}
+	else if( ( internal_item_cache->maximum_number_of_items != 0 )
+	      && ( internal_item_cache->number_of_items >= internal_item_cache->maximum_number_of_items ) )
+	{
+		is_full = 1;
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( entry != NULL )
+		{
+			safe_internal_item = entry->internal_item;
+		}
+		goto on_error;
+	}
+#endif
+	if( is_full != 0 )
+	{
+		return( 0 );
+	}
+	if( entry == NULL )
+	{
+		/* The shell item is read without holding the read/write lock since
+		 * reading the item values grabs the same lock
+		 */
+		if( libfwsi_internal_item_initialize(
+		     &safe_internal_item,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item.",
+			 function );
+
+			return( -1 );
+		}
+		safe_internal_item->is_managed = 1;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		safe_internal_item->read_write_lock              = internal_item_cache->read_write_lock;
+		safe_internal_item->string_cache.read_write_lock = internal_item_cache->read_write_lock;
+#endif
+
+		if( libfwsi_internal_item_copy_from_byte_stream(
+		     safe_internal_item,
+		     byte_stream,
+		     byte_stream_size,
+		     parent_item_type,
+		     ascii_codepage,
+		     read_flags & ~( LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to item.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_item_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+		/* Another thread could have added the same shell item while the lock was released
+		 */
+		result = libfwsi_internal_item_cache_find_entry(
+		          internal_item_cache,
+		          hash,
+		          byte_stream,
+		          (size_t) data_size,
+		          parent_item_type,
+		          ascii_codepage,
+		          &entry );
+
+		if( result != 0 )
+		{
+			entry->internal_item->reference_count += 1;
+
+			internal_item_cache->number_of_references += 1;
+		}
+#endif
+		/* The maximum number of items is not checked again, hence concurrent reads
+		 * can exceed it by the number of threads
+		 */
+		if( result == 0 )
+		{
+			result = libfwsi_internal_item_cache_insert_item(
+			          internal_item_cache,
+			          hash,
+			          parent_item_type,
+			          safe_internal_item,
+			          error );
+
+			if( result == 1 )
+			{
+				safe_internal_item->item_cache      = (libfwsi_item_cache_t *) internal_item_cache;
+				safe_internal_item->reference_count = 1;
+
+				internal_item_cache->number_of_references += 1;
+			}
+		}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_item_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert item.",
+			 function );
+
+			goto on_error;
+		}
+		if( entry != NULL )
+		{
+			if( libfwsi_internal_item_free(
+			     &safe_internal_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free item.",
+				 function );
+
+				safe_internal_item = entry->internal_item;
+
+				goto on_error;
+			}
+		}
+	}
+	if( entry != NULL )
+	{
+		safe_internal_item = entry->internal_item;
+
+		/* A shared item that was read with deferred decoding is decoded now
+		 * so errors are reported the same as without an item cache
+		 */
+		if( ( read_flags & LIBFWSI_PARSE_FLAG_DEFER_DECODING ) == 0 )
+		{
+			if( libfwsi_internal_item_read_values(
+			     safe_internal_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read item values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	*internal_item = safe_internal_item;
+
+	return( 1 );
+
+on_error:
+	if( safe_internal_item != NULL )
+	{
+		if( safe_internal_item->item_cache != NULL )
+		{
+			libfwsi_internal_item_cache_release_item(
+			 internal_item_cache,
+			 safe_internal_item,
+			 NULL );
+		}
+		else
+		{
+			libfwsi_internal_item_free(
+			 &safe_internal_item,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Releases a reference to a shared item
+ * The item remains in the item cache until the item cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_cache_release_item(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_cache_release_item";
+	int result            = 1;
+
+	if( internal_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_item->reference_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item - reference count value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_item->reference_count -= 1;
+
+		internal_item_cache->number_of_references -= 1;
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,157 @@
+/*
+ * Item cache functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ITEM_CACHE_H )
+#define _LIBFWSI_ITEM_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of buckets of the item cache hash table, must be a power of 2
+ */
+#define LIBFWSI_ITEM_CACHE_INITIAL_NUMBER_OF_BUCKETS	256
+
+typedef struct libfwsi_item_cache_entry libfwsi_item_cache_entry_t;
+
+struct libfwsi_item_cache_entry
+{
+	/* The hash of the item data, parent item type and codepage
+	 */
+	uint32_t hash;
+
+	/* The parent item type the item was read with
+	 */
+	int parent_item_type;
+
+	/* The shared item
+	 */
+	libfwsi_internal_item_t *internal_item;
+
+	/* The next entry in the same bucket
+	 */
+	libfwsi_item_cache_entry_t *next_entry;
+};
+
+typedef struct libfwsi_internal_item_cache libfwsi_internal_item_cache_t;
+
+struct libfwsi_internal_item_cache
+{
+	/* The hash table buckets
+	 */
+	libfwsi_item_cache_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The maximum number of items, 0 represents no maximum
+	 */
+	int maximum_number_of_items;
+
+	/* The number of references to the items by item lists
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * The lock protects the hash table and the reference counts,
+	 * and serializes the deferred decoding of the shared items
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_item_cache_initialize(
+     libfwsi_item_cache_t **item_cache,
+     int maximum_number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_cache_free(
+     libfwsi_item_cache_t **item_cache,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_cache_get_number_of_items(
+     libfwsi_item_cache_t *item_cache,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+int libfwsi_item_cache_calculate_hash(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_cache_find_entry(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     uint32_t hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     libfwsi_item_cache_entry_t **entry );
+
+int libfwsi_internal_item_cache_insert_item(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     uint32_t hash,
+     int parent_item_type,
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_cache_get_item(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int parent_item_type,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libfwsi_internal_item_t **internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_cache_release_item(
+     libfwsi_internal_item_cache_t *internal_item_cache,
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ITEM_CACHE_H ) */
+
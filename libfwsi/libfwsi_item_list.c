@@ -24,12 +24,23 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_fat_date_time.h"
+#include "libfwsi_file_entry_extension_values.h"
+#include "libfwsi_file_entry_values.h"
+#include "libfwsi_hash.h"
 #include "libfwsi_item.h"
+#include "libfwsi_item_cache.h"
 #include "libfwsi_item_list.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_path_segment.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_types.h"
 
 /* Creates an item list
@@ -91,7 +102,10 @@ int libfwsi_item_list_initialize(
 		 "%s: unable to clear item list.",
 		 function );
 
-		goto on_error;
+		memory_free(
+		 internal_item_list );
+
+		return( -1 );
 	}
 	if( libcdata_array_initialize(
 	     &( internal_item_list->items_array ),
@@ -107,6 +121,35 @@ int libfwsi_item_list_initialize(
 
 		goto on_error;
 	}
+	if( libfwsi_arena_initialize(
+	     &( internal_item_list->arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_item_list->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	internal_item_list->string_cache.read_write_lock = internal_item_list->read_write_lock;
+#endif
 	*item_list = (libfwsi_item_list_t *) internal_item_list;
 
 	return( 1 );
@@ -114,6 +157,19 @@ int libfwsi_item_list_initialize(
 on_error:
 	if( internal_item_list != NULL )
 	{
+		if( internal_item_list->arena != NULL )
+		{
+			libfwsi_arena_free(
+			 &( internal_item_list->arena ),
+			 NULL );
+		}
+		if( internal_item_list->items_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_item_list->items_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 internal_item_list );
 	}
@@ -147,9 +203,22 @@ int libfwsi_item_list_free(
 		internal_item_list = (libfwsi_internal_item_list_t *) *item_list;
 		*item_list         = NULL;
 
+		if( libfwsi_string_cache_clear(
+		     &( internal_item_list->string_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear string cache.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( internal_item_list->items_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_release,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -161,6 +230,37 @@ int libfwsi_item_list_free(
 
 			result = -1;
 		}
+		/* The items are allocated from the arena hence the arena
+		 * must be freed after the items array
+		 */
+		if( libfwsi_arena_free(
+		     &( internal_item_list->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_item_list->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_item_list );
 	}
@@ -177,13 +277,7 @@ int libfwsi_item_list_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error )
 {
-	libfwsi_internal_item_t *internal_item           = NULL;
-	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	libfwsi_item_t *parent_item                      = NULL;
-	static char *function                            = "libfwsi_item_list_copy_from_byte_stream";
-	uint16_t shell_item_size                         = 0;
-	int item_list_index                              = 0;
-	int shell_item_index                             = 0;
+	static char *function = "libfwsi_item_list_copy_from_byte_stream";
 
 	if( item_list == NULL )
 	{
@@ -196,213 +290,85 @@ int libfwsi_item_list_copy_from_byte_stream(
 
 		return( -1 );
 	}
-	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
-
-	if( byte_stream == NULL )
+	if( libfwsi_internal_item_list_read_byte_stream(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item list.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_stream_size < 2 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: byte stream too small.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	if( byte_stream_size > (size_t) SSIZE_MAX )
+/* Parses a shell item list from a byte stream without copying the data
+ * The items reference the byte stream, which must remain available
+ * and unmodified while the item list is in use
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_parse_borrowed(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_parse_borrowed";
+
+	if( item_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: byte stream size exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	if( libfwsi_internal_item_list_read_byte_stream(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item list.",
 		 function );
 
 		return( -1 );
 	}
-	while( byte_stream_size >= 2 )
-	{
-		byte_stream_copy_to_uint16_little_endian(
-		 byte_stream,
-		 shell_item_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
-			 function,
-			 shell_item_index,
-			 shell_item_size );
-		}
-#endif
-		if( shell_item_size > byte_stream_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid shell item size value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( shell_item_size == 0 )
-		{
-			byte_stream                   += 2;
-			byte_stream_size              -= 2;
-			internal_item_list->data_size += 2;
-
-			break;
-		}
-		if( libfwsi_internal_item_initialize(
-		     &internal_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create shell item.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfwsi_item_set_parent_item(
-		     (libfwsi_item_t *) internal_item,
-		     parent_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set parent shell item.",
-			 function );
-
-			goto on_error;
-		}
-		if( internal_item == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: missing shell item.",
-			 function );
-
-			goto on_error;
-		}
-		internal_item->is_managed = 1;
-
-		if( libfwsi_item_copy_from_byte_stream(
-		     (libfwsi_item_t *) internal_item,
-		     byte_stream,
-		     byte_stream_size,
-		     ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy byte stream to shell item.",
-			 function );
-
-			goto on_error;
-		}
-		byte_stream                   += shell_item_size;
-		byte_stream_size              -= shell_item_size;
-		internal_item_list->data_size += (size_t) shell_item_size;
-
-		if( libcdata_array_append_entry(
-		     internal_item_list->items_array,
-		     &item_list_index,
-		     (intptr_t *) internal_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append shell item: %d.",
-			 function,
-			 shell_item_index );
-
-			goto on_error;
-		}
-		parent_item   = (libfwsi_item_t *) internal_item;
-		internal_item = NULL;
-
-		shell_item_index++;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	internal_item_list->ascii_codepage = ascii_codepage;
-
 	return( 1 );
-
-on_error:
-	if( internal_item != NULL )
-	{
-		libfwsi_internal_item_free(
-		 &internal_item,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Retrieves the data size
+/* Parses a shell item list from a byte stream
+ * The parse flags control if the byte stream is copied and if decoding of
+ * the item values is deferred until they are first accessed
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_get_data_size(
+int libfwsi_item_list_parse(
      libfwsi_item_list_t *item_list,
-     size_t *data_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
      libcerror_error_t **error )
 {
-	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_data_size";
+	static char *function = "libfwsi_item_list_parse";
 
 	if( item_list == NULL )
 	{
@@ -415,34 +381,37 @@ int libfwsi_item_list_get_data_size(
 
 		return( -1 );
 	}
-	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
-
-	if( data_size == NULL )
+	if( libfwsi_internal_item_list_read_byte_stream(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     parse_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item list.",
 		 function );
 
 		return( -1 );
 	}
-	*data_size = internal_item_list->data_size;
-
 	return( 1 );
 }
 
-/* Retrieves the number of items
+/* Resets an item list so it can be reused to parse another shell item list
+ * The items array and arena blocks are retained and only grow when needed
+ * Items previously retrieved from the item list can no longer be used
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_get_number_of_items(
+int libfwsi_item_list_reset(
      libfwsi_item_list_t *item_list,
-     int *number_of_items,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_number_of_items";
+	static char *function                            = "libfwsi_item_list_reset";
 
 	if( item_list == NULL )
 	{
@@ -457,9 +426,175 @@ int libfwsi_item_list_get_number_of_items(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_item_list->items_array,
-	     number_of_items,
+	if( libfwsi_string_cache_clear(
+	     &( internal_item_list->string_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     internal_item_list->items_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_release,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty items array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The items are allocated from the arena hence the arena
+	 * must be reset after the items array was emptied
+	 */
+	if( libfwsi_arena_reset(
+	     internal_item_list->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list->parent_item_list       = NULL;
+	internal_item_list->number_of_parent_items = 0;
+	internal_item_list->data_size              = 0;
+	internal_item_list->ascii_codepage         = 0;
+
+	return( 1 );
+}
+
+/* Resets an item list and parses a shell item list from a byte stream
+ * parse_flags is a combination of LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM and LIBFWSI_PARSE_FLAG_DEFER_DECODING
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_reparse(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_reparse";
+
+	if( libfwsi_item_list_reset(
+	     item_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_read_byte_stream(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     parse_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a shell item list from a byte stream relative to a parent item list
+ * The items of the parent item list form the prefix of the items of the item list,
+ * they are shared and not copied, hence the parent item list must remain available
+ * and unmodified while the item list is in use
+ * The item list must not contain items
+ * parse_flags is a combination of LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM and LIBFWSI_PARSE_FLAG_DEFER_DECODING
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_parse_with_parent(
+     libfwsi_item_list_t *item_list,
+     libfwsi_item_list_t *parent_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list        = NULL;
+	libfwsi_internal_item_list_t *internal_parent_item_list = NULL;
+	static char *function                                   = "libfwsi_item_list_parse_with_parent";
+	int number_of_items                                     = 0;
+	int number_of_parent_items                              = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( parent_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent item list.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the item list is not an ancestor of the parent item list
+	 */
+	internal_parent_item_list = (libfwsi_internal_item_list_t *) parent_item_list;
+
+	while( internal_parent_item_list != NULL )
+	{
+		if( internal_parent_item_list == internal_item_list )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid parent item list value refers to item list.",
+			 function );
+
+			return( -1 );
+		}
+		internal_parent_item_list = internal_parent_item_list->parent_item_list;
+	}
+	internal_parent_item_list = (libfwsi_internal_item_list_t *) parent_item_list;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -471,20 +606,77 @@ int libfwsi_item_list_get_number_of_items(
 
 		return( -1 );
 	}
+	if( ( number_of_items != 0 )
+	 || ( internal_item_list->parent_item_list != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list - already contains items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     internal_parent_item_list,
+	     &number_of_parent_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items of parent item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list->parent_item_list       = internal_parent_item_list;
+	internal_item_list->number_of_parent_items = number_of_parent_items;
+
+	if( libfwsi_internal_item_list_read_byte_stream(
+	     internal_item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     parse_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item list.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	libfwsi_item_list_reset(
+	 item_list,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Retrieves a specific item
+/* Sets the item cache
+ * Items of subsequently parsed shell item lists are shared with other item lists
+ * that use the same item cache instead of being read again
+ * The item cache must remain available until the items of the item list are released,
+ * by reset or free, and is not freed by the item list
+ * A NULL item cache stops sharing the items of subsequently parsed shell item lists
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_get_item(
+int libfwsi_item_list_set_item_cache(
      libfwsi_item_list_t *item_list,
-     int item_index,
-     libfwsi_item_t **item,
+     libfwsi_item_cache_t *item_cache,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_item";
+	static char *function                            = "libfwsi_item_list_set_item_cache";
 
 	if( item_list == NULL )
 	{
@@ -499,19 +691,2561 @@ int libfwsi_item_list_get_item(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
-	if( libcdata_array_get_entry_by_index(
+	internal_item_list->item_cache = item_cache;
+
+	return( 1 );
+}
+
+/* Reads a shell item list from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_read_byte_stream(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_item_t *parent_item            = NULL;
+	static char *function                  = "libfwsi_internal_item_list_read_byte_stream";
+	uint16_t shell_item_size               = 0;
+	int item_list_index                    = 0;
+	int number_of_items                    = 0;
+	int parent_item_type                   = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	int result                             = 0;
+	int shell_item_index                   = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_flags & ~( LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cached path no longer matches the items once items are added
+	 */
+	if( libfwsi_string_cache_clear(
+	     &( internal_item_list->string_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
 	     internal_item_list->items_array,
-	     item_index,
-	     (intptr_t **) item,
+	     &number_of_items,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve list item: %d.",
-		 function,
-		 item_index );
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first item of an item list parsed relative to a parent item list
+	 * is the child of the last item of the parent item list
+	 */
+	if( ( number_of_items == 0 )
+	 && ( internal_item_list->number_of_parent_items > 0 ) )
+	{
+		if( libfwsi_internal_item_list_get_item_by_index(
+		     internal_item_list->parent_item_list,
+		     internal_item_list->number_of_parent_items - 1,
+		     &internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last item of parent item list.",
+			 function );
+
+			return( -1 );
+		}
+		parent_item      = (libfwsi_item_t *) internal_item;
+		parent_item_type = internal_item->type;
+		internal_item    = NULL;
+	}
+	while( byte_stream_size >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 byte_stream,
+		 shell_item_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
+			 function,
+			 shell_item_index,
+			 shell_item_size );
+		}
+#endif
+		if( shell_item_size > byte_stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( shell_item_size == 0 )
+		{
+			byte_stream                   += 2;
+			byte_stream_size              -= 2;
+			internal_item_list->data_size += 2;
+
+			break;
+		}
+		result = 0;
+
+		if( internal_item_list->item_cache != NULL )
+		{
+			result = libfwsi_internal_item_cache_get_item(
+			          (libfwsi_internal_item_cache_t *) internal_item_list->item_cache,
+			          byte_stream,
+			          (size_t) shell_item_size,
+			          parent_item_type,
+			          ascii_codepage,
+			          read_flags,
+			          &internal_item,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve shared shell item from item cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			if( libfwsi_internal_item_initialize(
+			     &internal_item,
+			     internal_item_list->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create shell item.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfwsi_item_set_parent_item(
+			     (libfwsi_item_t *) internal_item,
+			     parent_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set parent shell item.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_item == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: missing shell item.",
+				 function );
+
+				goto on_error;
+			}
+			internal_item->is_managed = 1;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+			internal_item->read_write_lock              = internal_item_list->read_write_lock;
+			internal_item->string_cache.read_write_lock = internal_item_list->read_write_lock;
+#endif
+
+			if( ( read_flags & LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM ) != 0 )
+			{
+				result = libfwsi_internal_item_read_byte_stream(
+				          internal_item,
+				          byte_stream,
+				          byte_stream_size,
+				          parent_item_type,
+				          ascii_codepage,
+				          read_flags,
+				          error );
+			}
+			else
+			{
+				result = libfwsi_internal_item_copy_from_byte_stream(
+				          internal_item,
+				          byte_stream,
+				          byte_stream_size,
+				          parent_item_type,
+				          ascii_codepage,
+				          read_flags,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to shell item.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		byte_stream                   += shell_item_size;
+		byte_stream_size              -= shell_item_size;
+		internal_item_list->data_size += (size_t) shell_item_size;
+
+		if( libcdata_array_append_entry(
+		     internal_item_list->items_array,
+		     &item_list_index,
+		     (intptr_t *) internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append shell item: %d.",
+			 function,
+			 shell_item_index );
+
+			goto on_error;
+		}
+		parent_item      = (libfwsi_item_t *) internal_item;
+		parent_item_type = internal_item->type;
+		internal_item    = NULL;
+
+		shell_item_index++;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	internal_item_list->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( internal_item != NULL )
+	{
+		libfwsi_internal_item_release(
+		 &internal_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_data_size(
+     libfwsi_item_list_t *item_list,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_data_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_item_list->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * The number of items includes the items of the parent item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_number_of_items(
+     libfwsi_internal_item_list_t *internal_item_list,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_list_get_number_of_items";
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_items += internal_item_list->number_of_parent_items;
+
+	return( 1 );
+}
+
+/* Retrieves a specific item
+ * Items with an index below the number of parent items are retrieved from the parent item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_item_by_index(
+     libfwsi_internal_item_list_t *internal_item_list,
+     int item_index,
+     libfwsi_internal_item_t **internal_item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_list_get_item_by_index";
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( internal_item_list->parent_item_list != NULL )
+	    && ( item_index >= 0 )
+	    && ( item_index < internal_item_list->number_of_parent_items ) )
+	{
+		internal_item_list = internal_item_list->parent_item_list;
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_item_list->items_array,
+	     item_index - internal_item_list->number_of_parent_items,
+	     (intptr_t **) internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * The number of items includes the items of the parent item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_number_of_items(
+     libfwsi_item_list_t *item_list,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_get_number_of_items";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_get_item";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_item_by_index(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     item_index,
+	     (libfwsi_internal_item_t **) item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the 64-bit hash of the items
+ * The hash is calculated over the 64-bit hashes of the items, including the items
+ * of the parent item list, which are stored in little-endian
+ * compare_flags can contain LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES to combine
+ * the hashes of the items without the volatile values
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_hash(
+     libfwsi_item_list_t *item_list,
+     uint8_t compare_flags,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libfwsi_hash_context_t hash_context;
+
+	uint8_t item_hash_data[ 8 ];
+
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_list_get_hash";
+	uint64_t item_hash                     = 0;
+	int item_index                         = 0;
+	int number_of_items                    = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_flags & ~( LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_hash_context_clear(
+	     &hash_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear hash context.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libfwsi_internal_item_list_get_item_by_index(
+		     (libfwsi_internal_item_list_t *) item_list,
+		     item_index,
+		     &internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( libfwsi_item_get_hash(
+		     (libfwsi_item_t *) internal_item,
+		     compare_flags,
+		     &item_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 item_hash_data,
+		 item_hash );
+
+		if( libfwsi_hash_context_update(
+		     &hash_context,
+		     item_hash_data,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwsi_hash_context_finalize(
+	     &hash_context,
+	     hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize hash context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of leading items two item lists have in common
+ * Items of a parent item list that is shared by both item lists are not compared
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_common_prefix_length(
+     libfwsi_internal_item_list_t *first_internal_item_list,
+     libfwsi_internal_item_list_t *second_internal_item_list,
+     uint8_t compare_flags,
+     int *common_prefix_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *first_internal_item  = NULL;
+	libfwsi_internal_item_t *second_internal_item = NULL;
+	static char *function                         = "libfwsi_internal_item_list_get_common_prefix_length";
+	int first_number_of_items                     = 0;
+	int item_index                                = 0;
+	int number_of_items                           = 0;
+	int result                                    = 0;
+	int second_number_of_items                    = 0;
+
+	if( first_internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( common_prefix_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid common prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     first_internal_item_list,
+	     &first_number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items of first item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     second_internal_item_list,
+	     &second_number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items of second item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_number_of_items <= second_number_of_items )
+	{
+		number_of_items = first_number_of_items;
+	}
+	else
+	{
+		number_of_items = second_number_of_items;
+	}
+	/* Items that originate from the same item list do not need to be compared
+	 */
+	if( first_internal_item_list == second_internal_item_list )
+	{
+		item_index = number_of_items;
+	}
+	else if( second_internal_item_list->parent_item_list == first_internal_item_list )
+	{
+		item_index = second_internal_item_list->number_of_parent_items;
+	}
+	else if( first_internal_item_list->parent_item_list == second_internal_item_list )
+	{
+		item_index = first_internal_item_list->number_of_parent_items;
+	}
+	else if( ( first_internal_item_list->parent_item_list != NULL )
+	      && ( first_internal_item_list->parent_item_list == second_internal_item_list->parent_item_list ) )
+	{
+		item_index = first_internal_item_list->number_of_parent_items;
+	}
+	if( item_index > number_of_items )
+	{
+		item_index = number_of_items;
+	}
+	while( item_index < number_of_items )
+	{
+		if( libfwsi_internal_item_list_get_item_by_index(
+		     first_internal_item_list,
+		     item_index,
+		     &first_internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d of first item list.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( libfwsi_internal_item_list_get_item_by_index(
+		     second_internal_item_list,
+		     item_index,
+		     &second_internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d of second item list.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		result = libfwsi_internal_item_is_equal(
+		          first_internal_item,
+		          second_internal_item,
+		          compare_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		item_index++;
+	}
+	*common_prefix_length = item_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of leading items two item lists have in common
+ * compare_flags can contain LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES to compare
+ * the items without their volatile values
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_common_prefix_length(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     uint8_t compare_flags,
+     int *common_prefix_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_get_common_prefix_length";
+
+	if( ( compare_flags & ~( LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_common_prefix_length(
+	     (libfwsi_internal_item_list_t *) first_item_list,
+	     (libfwsi_internal_item_list_t *) second_item_list,
+	     compare_flags,
+	     common_prefix_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve common prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines how two item lists relate
+ * The relation is LIBFWSI_ITEM_LIST_RELATION_ANCESTOR if all the items of the first
+ * item list are the leading items of the second item list, LIBFWSI_ITEM_LIST_RELATION_DESCENDANT
+ * for the reverse and LIBFWSI_ITEM_LIST_RELATION_DIVERGENT if both item lists contain items
+ * after their common prefix. The items that differ are the items with an index of
+ * the common prefix length or higher
+ * compare_flags can contain LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES to compare
+ * the items without their volatile values
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_diff(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     uint8_t compare_flags,
+     int *relation,
+     int *common_prefix_length,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfwsi_item_list_diff";
+	int first_number_of_items  = 0;
+	int second_number_of_items = 0;
+	int safe_prefix_length     = 0;
+
+	if( ( compare_flags & ~( LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( relation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relation.",
+		 function );
+
+		return( -1 );
+	}
+	if( common_prefix_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid common prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_common_prefix_length(
+	     (libfwsi_internal_item_list_t *) first_item_list,
+	     (libfwsi_internal_item_list_t *) second_item_list,
+	     compare_flags,
+	     &safe_prefix_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve common prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     (libfwsi_internal_item_list_t *) first_item_list,
+	     &first_number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items of first item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     (libfwsi_internal_item_list_t *) second_item_list,
+	     &second_number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items of second item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( safe_prefix_length == first_number_of_items )
+	 && ( safe_prefix_length == second_number_of_items ) )
+	{
+		*relation = LIBFWSI_ITEM_LIST_RELATION_EQUAL;
+	}
+	else if( safe_prefix_length == first_number_of_items )
+	{
+		*relation = LIBFWSI_ITEM_LIST_RELATION_ANCESTOR;
+	}
+	else if( safe_prefix_length == second_number_of_items )
+	{
+		*relation = LIBFWSI_ITEM_LIST_RELATION_DESCENDANT;
+	}
+	else
+	{
+		*relation = LIBFWSI_ITEM_LIST_RELATION_DIVERGENT;
+	}
+	*common_prefix_length = safe_prefix_length;
+
+	return( 1 );
+}
+
+/* Appends a timestamp to the timestamps
+ * A FAT date time of 0 is not set and is not appended
+ * The timestamp is only stored if it fits within maximum_number_of_timestamps,
+ * but number_of_timestamps is always incremented
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_append_timestamp(
+     libfwsi_timestamp_t *timestamps,
+     int maximum_number_of_timestamps,
+     int *number_of_timestamps,
+     int item_index,
+     uint8_t timestamp_type,
+     uint32_t fat_date_time,
+     libcerror_error_t **error )
+{
+	libfwsi_timestamp_t *timestamp = NULL;
+	static char *function          = "libfwsi_internal_item_list_append_timestamp";
+
+	if( number_of_timestamps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of timestamps.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_timestamps == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of timestamps value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fat_date_time == 0 )
+	{
+		return( 1 );
+	}
+	if( *number_of_timestamps < maximum_number_of_timestamps )
+	{
+		if( timestamps == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid timestamps.",
+			 function );
+
+			return( -1 );
+		}
+		timestamp = &( timestamps[ *number_of_timestamps ] );
+
+		timestamp->item_index    = item_index;
+		timestamp->type          = timestamp_type;
+		timestamp->fat_date_time = fat_date_time;
+
+		/* An invalid FAT date time results in a FILETIME of 0
+		 */
+		if( libfwsi_fat_date_times_copy_to_filetimes(
+		     &fat_date_time,
+		     1,
+		     &( timestamp->filetime ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy FAT date time to FILETIME.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*number_of_timestamps += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the timestamps of the items in one pass
+ * The timestamps are the file entry modification time and the file entry extension
+ * (0xbeef0004) creation and access times that are set, in item order
+ * At most maximum_number_of_timestamps timestamps are stored, number_of_timestamps
+ * is set to the number of timestamps of the items, which can be larger
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_timestamps(
+     libfwsi_item_list_t *item_list,
+     libfwsi_timestamp_t *timestamps,
+     int maximum_number_of_timestamps,
+     int *number_of_timestamps,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	libfwsi_file_entry_values_t *file_entry_values                     = NULL;
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_internal_item_t *internal_item                             = NULL;
+	static char *function                                              = "libfwsi_item_list_get_timestamps";
+	int item_index                                                     = 0;
+	int number_of_items                                                = 0;
+	int safe_number_of_timestamps                                      = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_timestamps < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of timestamps value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( timestamps == NULL )
+	 && ( maximum_number_of_timestamps > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamps.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_timestamps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of timestamps.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_number_of_items(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libfwsi_internal_item_list_get_item_by_index(
+		     (libfwsi_internal_item_list_t *) item_list,
+		     item_index,
+		     &internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( libfwsi_internal_item_read_values(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read values of list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( ( internal_item->type == LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+		 && ( internal_item->value != NULL ) )
+		{
+			file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+			if( libfwsi_internal_item_list_append_timestamp(
+			     timestamps,
+			     maximum_number_of_timestamps,
+			     &safe_number_of_timestamps,
+			     item_index,
+			     LIBFWSI_TIMESTAMP_TYPE_MODIFICATION_TIME,
+			     file_entry_values->modification_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append modification time of list item: %d.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+		}
+		internal_extension_block = internal_item->first_extension_block;
+
+		while( internal_extension_block != NULL )
+		{
+			if( ( internal_extension_block->signature == 0xbeef0004UL )
+			 && ( internal_extension_block->value != NULL ) )
+			{
+				file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+				if( libfwsi_internal_item_list_append_timestamp(
+				     timestamps,
+				     maximum_number_of_timestamps,
+				     &safe_number_of_timestamps,
+				     item_index,
+				     LIBFWSI_TIMESTAMP_TYPE_CREATION_TIME,
+				     file_entry_extension_values->creation_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append creation time of list item: %d.",
+					 function,
+					 item_index );
+
+					return( -1 );
+				}
+				if( libfwsi_internal_item_list_append_timestamp(
+				     timestamps,
+				     maximum_number_of_timestamps,
+				     &safe_number_of_timestamps,
+				     item_index,
+				     LIBFWSI_TIMESTAMP_TYPE_ACCESS_TIME,
+				     file_entry_extension_values->access_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append access time of list item: %d.",
+					 function,
+					 item_index );
+
+					return( -1 );
+				}
+			}
+			internal_extension_block = internal_extension_block->next_extension_block;
+		}
+	}
+	*number_of_timestamps = safe_number_of_timestamps;
+
+	return( 1 );
+}
+
+/* Appends the UTF-8 formatted path segments of the items to an UTF-8 string
+ * The path of a parent item list is derived from its cached path when the default
+ * path separator and flags are used
+ * If utf8_string is NULL only the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_append_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint8_t *has_trailing_separator,
+     libcerror_error_t **error )
+{
+	libfwsi_path_segment_t path_segment;
+
+	libfwsi_internal_item_t *internal_item = NULL;
+	const uint8_t *parent_path                = NULL;
+	static char *function                  = "libfwsi_internal_item_list_append_utf8_path";
+	size_t parent_path_length              = 0;
+	size_t path_segment_size               = 0;
+	size_t string_index                    = 0;
+	uint8_t last_character                 = 0;
+	int item_index                         = 0;
+	int number_of_items                    = 0;
+	int result                             = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_trailing_separator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has trailing separator.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = *utf8_string_index;
+
+	if( internal_item_list->parent_item_list != NULL )
+	{
+		if( ( path_separator == (uint8_t) '\\' )
+		 && ( path_flags == 0 ) )
+		{
+			if( libfwsi_string_cache_get_utf8_string(
+			     &( internal_item_list->parent_item_list->string_cache ),
+			     LIBFWSI_STRING_CACHE_INDEX_PATH,
+			     (intptr_t *) internal_item_list->parent_item_list,
+			     (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf8_path_size,
+			     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf8_path,
+			     &parent_path,
+			     &parent_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cached UTF-8 path of parent item list.",
+				 function );
+
+				return( -1 );
+			}
+			if( utf8_string != NULL )
+			{
+				if( parent_path_length >= ( utf8_string_size - string_index ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( memory_copy(
+				     &( utf8_string[ string_index ] ),
+				     parent_path,
+				     sizeof( uint8_t ) * parent_path_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy parent path to UTF-8 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			string_index += parent_path_length;
+
+			if( parent_path_length > 0 )
+			{
+				last_character = parent_path[ parent_path_length - 1 ];
+
+				if( ( last_character == (uint8_t) '\\' )
+				 || ( last_character == (uint8_t) '/' ) )
+				{
+					*has_trailing_separator = 1;
+				}
+				else
+				{
+					*has_trailing_separator = 0;
+				}
+			}
+		}
+		else if( libfwsi_internal_item_list_append_utf8_path(
+		          internal_item_list->parent_item_list,
+		          path_separator,
+		          path_flags,
+		          utf8_string,
+		          utf8_string_size,
+		          &string_index,
+		          has_trailing_separator,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append UTF-8 path of parent item list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_item_list->items_array,
+		     item_index,
+		     (intptr_t **) &internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		result = libfwsi_path_segment_set_from_item(
+		          &path_segment,
+		          internal_item,
+		          path_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment of list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libfwsi_path_segment_get_utf8_string_size(
+		     &path_segment,
+		     &path_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment size of list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( path_segment_size <= 1 )
+		{
+			continue;
+		}
+		if( *has_trailing_separator == 0 )
+		{
+			if( utf8_string != NULL )
+			{
+				if( ( string_index + 1 ) >= utf8_string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				utf8_string[ string_index ] = path_separator;
+			}
+			string_index++;
+		}
+		if( utf8_string != NULL )
+		{
+			if( path_segment_size > ( utf8_string_size - string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwsi_path_segment_copy_to_utf8_string(
+			     &path_segment,
+			     &( utf8_string[ string_index ] ),
+			     utf8_string_size - string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy path segment of list item: %d.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+		}
+		/* The end-of-string character of the path segment is overwritten by the next path separator
+		 */
+		string_index += path_segment_size - 1;
+
+		*has_trailing_separator = (uint8_t) libfwsi_path_segment_has_trailing_separator(
+		                                     &path_segment,
+		                                     (uint16_t) path_separator );
+	}
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted path
+ * If utf8_string is NULL only the size of the path is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_path_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfwsi_internal_item_list_get_utf8_path";
+	size_t string_index            = 0;
+	uint8_t has_trailing_separator = 1;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_separator == 0 )
+	{
+		path_separator = (uint8_t) '\\';
+	}
+	else if( path_separator >= 0x80 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_append_utf8_path(
+	     internal_item_list,
+	     path_separator,
+	     path_flags,
+	     utf8_string,
+	     utf8_string_size,
+	     &string_index,
+	     &has_trailing_separator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != NULL )
+	{
+		if( string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index ] = 0;
+	}
+	*utf8_path_size = string_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 formatted path using the default path separator and flags
+ * This function is used as the string getter function of the string cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_default_utf8_path_size(
+     libfwsi_internal_item_list_t *internal_item_list,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	return( libfwsi_internal_item_list_get_utf8_path(
+	         internal_item_list,
+	         0,
+	         0,
+	         NULL,
+	         0,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the UTF-8 formatted path using the default path separator and flags
+ * This function is used as the string getter function of the string cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_default_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_internal_item_list_get_default_utf8_path";
+	size_t utf8_path_size  = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( libfwsi_internal_item_list_get_utf8_path(
+	         internal_item_list,
+	         0,
+	         0,
+	         utf8_string,
+	         utf8_string_size,
+	         &utf8_path_size,
+	         error ) );
+}
+
+/* Retrieves the size of the UTF-8 formatted path
+ * The size includes the end of string character
+ * A path_separator of 0 represents the default path separator: '\\'
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf8_path_size(
+     libfwsi_item_list_t *item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_utf8_path_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( libfwsi_internal_item_list_get_utf8_path(
+	     internal_item_list,
+	     path_separator,
+	     path_flags,
+	     NULL,
+	     0,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted path
+ * The path consists of the names of the items, such as the root folder, volume and file entry names, joined by the path separator
+ * The size should include the end of string character
+ * A path_separator of 0 represents the default path separator: '\\'
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf8_path(
+     libfwsi_item_list_t *item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_utf8_path";
+	size_t utf8_path_size                            = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_utf8_path(
+	     internal_item_list,
+	     path_separator,
+	     path_flags,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cached UTF-8 formatted path using the default path separator and flags
+ * The path is formatted on first use and remains valid until the item list is reset or freed
+ * The path of an item list parsed relative to a parent item list is derived from the cached path of the parent
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_cached_utf8_path(
+     libfwsi_item_list_t *item_list,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_cached_utf8_path";
+	int result                                       = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item_list->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_PATH,
+	          (intptr_t *) internal_item_list,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf8_path_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf8_path,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the UTF-16 formatted path segments of the items to an UTF-16 string
+ * The path of a parent item list is derived from its cached path when the default
+ * path separator and flags are used
+ * If utf16_string is NULL only the UTF-16 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_append_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint8_t *has_trailing_separator,
+     libcerror_error_t **error )
+{
+	libfwsi_path_segment_t path_segment;
+
+	libfwsi_internal_item_t *internal_item = NULL;
+	const uint16_t *parent_path                = NULL;
+	static char *function                  = "libfwsi_internal_item_list_append_utf16_path";
+	size_t parent_path_length              = 0;
+	size_t path_segment_size               = 0;
+	size_t string_index                    = 0;
+	uint16_t last_character                = 0;
+	int item_index                         = 0;
+	int number_of_items                    = 0;
+	int result                             = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_trailing_separator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has trailing separator.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = *utf16_string_index;
+
+	if( internal_item_list->parent_item_list != NULL )
+	{
+		if( ( path_separator == (uint16_t) '\\' )
+		 && ( path_flags == 0 ) )
+		{
+			if( libfwsi_string_cache_get_utf16_string(
+			     &( internal_item_list->parent_item_list->string_cache ),
+			     LIBFWSI_STRING_CACHE_INDEX_PATH,
+			     (intptr_t *) internal_item_list->parent_item_list,
+			     (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf16_path_size,
+			     (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf16_path,
+			     &parent_path,
+			     &parent_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cached UTF-16 path of parent item list.",
+				 function );
+
+				return( -1 );
+			}
+			if( utf16_string != NULL )
+			{
+				if( parent_path_length >= ( utf16_string_size - string_index ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-16 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( memory_copy(
+				     &( utf16_string[ string_index ] ),
+				     parent_path,
+				     sizeof( uint16_t ) * parent_path_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy parent path to UTF-16 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			string_index += parent_path_length;
+
+			if( parent_path_length > 0 )
+			{
+				last_character = parent_path[ parent_path_length - 1 ];
+
+				if( ( last_character == (uint16_t) '\\' )
+				 || ( last_character == (uint16_t) '/' ) )
+				{
+					*has_trailing_separator = 1;
+				}
+				else
+				{
+					*has_trailing_separator = 0;
+				}
+			}
+		}
+		else if( libfwsi_internal_item_list_append_utf16_path(
+		          internal_item_list->parent_item_list,
+		          path_separator,
+		          path_flags,
+		          utf16_string,
+		          utf16_string_size,
+		          &string_index,
+		          has_trailing_separator,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append UTF-16 path of parent item list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_item_list->items_array,
+		     item_index,
+		     (intptr_t **) &internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		result = libfwsi_path_segment_set_from_item(
+		          &path_segment,
+		          internal_item,
+		          path_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment of list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libfwsi_path_segment_get_utf16_string_size(
+		     &path_segment,
+		     &path_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment size of list item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( path_segment_size <= 1 )
+		{
+			continue;
+		}
+		if( *has_trailing_separator == 0 )
+		{
+			if( utf16_string != NULL )
+			{
+				if( ( string_index + 1 ) >= utf16_string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-16 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				utf16_string[ string_index ] = path_separator;
+			}
+			string_index++;
+		}
+		if( utf16_string != NULL )
+		{
+			if( path_segment_size > ( utf16_string_size - string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwsi_path_segment_copy_to_utf16_string(
+			     &path_segment,
+			     &( utf16_string[ string_index ] ),
+			     utf16_string_size - string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy path segment of list item: %d.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+		}
+		/* The end-of-string character of the path segment is overwritten by the next path separator
+		 */
+		string_index += path_segment_size - 1;
+
+		*has_trailing_separator = (uint8_t) libfwsi_path_segment_has_trailing_separator(
+		                                     &path_segment,
+		                                     (uint16_t) path_separator );
+	}
+	*utf16_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted path
+ * If utf16_string is NULL only the size of the path is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_path_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfwsi_internal_item_list_get_utf16_path";
+	size_t string_index            = 0;
+	uint8_t has_trailing_separator = 1;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_separator == 0 )
+	{
+		path_separator = (uint16_t) '\\';
+	}
+	if( libfwsi_internal_item_list_append_utf16_path(
+	     internal_item_list,
+	     path_separator,
+	     path_flags,
+	     utf16_string,
+	     utf16_string_size,
+	     &string_index,
+	     &has_trailing_separator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UTF-16 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string != NULL )
+	{
+		if( string_index >= utf16_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ string_index ] = 0;
+	}
+	*utf16_path_size = string_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted path using the default path separator and flags
+ * This function is used as the string getter function of the string cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_default_utf16_path_size(
+     libfwsi_internal_item_list_t *internal_item_list,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	return( libfwsi_internal_item_list_get_utf16_path(
+	         internal_item_list,
+	         0,
+	         0,
+	         NULL,
+	         0,
+	         utf16_string_size,
+	         error ) );
+}
+
+/* Retrieves the UTF-16 formatted path using the default path separator and flags
+ * This function is used as the string getter function of the string cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_default_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_internal_item_list_get_default_utf16_path";
+	size_t utf16_path_size = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( libfwsi_internal_item_list_get_utf16_path(
+	         internal_item_list,
+	         0,
+	         0,
+	         utf16_string,
+	         utf16_string_size,
+	         &utf16_path_size,
+	         error ) );
+}
+
+/* Retrieves the size of the UTF-16 formatted path
+ * The size includes the end of string character
+ * A path_separator of 0 represents the default path separator: '\\'
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf16_path_size(
+     libfwsi_item_list_t *item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_utf16_path_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( libfwsi_internal_item_list_get_utf16_path(
+	     internal_item_list,
+	     path_separator,
+	     path_flags,
+	     NULL,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted path
+ * The path consists of the names of the items, such as the root folder, volume and file entry names, joined by the path separator
+ * The size should include the end of string character
+ * A path_separator of 0 represents the default path separator: '\\'
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf16_path(
+     libfwsi_item_list_t *item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_utf16_path";
+	size_t utf16_path_size                           = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_utf16_path(
+	     internal_item_list,
+	     path_separator,
+	     path_flags,
+	     utf16_string,
+	     utf16_string_size,
+	     &utf16_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cached UTF-16 formatted path using the default path separator and flags
+ * The path is formatted on first use and remains valid until the item list is reset or freed
+ * The path of an item list parsed relative to a parent item list is derived from the cached path of the parent
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_cached_utf16_path(
+     libfwsi_item_list_t *item_list,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_cached_utf16_path";
+	int result                                       = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item_list->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_PATH,
+	          (intptr_t *) internal_item_list,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf16_path_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_internal_item_list_get_default_utf16_path,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 path.",
+		 function );
 
 		return( -1 );
 	}
@@ -25,9 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_extern.h"
+#include "libfwsi_item.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
@@ -49,6 +53,33 @@ struct libfwsi_internal_item_list
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The arena the items are allocated from
+	 */
+	libfwsi_arena_t *arena;
+
+	/* The item cache that shares the items, NULL if not set
+	 */
+	libfwsi_item_cache_t *item_cache;
+
+	/* The parent item list, NULL if not set
+	 * The items of the parent item list form the prefix of the items of the item list
+	 */
+	libfwsi_internal_item_list_t *parent_item_list;
+
+	/* The number of items of the parent item list
+	 */
+	int number_of_parent_items;
+
+	/* The decoded string cache
+	 */
+	libfwsi_string_cache_t string_cache;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBFWSI_EXTERN \
@@ -69,12 +100,78 @@ int libfwsi_item_list_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parse_borrowed(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parse(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_reset(
+     libfwsi_item_list_t *item_list,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_reparse(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parse_with_parent(
+     libfwsi_item_list_t *item_list,
+     libfwsi_item_list_t *parent_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_set_item_cache(
+     libfwsi_item_list_t *item_list,
+     libfwsi_item_cache_t *item_cache,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_read_byte_stream(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_get_data_size(
      libfwsi_item_list_t *item_list,
      size_t *data_size,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_list_get_number_of_items(
+     libfwsi_internal_item_list_t *internal_item_list,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_item_by_index(
+     libfwsi_internal_item_list_t *internal_item_list,
+     int item_index,
+     libfwsi_internal_item_t **internal_item,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_get_number_of_items(
      libfwsi_item_list_t *item_list,
@@ -88,6 +185,162 @@ int libfwsi_item_list_get_item(
      libfwsi_item_t **item,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_hash(
+     libfwsi_item_list_t *item_list,
+     uint8_t compare_flags,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_common_prefix_length(
+     libfwsi_internal_item_list_t *first_internal_item_list,
+     libfwsi_internal_item_list_t *second_internal_item_list,
+     uint8_t compare_flags,
+     int *common_prefix_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_common_prefix_length(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     uint8_t compare_flags,
+     int *common_prefix_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_diff(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     uint8_t compare_flags,
+     int *relation,
+     int *common_prefix_length,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_append_timestamp(
+     libfwsi_timestamp_t *timestamps,
+     int maximum_number_of_timestamps,
+     int *number_of_timestamps,
+     int item_index,
+     uint8_t timestamp_type,
+     uint32_t fat_date_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_timestamps(
+     libfwsi_item_list_t *item_list,
+     libfwsi_timestamp_t *timestamps,
+     int maximum_number_of_timestamps,
+     int *number_of_timestamps,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_append_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint8_t *has_trailing_separator,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_path_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_default_utf8_path_size(
+     libfwsi_internal_item_list_t *internal_item_list,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_default_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf8_path_size(
+     libfwsi_item_list_t *item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf8_path(
+     libfwsi_item_list_t *item_list,
+     uint8_t path_separator,
+     uint8_t path_flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_cached_utf8_path(
+     libfwsi_item_list_t *item_list,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_append_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint8_t *has_trailing_separator,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_path_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_default_utf16_path_size(
+     libfwsi_internal_item_list_t *internal_item_list,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_default_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf16_path_size(
+     libfwsi_item_list_t *item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf16_path(
+     libfwsi_item_list_t *item_list,
+     uint16_t path_separator,
+     uint8_t path_flags,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_cached_utf16_path(
+     libfwsi_item_list_t *item_list,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
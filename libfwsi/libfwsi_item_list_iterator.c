@@ -0,0 +1,431 @@
+/*
+ * Shell item list iterator functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_list_iterator.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_types.h"
+
+/* Creates an item list iterator
+ * Make sure the value iterator is referencing, is set to NULL
+ * The iterator references the byte stream, which must remain available and unmodified
+ * while the iterator and the items it returns are in use
+ * parse_flags can contain LIBFWSI_PARSE_FLAG_DEFER_DECODING, the byte stream is always borrowed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_iterator_initialize(
+     libfwsi_item_list_iterator_t **iterator,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_iterator_t *internal_iterator = NULL;
+	static char *function                                    = "libfwsi_item_list_iterator_initialize";
+
+	if( iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parse_flags & ~( LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported parse flags.",
+		 function );
+
+		return( -1 );
+	}
+	internal_iterator = memory_allocate_structure(
+	                     libfwsi_internal_item_list_iterator_t );
+
+	if( internal_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_iterator,
+	     0,
+	     sizeof( libfwsi_internal_item_list_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear iterator.",
+		 function );
+
+		memory_free(
+		 internal_iterator );
+
+		return( -1 );
+	}
+	/* The item is allocated on the heap and its values are freed
+	 * when the next shell item is read, hence memory use does not
+	 * depend on the number of shell items in the list
+	 */
+	if( libfwsi_internal_item_initialize(
+	     &( internal_iterator->item ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item.",
+		 function );
+
+		goto on_error;
+	}
+	internal_iterator->item->is_managed = 1;
+
+	internal_iterator->byte_stream      = byte_stream;
+	internal_iterator->byte_stream_size = byte_stream_size;
+	internal_iterator->ascii_codepage   = ascii_codepage;
+	internal_iterator->parse_flags      = parse_flags | LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM;
+	internal_iterator->parent_item_type = LIBFWSI_ITEM_TYPE_UNKNOWN;
+
+	*iterator = (libfwsi_item_list_iterator_t *) internal_iterator;
+
+	return( 1 );
+
+on_error:
+	if( internal_iterator != NULL )
+	{
+		memory_free(
+		 internal_iterator );
+	}
+	return( -1 );
+}
+
+/* Frees an item list iterator
+ * Items returned by the iterator can no longer be used after the iterator is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_iterator_free(
+     libfwsi_item_list_iterator_t **iterator,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_iterator_t *internal_iterator = NULL;
+	static char *function                                    = "libfwsi_item_list_iterator_free";
+	int result                                               = 1;
+
+	if( iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *iterator != NULL )
+	{
+		internal_iterator = (libfwsi_internal_item_list_iterator_t *) *iterator;
+		*iterator         = NULL;
+
+		if( libfwsi_internal_item_free(
+		     &( internal_iterator->item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_iterator );
+	}
+	return( result );
+}
+
+/* Retrieves the next shell item
+ * The item is owned by the iterator and is overwritten by the next call
+ * Returns 1 if successful, 0 if no more items are available or -1 on error
+ */
+int libfwsi_item_list_iterator_next(
+     libfwsi_item_list_iterator_t *iterator,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_iterator_t *internal_iterator = NULL;
+	static char *function                                    = "libfwsi_item_list_iterator_next";
+	size_t remaining_size                                    = 0;
+	uint16_t shell_item_size                                 = 0;
+
+	if( iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_iterator = (libfwsi_internal_item_list_iterator_t *) iterator;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	*item = NULL;
+
+	if( internal_iterator->is_finished != 0 )
+	{
+		return( 0 );
+	}
+	if( libfwsi_internal_item_clear(
+	     internal_iterator->item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear item.",
+		 function );
+
+		goto on_error;
+	}
+	remaining_size = internal_iterator->byte_stream_size - internal_iterator->byte_stream_offset;
+
+	if( remaining_size < 2 )
+	{
+		internal_iterator->is_finished = 1;
+
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( internal_iterator->byte_stream[ internal_iterator->byte_stream_offset ] ),
+	 shell_item_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: shell item at offset: %" PRIzd " size\t: %" PRIu16 "\n",
+		 function,
+		 internal_iterator->byte_stream_offset,
+		 shell_item_size );
+	}
+#endif
+	if( (size_t) shell_item_size > remaining_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shell item size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( shell_item_size == 0 )
+	{
+		internal_iterator->byte_stream_offset += 2;
+		internal_iterator->is_finished         = 1;
+
+		return( 0 );
+	}
+	if( libfwsi_internal_item_read_byte_stream(
+	     internal_iterator->item,
+	     &( internal_iterator->byte_stream[ internal_iterator->byte_stream_offset ] ),
+	     remaining_size,
+	     internal_iterator->parent_item_type,
+	     internal_iterator->ascii_codepage,
+	     internal_iterator->parse_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read shell item at offset: %" PRIzd ".",
+		 function,
+		 internal_iterator->byte_stream_offset );
+
+		goto on_error;
+	}
+	internal_iterator->byte_stream_offset += (size_t) shell_item_size;
+	internal_iterator->parent_item_type    = internal_iterator->item->type;
+
+	*item = (libfwsi_item_t *) internal_iterator->item;
+
+	return( 1 );
+
+on_error:
+	/* Do not continue after a corrupted shell item
+	 */
+	internal_iterator->is_finished = 1;
+
+	return( -1 );
+}
+
+/* Retrieves the offset of the next shell item relative to the start of the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_iterator_get_offset(
+     libfwsi_item_list_iterator_t *iterator,
+     size_t *offset,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_iterator_t *internal_iterator = NULL;
+	static char *function                                    = "libfwsi_item_list_iterator_get_offset";
+
+	if( iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_iterator = (libfwsi_internal_item_list_iterator_t *) iterator;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_iterator->byte_stream_offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Shell item list iterator functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ITEM_LIST_ITERATOR_H )
+#define _LIBFWSI_ITEM_LIST_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_internal_item_list_iterator libfwsi_internal_item_list_iterator_t;
+
+struct libfwsi_internal_item_list_iterator
+{
+	/* The byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The current offset in the byte stream
+	 */
+	size_t byte_stream_offset;
+
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The parse flags
+	 */
+	uint8_t parse_flags;
+
+	/* The item that is reused for every shell item in the list
+	 */
+	libfwsi_internal_item_t *item;
+
+	/* The item type of the previous shell item, used as the parent item type
+	 */
+	int parent_item_type;
+
+	/* Value to indicate the terminator or the end of the byte stream was reached
+	 */
+	uint8_t is_finished;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_iterator_initialize(
+     libfwsi_item_list_iterator_t **iterator,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_iterator_free(
+     libfwsi_item_list_iterator_t **iterator,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_iterator_next(
+     libfwsi_item_list_iterator_t *iterator,
+     libfwsi_item_t **item,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_iterator_get_offset(
+     libfwsi_item_list_iterator_t *iterator,
+     size_t *offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ITEM_LIST_ITERATOR_H ) */
+
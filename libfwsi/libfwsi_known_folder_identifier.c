@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -466,329 +467,394 @@ uint8_t libfwsi_known_folder_identifier_unknown[ 16 ] = {
 	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
 
 /* The known folder identifiers
+ * The definitions are sorted by identifier byte value, the unknown identifier is used as terminator
  */
 libfwsi_known_folder_identifier_definition_t libfwsi_known_folder_identifier_definitions[ ] = {
-
-	{ libfwsi_known_folder_identifier_3d_objects,
-	  "3D Objects" },
-	{ libfwsi_known_folder_identifier_accountpictures,
-	  "Account Pictures" },
-	{ libfwsi_known_folder_identifier_addnewprogramsfolder,
-	  "Get Programs" },
-	{ libfwsi_known_folder_identifier_administrative_tools,
-	  "Administrative Tools" },
-	{ libfwsi_known_folder_identifier_appdata,
-	  "Roaming" },
-	{ libfwsi_known_folder_identifier_appdatadesktop,
-	  "AppDataDesktop" },
+	{ libfwsi_known_folder_identifier_searches,
+	  "Searches" },
+	{ libfwsi_known_folder_identifier_windows,
+	  "Windows" },
+	{ libfwsi_known_folder_identifier_programfilescommon,
+	  "Common Files" },
+	{ libfwsi_known_folder_identifier_musiclibrary,
+	  "Music" },
+	{ libfwsi_known_folder_identifier_publiclibraries,
+	  "Libraries" },
+	{ libfwsi_known_folder_identifier_common_desktop,
+	  "Public Desktop" },
 	{ libfwsi_known_folder_identifier_appdatadocuments,
 	  "AppDataDocuments" },
-	{ libfwsi_known_folder_identifier_appdatafavorites,
-	  "AppDataFavorites" },
-	{ libfwsi_known_folder_identifier_appdataprogramdata,
-	  "AppDataProgramData" },
-	{ libfwsi_known_folder_identifier_application_shortcuts,
-	  "Application Shortcuts" },
-	{ libfwsi_known_folder_identifier_appmods,
-	  "AppMods" },
-	{ libfwsi_known_folder_identifier_appsfolder,
-	  "Applications" },
-	{ libfwsi_known_folder_identifier_appupdatesfolder,
-	  "Installed Updates" },
-	{ libfwsi_known_folder_identifier_cache,
-	  "Temporary Internet Files" },
-	{ libfwsi_known_folder_identifier_camera_roll,
-	  "Camera Roll" },
-	{ libfwsi_known_folder_identifier_camerarolllibrary,
-	  "CameraRollLibrary" },
-	{ libfwsi_known_folder_identifier_captures,
-	  "Captures" },
 	{ libfwsi_known_folder_identifier_cd_burning,
 	  "Temporary Burn Folder" },
-	{ libfwsi_known_folder_identifier_changeremoveprogramsfolder,
-	  "Programs and Features" },
-	{ libfwsi_known_folder_identifier_common_administrative_tools,
-	  "Administrative Tools" },
-	{ libfwsi_known_folder_identifier_common_appdata,
-	  "ProgramData" },
-	{ libfwsi_known_folder_identifier_common_desktop,
-	  "Public Desktop" },
-	{ libfwsi_known_folder_identifier_common_documents,
-	  "Public Documents" },
-	{ libfwsi_known_folder_identifier_common_programs,
-	  "Programs" },
+	{ libfwsi_known_folder_identifier_onedrivecameraroll,
+	  "Camera Roll" },
+	{ libfwsi_known_folder_identifier_savedpictureslibrary,
+	  "Saved Pictures Library" },
+	{ libfwsi_known_folder_identifier_mapifolder,
+	  "Microsoft Office Outlook" },
 	{ libfwsi_known_folder_identifier_common_start_menu,
 	  "Start Menu" },
-	{ libfwsi_known_folder_identifier_common_start_menu_places,
-	  "Common Start Menu Places" },
+	{ libfwsi_known_folder_identifier_games,
+	  "Games" },
+	{ libfwsi_known_folder_identifier_my_video,
+	  "Videos" },
+	{ libfwsi_known_folder_identifier_quick_launch,
+	  "Quick Launch" },
+	{ libfwsi_known_folder_identifier_programfilescommonx86,
+	  "Common Files" },
+	{ libfwsi_known_folder_identifier_onedrivedocuments,
+	  "Documents" },
+	{ libfwsi_known_folder_identifier_3d_objects,
+	  "3D Objects" },
+	{ libfwsi_known_folder_identifier_connectionsfolder,
+	  "Network Connections" },
+	{ libfwsi_known_folder_identifier_printersfolder,
+	  "Printers" },
+	{ libfwsi_known_folder_identifier_gadgets,
+	  "Gadgets" },
+	{ libfwsi_known_folder_identifier_videoslibrary,
+	  "Videos" },
+	{ libfwsi_known_folder_identifier_my_pictures,
+	  "Pictures" },
+	{ libfwsi_known_folder_identifier_resourcedir,
+	  "Resources" },
 	{ libfwsi_known_folder_identifier_common_startup,
 	  "Startup" },
-	{ libfwsi_known_folder_identifier_common_templates,
-	  "Templates" },
-	{ libfwsi_known_folder_identifier_commondownloads,
-	  "Public Downloads" },
-	{ libfwsi_known_folder_identifier_commonmusic,
-	  "Public Music" },
-	{ libfwsi_known_folder_identifier_commonpictures,
-	  "Public Pictures" },
-	{ libfwsi_known_folder_identifier_commonringtones,
-	  "Ringtones" },
+	{ libfwsi_known_folder_identifier_publicgametasks,
+	  "GameExplorer" },
+	{ libfwsi_known_folder_identifier_syncsetupfolder,
+	  "Sync Setup" },
 	{ libfwsi_known_folder_identifier_commonvideo,
 	  "Public Videos" },
+	{ libfwsi_known_folder_identifier_desktop,
+	  "Desktop" },
+	{ libfwsi_known_folder_identifier_history,
+	  "History" },
+	{ libfwsi_known_folder_identifier_samplepictures,
+	  "Sample Pictures" },
+	{ libfwsi_known_folder_identifier_syncresultsfolder,
+	  "Sync Results" },
 	{ libfwsi_known_folder_identifier_conflictfolder,
 	  "Conflicts" },
-	{ libfwsi_known_folder_identifier_connectionsfolder,
-	  "Network Connections" },
-	{ libfwsi_known_folder_identifier_contacts,
-	  "Contacts" },
-	{ libfwsi_known_folder_identifier_controlpanelfolder,
-	  "Control Panel" },
-	{ libfwsi_known_folder_identifier_cookies,
-	  "Cookies" },
-	{ libfwsi_known_folder_identifier_credentialmanager,
-	  "CredentialManager" },
-	{ libfwsi_known_folder_identifier_cryptokeys,
-	  "CryptoKeys" },
+	{ libfwsi_known_folder_identifier_recyclebinfolder,
+	  "Recycle Bin" },
+	{ libfwsi_known_folder_identifier_onedrive,
+	  "OneDrive" },
 	{ libfwsi_known_folder_identifier_cscfolder,
 	  "Offline Files" },
+	{ libfwsi_known_folder_identifier_ringtones,
+	  "Ringtones" },
+	{ libfwsi_known_folder_identifier_common_programs,
+	  "Programs" },
+	{ libfwsi_known_folder_identifier_nethood,
+	  "Network Shortcuts" },
+	{ libfwsi_known_folder_identifier_contacts,
+	  "Contacts" },
 	{ libfwsi_known_folder_identifier_default_gadgets,
 	  "Gadgets" },
-	{ libfwsi_known_folder_identifier_desktop,
-	  "Desktop" },
-	{ libfwsi_known_folder_identifier_development_files,
-	  "Development Files" },
-	{ libfwsi_known_folder_identifier_device_metadata_store,
-	  "DeviceMetadataStore" },
-	{ libfwsi_known_folder_identifier_documentslibrary,
-	  "Documents" },
-	{ libfwsi_known_folder_identifier_downloads,
-	  "Downloads" },
-	{ libfwsi_known_folder_identifier_dpapikeys,
-	  "DpapiKeys" },
-	{ libfwsi_known_folder_identifier_favorites,
-	  "Favorites" },
-	{ libfwsi_known_folder_identifier_fonts,
-	  "Fonts" },
-	{ libfwsi_known_folder_identifier_gadgets,
-	  "Gadgets" },
-	{ libfwsi_known_folder_identifier_games,
-	  "Games" },
+	{ libfwsi_known_folder_identifier_userprogramfilescommon,
+	  "Programs" },
+	{ libfwsi_known_folder_identifier_roaming_tiles,
+	  "RoamingTiles" },
+	{ libfwsi_known_folder_identifier_local_pictures,
+	  "Local Pictures" },
+	{ libfwsi_known_folder_identifier_userslibrariesfolder,
+	  "Libraries" },
+	{ libfwsi_known_folder_identifier_cookies,
+	  "Cookies" },
+	{ libfwsi_known_folder_identifier_localizedresourcesdir,
+	  "None" },
+	{ libfwsi_known_folder_identifier_commonringtones,
+	  "Ringtones" },
 	{ libfwsi_known_folder_identifier_gametasks,
 	  "GameExplorer" },
-	{ libfwsi_known_folder_identifier_history,
-	  "History" },
-	{ libfwsi_known_folder_identifier_homegroupcurrentuserfolder,
-	  "%USERNAME%" },
+	{ libfwsi_known_folder_identifier_favorites,
+	  "Favorites" },
+	{ libfwsi_known_folder_identifier_local_videos,
+	  "Local Videos" },
+	{ libfwsi_known_folder_identifier_samplemusic,
+	  "Sample Music" },
 	{ libfwsi_known_folder_identifier_homegroupfolder,
 	  "Homegroup" },
+	{ libfwsi_known_folder_identifier_sendto,
+	  "SendTo" },
+	{ libfwsi_known_folder_identifier_publicaccountpictures,
+	  "Public Account Pictures" },
 	{ libfwsi_known_folder_identifier_implicitappshortcuts,
 	  "ImplicitAppShortcuts" },
+	{ libfwsi_known_folder_identifier_administrative_tools,
+	  "Administrative Tools" },
+	{ libfwsi_known_folder_identifier_my_music,
+	  "Music" },
+	{ libfwsi_known_folder_identifier_addnewprogramsfolder,
+	  "Get Programs" },
+	{ libfwsi_known_folder_identifier_captures,
+	  "Captures" },
+	{ libfwsi_known_folder_identifier_userprofiles,
+	  "Users" },
 	{ libfwsi_known_folder_identifier_internetfolder,
 	  "The Internet" },
-	{ libfwsi_known_folder_identifier_libraries,
-	  "Libraries" },
-	{ libfwsi_known_folder_identifier_links,
-	  "Links" },
+	{ libfwsi_known_folder_identifier_camerarolllibrary,
+	  "CameraRollLibrary" },
+	{ libfwsi_known_folder_identifier_system,
+	  "System32" },
+	{ libfwsi_known_folder_identifier_programs,
+	  "Programs" },
+	{ libfwsi_known_folder_identifier_programfilesx64,
+	  "Program Files" },
+	{ libfwsi_known_folder_identifier_appdatadesktop,
+	  "AppDataDesktop" },
+	{ libfwsi_known_folder_identifier_camera_roll,
+	  "Camera Roll" },
+	{ libfwsi_known_folder_identifier_usersfilesfolder,
+	  "UsersFilesFolder" },
+	{ libfwsi_known_folder_identifier_mycomputerfolder,
+	  "Computer" },
+	{ libfwsi_known_folder_identifier_common_administrative_tools,
+	  "Administrative Tools" },
+	{ libfwsi_known_folder_identifier_documentslibrary,
+	  "Documents" },
+	{ libfwsi_known_folder_identifier_application_shortcuts,
+	  "Application Shortcuts" },
+	{ libfwsi_known_folder_identifier_recent,
+	  "Recent Items" },
+	{ libfwsi_known_folder_identifier_screenshots,
+	  "Screenshots" },
+	{ libfwsi_known_folder_identifier_savedpictures,
+	  "Saved Pictures" },
+	{ libfwsi_known_folder_identifier_common_appdata,
+	  "ProgramData" },
 	{ libfwsi_known_folder_identifier_local_appdata,
 	  "Local" },
-	{ libfwsi_known_folder_identifier_local_documents,
-	  "Local Documents" },
-	{ libfwsi_known_folder_identifier_local_downloads,
-	  "Local Downloads" },
+	{ libfwsi_known_folder_identifier_thispcdesktopfolder,
+	  "ThisPCDesktopFolder" },
+	{ libfwsi_known_folder_identifier_commonpictures,
+	  "Public Pictures" },
+	{ libfwsi_known_folder_identifier_appsfolder,
+	  "Applications" },
+	{ libfwsi_known_folder_identifier_printhood,
+	  "Printer Shortcuts" },
+	{ libfwsi_known_folder_identifier_development_files,
+	  "Development Files" },
+	{ libfwsi_known_folder_identifier_profile,
+	  "%USERNAME%" },
+	{ libfwsi_known_folder_identifier_photoalbums,
+	  "Slide Shows" },
+	{ libfwsi_known_folder_identifier_downloads,
+	  "Downloads" },
+	{ libfwsi_known_folder_identifier_samplevideos,
+	  "Sample Videos" },
+	{ libfwsi_known_folder_identifier_appmods,
+	  "AppMods" },
 	{ libfwsi_known_folder_identifier_local_music,
 	  "Local Music" },
-	{ libfwsi_known_folder_identifier_local_pictures,
-	  "Local Pictures" },
-	{ libfwsi_known_folder_identifier_local_videos,
-	  "Local Videos" },
-	{ libfwsi_known_folder_identifier_localappdatalow,
-	  "LocalLow" },
-	{ libfwsi_known_folder_identifier_localizedresourcesdir,
-	  "None" },
-	{ libfwsi_known_folder_identifier_mapifolder,
-	  "Microsoft Office Outlook" },
-	{ libfwsi_known_folder_identifier_musiclibrary,
-	  "Music" },
-	{ libfwsi_known_folder_identifier_my_music,
-	  "Music" },
-	{ libfwsi_known_folder_identifier_my_pictures,
-	  "Pictures" },
-	{ libfwsi_known_folder_identifier_my_video,
-	  "Videos" },
-	{ libfwsi_known_folder_identifier_mycomputerfolder,
-	  "Computer" },
-	{ libfwsi_known_folder_identifier_nethood,
-	  "Network Shortcuts" },
-	{ libfwsi_known_folder_identifier_networkplacesfolder,
-	  "Network" },
-	{ libfwsi_known_folder_identifier_oem_links,
-	  "OEM Links" },
-	{ libfwsi_known_folder_identifier_onedrive,
-	  "OneDrive" },
-	{ libfwsi_known_folder_identifier_onedrivecameraroll,
-	  "Camera Roll" },
-	{ libfwsi_known_folder_identifier_onedrivedocuments,
-	  "Documents" },
+	{ libfwsi_known_folder_identifier_appupdatesfolder,
+	  "Installed Updates" },
+	{ libfwsi_known_folder_identifier_commondownloads,
+	  "Public Downloads" },
+	{ libfwsi_known_folder_identifier_local_downloads,
+	  "Local Downloads" },
 	{ libfwsi_known_folder_identifier_onedrivemusic,
 	  "OneDriveMusic" },
-	{ libfwsi_known_folder_identifier_onedrivepictures,
-	  "Pictures" },
-	{ libfwsi_known_folder_identifier_original_images,
-	  "Original Images" },
-	{ libfwsi_known_folder_identifier_personal,
-	  "Documents" },
-	{ libfwsi_known_folder_identifier_photoalbums,
-	  "Slide Shows" },
+	{ libfwsi_known_folder_identifier_retail_demo,
+	  "Retail Demo" },
+	{ libfwsi_known_folder_identifier_common_start_menu_places,
+	  "Common Start Menu Places" },
 	{ libfwsi_known_folder_identifier_pictureslibrary,
 	  "Pictures" },
-	{ libfwsi_known_folder_identifier_playlists,
-	  "Playlists" },
-	{ libfwsi_known_folder_identifier_printersfolder,
-	  "Printers" },
-	{ libfwsi_known_folder_identifier_printhood,
-	  "Printer Shortcuts" },
-	{ libfwsi_known_folder_identifier_profile,
-	  "%USERNAME%" },
-	{ libfwsi_known_folder_identifier_programfiles,
-	  "Program Files" },
-	{ libfwsi_known_folder_identifier_programfilescommon,
-	  "Common Files" },
-	{ libfwsi_known_folder_identifier_programfilescommonx64,
-	  "Common Files" },
-	{ libfwsi_known_folder_identifier_programfilescommonx86,
-	  "Common Files" },
-	{ libfwsi_known_folder_identifier_programfilesx64,
-	  "Program Files" },
-	{ libfwsi_known_folder_identifier_programfilesx86,
-	  "Program Files" },
-	{ libfwsi_known_folder_identifier_programs,
-	  "Programs" },
 	{ libfwsi_known_folder_identifier_public,
 	  "Public" },
-	{ libfwsi_known_folder_identifier_publicaccountpictures,
-	  "Public Account Pictures" },
-	{ libfwsi_known_folder_identifier_publicgametasks,
-	  "GameExplorer" },
-	{ libfwsi_known_folder_identifier_publiclibraries,
-	  "Libraries" },
-	{ libfwsi_known_folder_identifier_quick_launch,
-	  "Quick Launch" },
-	{ libfwsi_known_folder_identifier_recent,
-	  "Recent Items" },
-	{ libfwsi_known_folder_identifier_recorded_calls,
-	  "Recorded Calls" },
 	{ libfwsi_known_folder_identifier_recordedtvlibrary,
 	  "Recorded TV" },
-	{ libfwsi_known_folder_identifier_recyclebinfolder,
-	  "Recycle Bin" },
-	{ libfwsi_known_folder_identifier_resourcedir,
-	  "Resources" },
-	{ libfwsi_known_folder_identifier_retail_demo,
-	  "Retail Demo" },
-	{ libfwsi_known_folder_identifier_ringtones,
-	  "Ringtones" },
+	{ libfwsi_known_folder_identifier_appdataprogramdata,
+	  "AppDataProgramData" },
+	{ libfwsi_known_folder_identifier_homegroupcurrentuserfolder,
+	  "%USERNAME%" },
+	{ libfwsi_known_folder_identifier_localappdatalow,
+	  "LocalLow" },
 	{ libfwsi_known_folder_identifier_roamed_tile_images,
 	  "RoamedTileImages" },
-	{ libfwsi_known_folder_identifier_roaming_tiles,
-	  "RoamingTiles" },
-	{ libfwsi_known_folder_identifier_samplemusic,
-	  "Sample Music" },
-	{ libfwsi_known_folder_identifier_samplepictures,
-	  "Sample Pictures" },
+	{ libfwsi_known_folder_identifier_programfilescommonx64,
+	  "Common Files" },
+	{ libfwsi_known_folder_identifier_cryptokeys,
+	  "CryptoKeys" },
+	{ libfwsi_known_folder_identifier_original_images,
+	  "Original Images" },
+	{ libfwsi_known_folder_identifier_user_pinned,
+	  "User Pinned" },
+	{ libfwsi_known_folder_identifier_changeremoveprogramsfolder,
+	  "Programs and Features" },
+	{ libfwsi_known_folder_identifier_treepropertiesfolder,
+	  "TreePropertiesFolder" },
+	{ libfwsi_known_folder_identifier_common_documents,
+	  "Public Documents" },
+	{ libfwsi_known_folder_identifier_systemx86,
+	  "System32" },
+	{ libfwsi_known_folder_identifier_accountpictures,
+	  "Account Pictures" },
 	{ libfwsi_known_folder_identifier_sampleplaylists,
 	  "Sample Playlists" },
-	{ libfwsi_known_folder_identifier_samplevideos,
-	  "Sample Videos" },
-	{ libfwsi_known_folder_identifier_savedgames,
-	  "Saved Games" },
-	{ libfwsi_known_folder_identifier_savedpictures,
-	  "Saved Pictures" },
-	{ libfwsi_known_folder_identifier_savedpictureslibrary,
-	  "Saved Pictures Library" },
-	{ libfwsi_known_folder_identifier_screenshots,
-	  "Screenshots" },
-	{ libfwsi_known_folder_identifier_searches,
-	  "Searches" },
+	{ libfwsi_known_folder_identifier_onedrivepictures,
+	  "Pictures" },
+	{ libfwsi_known_folder_identifier_commonmusic,
+	  "Public Music" },
 	{ libfwsi_known_folder_identifier_searchhistoryfolder,
 	  "History" },
+	{ libfwsi_known_folder_identifier_programfiles,
+	  "Program Files" },
+	{ libfwsi_known_folder_identifier_fonts,
+	  "Fonts" },
+	{ libfwsi_known_folder_identifier_startup,
+	  "Startup" },
+	{ libfwsi_known_folder_identifier_appdatafavorites,
+	  "AppDataFavorites" },
+	{ libfwsi_known_folder_identifier_recorded_calls,
+	  "Recorded Calls" },
+	{ libfwsi_known_folder_identifier_start_menu,
+	  "Start Menu" },
+	{ libfwsi_known_folder_identifier_networkplacesfolder,
+	  "Network" },
+	{ libfwsi_known_folder_identifier_playlists,
+	  "Playlists" },
+	{ libfwsi_known_folder_identifier_dpapikeys,
+	  "DpapiKeys" },
+	{ libfwsi_known_folder_identifier_personal,
+	  "Documents" },
+	{ libfwsi_known_folder_identifier_oem_links,
+	  "OEM Links" },
 	{ libfwsi_known_folder_identifier_searchhomefolder,
 	  "Search Results" },
-	{ libfwsi_known_folder_identifier_searchtemplatesfolder,
+	{ libfwsi_known_folder_identifier_local_documents,
+	  "Local Documents" },
+	{ libfwsi_known_folder_identifier_appdata,
+	  "Roaming" },
+	{ libfwsi_known_folder_identifier_libraries,
+	  "Libraries" },
+	{ libfwsi_known_folder_identifier_thisdevicefolder,
+	  "ThisDeviceFolder" },
+	{ libfwsi_known_folder_identifier_systemcertificates,
+	  "SystemCertificates" },
+	{ libfwsi_known_folder_identifier_links,
+	  "Links" },
+	{ libfwsi_known_folder_identifier_userprogramfiles,
+	  "Programs" },
+	{ libfwsi_known_folder_identifier_common_templates,
 	  "Templates" },
-	{ libfwsi_known_folder_identifier_sendto,
-	  "SendTo" },
-	{ libfwsi_known_folder_identifier_start_menu,
-	  "Start Menu" },
+	{ libfwsi_known_folder_identifier_cache,
+	  "Temporary Internet Files" },
+	{ libfwsi_known_folder_identifier_templates,
+	  "Templates" },
+	{ libfwsi_known_folder_identifier_device_metadata_store,
+	  "DeviceMetadataStore" },
+	{ libfwsi_known_folder_identifier_controlpanelfolder,
+	  "Control Panel" },
 	{ libfwsi_known_folder_identifier_startmenuallprograms,
 	  "StartMenuAllPrograms" },
-	{ libfwsi_known_folder_identifier_startup,
-	  "Startup" },
+	{ libfwsi_known_folder_identifier_programfilesx86,
+	  "Program Files" },
 	{ libfwsi_known_folder_identifier_synccenterfolder,
 	  "Sync Center" },
-	{ libfwsi_known_folder_identifier_syncresultsfolder,
-	  "Sync Results" },
-	{ libfwsi_known_folder_identifier_syncsetupfolder,
-	  "Sync Setup" },
-	{ libfwsi_known_folder_identifier_system,
-	  "System32" },
-	{ libfwsi_known_folder_identifier_systemcertificates,
-	  "SystemCertificates" },
-	{ libfwsi_known_folder_identifier_systemx86,
-	  "System32" },
-	{ libfwsi_known_folder_identifier_templates,
+	{ libfwsi_known_folder_identifier_credentialmanager,
+	  "CredentialManager" },
+	{ libfwsi_known_folder_identifier_searchtemplatesfolder,
 	  "Templates" },
-	{ libfwsi_known_folder_identifier_thisdevicefolder,
-	  "ThisDeviceFolder" },
-	{ libfwsi_known_folder_identifier_thispcdesktopfolder,
-	  "ThisPCDesktopFolder" },
-	{ libfwsi_known_folder_identifier_treepropertiesfolder,
-	  "TreePropertiesFolder" },
-	{ libfwsi_known_folder_identifier_user_pinned,
-	  "User Pinned" },
-	{ libfwsi_known_folder_identifier_userprofiles,
-	  "Users" },
-	{ libfwsi_known_folder_identifier_userprogramfiles,
-	  "Programs" },
-	{ libfwsi_known_folder_identifier_userprogramfilescommon,
-	  "Programs" },
-	{ libfwsi_known_folder_identifier_usersfilesfolder,
-	  "UsersFilesFolder" },
-	{ libfwsi_known_folder_identifier_userslibrariesfolder,
-	  "Libraries" },
-	{ libfwsi_known_folder_identifier_videoslibrary,
-	  "Videos" },
-	{ libfwsi_known_folder_identifier_windows,
-	  "Windows" },
+	{ libfwsi_known_folder_identifier_savedgames,
+	  "Saved Games" },
 
 	{ libfwsi_known_folder_identifier_unknown,
 	  "Unknown" } };
 
+/* Retrieves the number of definitions, excluding the unknown identifier terminator
+ * Returns the number of definitions
+ */
+int libfwsi_known_folder_identifier_get_number_of_definitions(
+     void )
+{
+	return( (int) ( sizeof( libfwsi_known_folder_identifier_definitions ) / sizeof( libfwsi_known_folder_identifier_definition_t ) ) - 1 );
+}
+
+/* Retrieves the index of the definition of a known folder identifier
+ * Returns the index if found or -1 if not
+ */
+int libfwsi_known_folder_identifier_get_definition_index(
+     const uint8_t *known_folder_identifier )
+{
+	const libfwsi_known_folder_identifier_definition_t *definition = NULL;
+	size_t number_of_definitions                                   = 0;
+	size_t half_number_of_definitions                              = 0;
+	uint64_t identifier_lower                                      = 0;
+	uint64_t identifier_upper                                      = 0;
+	uint64_t value_64bit                                           = 0;
+
+	if( known_folder_identifier == NULL )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 known_folder_identifier,
+	 identifier_upper );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( known_folder_identifier[ 8 ] ),
+	 identifier_lower );
+
+	definition            = libfwsi_known_folder_identifier_definitions;
+	number_of_definitions = ( sizeof( libfwsi_known_folder_identifier_definitions ) / sizeof( libfwsi_known_folder_identifier_definition_t ) ) - 1;
+
+	/* Binary search the sorted definitions, the comparison only selects the next definition
+	 * so that the compiler can use a conditional move instead of a branch
+	 */
+	while( number_of_definitions > 1 )
+	{
+		half_number_of_definitions = number_of_definitions / 2;
+
+		byte_stream_copy_to_uint64_big_endian(
+		 definition[ half_number_of_definitions ].identifier,
+		 value_64bit );
+
+		if( value_64bit == identifier_upper )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( ( definition[ half_number_of_definitions ].identifier )[ 8 ] ),
+			 value_64bit );
+
+			definition = ( value_64bit <= identifier_lower ) ? &( definition[ half_number_of_definitions ] ) : definition;
+		}
+		else
+		{
+			definition = ( value_64bit < identifier_upper ) ? &( definition[ half_number_of_definitions ] ) : definition;
+		}
+		number_of_definitions -= half_number_of_definitions;
+	}
+	if( memory_compare(
+	     definition->identifier,
+	     known_folder_identifier,
+	     16 ) != 0 )
+	{
+		return( -1 );
+	}
+	return( (int) ( definition - libfwsi_known_folder_identifier_definitions ) );
+}
+
 /* Retrieves a string containing the name of the folder identifier
  */
 const char *libfwsi_known_folder_identifier_get_name(
              const uint8_t *known_folder_identifier )
 {
-	int iterator = 0;
+	int definition_index = 0;
 
 	if( known_folder_identifier == NULL )
 	{
 		return( "Invalid known folder identifier" );
 	}
-	while( memory_compare(
-	        ( libfwsi_known_folder_identifier_definitions[ iterator ] ).identifier,
-	        libfwsi_known_folder_identifier_unknown,
-	        16 ) != 0 )
+	definition_index = libfwsi_known_folder_identifier_get_definition_index(
+	                    known_folder_identifier );
+
+	if( definition_index == -1 )
 	{
-		if( memory_compare(
-		     ( libfwsi_known_folder_identifier_definitions[ iterator ] ).identifier,
-		     known_folder_identifier,
-		     16 ) == 0 )
-		{
-			break;
-		}
-		iterator++;
+		definition_index = libfwsi_known_folder_identifier_get_number_of_definitions();
 	}
 	return(
-	 ( libfwsi_known_folder_identifier_definitions[ iterator ] ).name );
+	 ( libfwsi_known_folder_identifier_definitions[ definition_index ] ).name );
 }
 
@@ -195,6 +195,14 @@ extern uint8_t libfwsi_known_folder_identifier_windows[ 16 ];
 
 extern uint8_t libfwsi_known_folder_identifier_unknown[ 16 ];
 
+extern libfwsi_known_folder_identifier_definition_t libfwsi_known_folder_identifier_definitions[ ];
+
+int libfwsi_known_folder_identifier_get_number_of_definitions(
+     void );
+
+int libfwsi_known_folder_identifier_get_definition_index(
+     const uint8_t *known_folder_identifier );
+
 LIBFWSI_EXTERN \
 const char *libfwsi_known_folder_identifier_get_name(
              const uint8_t *known_folder_identifier );
@@ -29,6 +29,8 @@
 #include "libfwsi_libuna.h"
 #include "libfwsi_network_location.h"
 #include "libfwsi_network_location_values.h"
+#include "libfwsi_string_cache.h"
+#include "libfwsi_utf8_string.h"
 
 /* Retrieves the size of the UTF-8 formatted location
  * Returns 1 if successful or -1 on error
@@ -66,6 +68,19 @@ int libfwsi_network_location_get_utf8_location_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -79,7 +94,7 @@ int libfwsi_network_location_get_utf8_location_size(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_utf8_string_size_from_byte_stream(
 	     network_location_values->location,
 	     network_location_values->location_size,
 	     network_location_values->ascii_codepage,
@@ -135,6 +150,19 @@ int libfwsi_network_location_get_utf8_location(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -148,7 +176,7 @@ int libfwsi_network_location_get_utf8_location(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_utf8_string_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->location,
@@ -204,6 +232,19 @@ int libfwsi_network_location_get_utf16_location_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -273,6 +314,19 @@ int libfwsi_network_location_get_utf16_location(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -306,6 +360,134 @@ int libfwsi_network_location_get_utf16_location(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted location
+ * The location is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf8_location(
+     libfwsi_item_t *network_location,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_network_location_get_cached_utf8_location";
+	int result                             = 0;
+
+	if( network_location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid network location.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) network_location;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_LOCATION,
+	          (intptr_t *) network_location,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_network_location_get_utf8_location_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_network_location_get_utf8_location,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted location
+ * The location is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf16_location(
+     libfwsi_item_t *network_location,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_network_location_get_cached_utf16_location";
+	int result                             = 0;
+
+	if( network_location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid network location.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) network_location;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_LOCATION,
+	          (intptr_t *) network_location,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_network_location_get_utf16_location_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_network_location_get_utf16_location,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 formatted description
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -342,6 +524,19 @@ int libfwsi_network_location_get_utf8_description_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -360,7 +555,7 @@ int libfwsi_network_location_get_utf8_description_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_utf8_string_size_from_byte_stream(
 	     network_location_values->description,
 	     network_location_values->description_size,
 	     network_location_values->ascii_codepage,
@@ -416,6 +611,19 @@ int libfwsi_network_location_get_utf8_description(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -434,7 +642,7 @@ int libfwsi_network_location_get_utf8_description(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_utf8_string_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->description,
@@ -490,6 +698,19 @@ int libfwsi_network_location_get_utf16_description_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -564,6 +785,19 @@ int libfwsi_network_location_get_utf16_description(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -602,6 +836,134 @@ int libfwsi_network_location_get_utf16_description(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted description
+ * The description is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf8_description(
+     libfwsi_item_t *network_location,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_network_location_get_cached_utf8_description";
+	int result                             = 0;
+
+	if( network_location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid network location.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) network_location;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_DESCRIPTION,
+	          (intptr_t *) network_location,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_network_location_get_utf8_description_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_network_location_get_utf8_description,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted description
+ * The description is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf16_description(
+     libfwsi_item_t *network_location,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_network_location_get_cached_utf16_description";
+	int result                             = 0;
+
+	if( network_location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid network location.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) network_location;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_DESCRIPTION,
+	          (intptr_t *) network_location,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_network_location_get_utf16_description_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_network_location_get_utf16_description,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 formatted comments
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -638,6 +1000,19 @@ int libfwsi_network_location_get_utf8_comments_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -656,7 +1031,7 @@ int libfwsi_network_location_get_utf8_comments_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_utf8_string_size_from_byte_stream(
 	     network_location_values->comments,
 	     network_location_values->comments_size,
 	     network_location_values->ascii_codepage,
@@ -712,6 +1087,19 @@ int libfwsi_network_location_get_utf8_comments(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -730,7 +1118,7 @@ int libfwsi_network_location_get_utf8_comments(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_utf8_string_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->comments,
@@ -786,6 +1174,19 @@ int libfwsi_network_location_get_utf16_comments_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -860,6 +1261,19 @@ int libfwsi_network_location_get_utf16_comments(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->value == NULL )
 	{
 		libcerror_error_set(
@@ -898,3 +1312,131 @@ int libfwsi_network_location_get_utf16_comments(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted comments
+ * The comments is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf8_comments(
+     libfwsi_item_t *network_location,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_network_location_get_cached_utf8_comments";
+	int result                             = 0;
+
+	if( network_location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid network location.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) network_location;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_COMMENTS,
+	          (intptr_t *) network_location,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_network_location_get_utf8_comments_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_network_location_get_utf8_comments,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted comments
+ * The comments is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf16_comments(
+     libfwsi_item_t *network_location,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_network_location_get_cached_utf16_comments";
+	int result                             = 0;
+
+	if( network_location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid network location.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) network_location;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_COMMENTS,
+	          (intptr_t *) network_location,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_network_location_get_utf16_comments_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_network_location_get_utf16_comments,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -59,6 +59,20 @@ int libfwsi_network_location_get_utf16_location(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf8_location(
+     libfwsi_item_t *network_location,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf16_location(
+     libfwsi_item_t *network_location,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_network_location_get_utf8_description_size(
      libfwsi_item_t *network_location,
@@ -85,6 +99,20 @@ int libfwsi_network_location_get_utf16_description(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf8_description(
+     libfwsi_item_t *network_location,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf16_description(
+     libfwsi_item_t *network_location,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_network_location_get_utf8_comments_size(
      libfwsi_item_t *network_location,
@@ -111,6 +139,20 @@ int libfwsi_network_location_get_utf16_comments(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf8_comments(
+     libfwsi_item_t *network_location,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf16_comments(
+     libfwsi_item_t *network_location,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -30,6 +30,7 @@
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_network_location_values.h"
+#include "libfwsi_string_scan.h"
 
 /* Creates network location values
  * Make sure the value network_location_values is referencing, is set to NULL
@@ -126,21 +127,6 @@ int libfwsi_network_location_values_free(
 	}
 	if( *network_location_values != NULL )
 	{
-		if( ( *network_location_values )->location != NULL )
-		{
-			memory_free(
-			 ( *network_location_values )->location );
-		}
-		if( ( *network_location_values )->description != NULL )
-		{
-			memory_free(
-			 ( *network_location_values )->description );
-		}
-		if( ( *network_location_values )->comments != NULL )
-		{
-			memory_free(
-			 ( *network_location_values )->comments );
-		}
 		memory_free(
 		 *network_location_values );
 
@@ -274,21 +260,12 @@ int libfwsi_network_location_values_read_data(
 
 	/* Determine the network location
 	 */
-	for( string_size = data_offset;
-	     string_size < data_size;
-	     string_size++ )
-	{
-		if( data[ string_size ] == 0 )
-		{
-			string_size++;
-
-			break;
-		}
-	}
-	string_size -= data_offset;
+	string_size = libfwsi_string_scan_get_byte_string_size(
+	               data,
+	               data_size,
+	               data_offset );
 
-	if( ( string_size == 0 )
-	 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( string_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -299,34 +276,7 @@ int libfwsi_network_location_values_read_data(
 
 		goto on_error;
 	}
-	network_location_values->location = (uint8_t *) memory_allocate(
-	                                                 sizeof( uint8_t ) * string_size );
-
-	if( network_location_values->location == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create location.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     network_location_values->location,
-	     &( data[ data_offset ] ),
-	     string_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy location.",
-		 function );
-
-		goto on_error;
-	}
+	network_location_values->location = &( data[ data_offset ] );
 	network_location_values->location_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -358,21 +308,12 @@ int libfwsi_network_location_values_read_data(
 	{
 		/* Determine the network description
 		 */
-		for( string_size = data_offset;
-		     string_size < data_size;
-		     string_size++ )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size++;
+		string_size = libfwsi_string_scan_get_byte_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
-				break;
-			}
-		}
-		string_size -= data_offset;
-
-		if( ( string_size == 0 )
-		 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		if( string_size == 0 )
 		{
 			libcerror_error_set(
 			 error,
@@ -383,34 +324,7 @@ int libfwsi_network_location_values_read_data(
 
 			goto on_error;
 		}
-		network_location_values->description = (uint8_t *) memory_allocate(
-		                                                    sizeof( uint8_t ) * string_size );
-
-		if( network_location_values->description == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create description.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     network_location_values->description,
-		     &( data[ data_offset ] ),
-		     string_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy description.",
-			 function );
-
-			goto on_error;
-		}
+		network_location_values->description = &( data[ data_offset ] );
 		network_location_values->description_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -442,21 +356,12 @@ int libfwsi_network_location_values_read_data(
 	{
 		/* Determine the network comments
 		 */
-		for( string_size = data_offset;
-		     string_size < data_size;
-		     string_size++ )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size++;
+		string_size = libfwsi_string_scan_get_byte_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 
-				break;
-			}
-		}
-		string_size -= data_offset;
-
-		if( ( string_size == 0 )
-		 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		if( string_size == 0 )
 		{
 			libcerror_error_set(
 			 error,
@@ -467,34 +372,7 @@ int libfwsi_network_location_values_read_data(
 
 			goto on_error;
 		}
-		network_location_values->comments = (uint8_t *) memory_allocate(
-		                                                 sizeof( uint8_t ) * string_size );
-
-		if( network_location_values->comments == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create comments.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     network_location_values->comments,
-		     &( data[ data_offset ] ),
-		     string_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy comments.",
-			 function );
-
-			goto on_error;
-		}
+		network_location_values->comments = &( data[ data_offset ] );
 		network_location_values->comments_size = string_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -548,31 +426,13 @@ int libfwsi_network_location_values_read_data(
 	return( 1 );
 
 on_error:
-	if( network_location_values->comments != NULL )
-	{
-		memory_free(
-		 network_location_values->comments );
-
-		network_location_values->comments = NULL;
-	}
+	network_location_values->comments = NULL;
 	network_location_values->comments_size = 0;
 
-	if( network_location_values->description != NULL )
-	{
-		memory_free(
-		 network_location_values->description );
-
-		network_location_values->description = NULL;
-	}
+	network_location_values->description = NULL;
 	network_location_values->description_size = 0;
 
-	if( network_location_values->location != NULL )
-	{
-		memory_free(
-		 network_location_values->location );
-
-		network_location_values->location = NULL;
-	}
+	network_location_values->location = NULL;
 	network_location_values->location_size = 0;
 
 	return( -1 );
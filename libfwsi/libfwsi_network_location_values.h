@@ -37,7 +37,7 @@ struct libfwsi_network_location_values
 {
 	/* The location
 	 */
-	uint8_t *location;
+	const uint8_t *location;
 
 	/* The location size
 	 */
@@ -45,7 +45,7 @@ struct libfwsi_network_location_values
 
 	/* The description
 	 */
-	uint8_t *description;
+	const uint8_t *description;
 
 	/* The description size
 	 */
@@ -53,7 +53,7 @@ struct libfwsi_network_location_values
 
 	/* The comments
 	 */
-	uint8_t *comments;
+	const uint8_t *comments;
 
 	/* The comments size
 	 */
@@ -0,0 +1,563 @@
+/*
+ * Shell item list callback parser functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_classifier.h"
+#include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_file_entry_values.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_parser.h"
+#include "libfwsi_types.h"
+#include "libfwsi_volume_values.h"
+
+/* Parses a shell item list from a byte stream and invokes the callbacks for every shell item
+ * No item or item list objects are created, the item values are read on the stack
+ * Returns 1 if successful, 0 if parsing was stopped by a callback or -1 on error
+ */
+int libfwsi_parse_with_callbacks(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     const libfwsi_parse_callbacks_t *callbacks,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libfwsi_classifier_result_t classifier_result;
+
+	static char *function     = "libfwsi_parse_with_callbacks";
+	size_t byte_stream_offset = 0;
+	uint16_t shell_item_size  = 0;
+	int callback_result       = 0;
+	int parent_item_type      = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	int result                = 0;
+	int shell_item_index      = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( byte_stream_size - byte_stream_offset ) >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
+			 function,
+			 shell_item_index,
+			 shell_item_size );
+		}
+#endif
+		if( shell_item_size == 0 )
+		{
+			break;
+		}
+		if( ( shell_item_size < 4 )
+		 || ( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 shell_item_index );
+
+			return( -1 );
+		}
+		if( libfwsi_classifier_classify_data(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     (size_t) shell_item_size,
+		     parent_item_type,
+		     &classifier_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to classify shell item: %d.",
+			 function,
+			 shell_item_index );
+
+			return( -1 );
+		}
+		if( callbacks->on_item_begin != NULL )
+		{
+			callback_result = callbacks->on_item_begin(
+			                   user_data,
+			                   shell_item_index,
+			                   classifier_result.item_type,
+			                   classifier_result.class_type,
+			                   &( byte_stream[ byte_stream_offset ] ),
+			                   (size_t) shell_item_size );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: item begin callback failed for shell item: %d.",
+				 function,
+				 shell_item_index );
+
+				return( -1 );
+			}
+			else if( callback_result == 0 )
+			{
+				return( 0 );
+			}
+		}
+		result = libfwsi_parser_read_item_values(
+		          &classifier_result,
+		          ascii_codepage,
+		          callbacks,
+		          user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read values of shell item: %d.",
+			 function,
+			 shell_item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwsi_parser_read_extension_blocks(
+		          &( byte_stream[ byte_stream_offset ] ),
+		          (size_t) shell_item_size,
+		          callbacks,
+		          user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extension blocks of shell item: %d.",
+			 function,
+			 shell_item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( callbacks->on_item_end != NULL )
+		{
+			callback_result = callbacks->on_item_end(
+			                   user_data,
+			                   shell_item_index,
+			                   classifier_result.item_type );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: item end callback failed for shell item: %d.",
+				 function,
+				 shell_item_index );
+
+				return( -1 );
+			}
+			else if( callback_result == 0 )
+			{
+				return( 0 );
+			}
+		}
+		byte_stream_offset += (size_t) shell_item_size;
+		parent_item_type    = classifier_result.item_type;
+
+		shell_item_index++;
+	}
+	return( 1 );
+}
+
+/* Reads the item values of a classified shell item and invokes the type specific callback
+ * Returns 1 if successful, 0 if parsing was stopped by a callback or -1 on error
+ */
+int libfwsi_parser_read_item_values(
+     const libfwsi_classifier_result_t *classifier_result,
+     int ascii_codepage,
+     const libfwsi_parse_callbacks_t *callbacks,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_values_t file_entry_values;
+	libfwsi_volume_values_t volume_values;
+
+	static char *function = "libfwsi_parser_read_item_values";
+	int callback_result   = 1;
+	int result            = 0;
+
+	if( classifier_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid classifier result.",
+		 function );
+
+		return( -1 );
+	}
+	if( callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	switch( classifier_result->item_type )
+	{
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+			if( callbacks->on_file_entry == NULL )
+			{
+				break;
+			}
+			if( memory_set(
+			     &file_entry_values,
+			     0,
+			     sizeof( libfwsi_file_entry_values_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear file entry values.",
+				 function );
+
+				return( -1 );
+			}
+			result = libfwsi_file_entry_values_read_data(
+			          &file_entry_values,
+			          classifier_result->values_data,
+			          classifier_result->values_data_size,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry values.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				callback_result = callbacks->on_file_entry(
+				                   user_data,
+				                   file_entry_values.file_size,
+				                   file_entry_values.modification_time,
+				                   file_entry_values.file_attribute_flags,
+				                   file_entry_values.name,
+				                   file_entry_values.name_size,
+				                   file_entry_values.is_unicode );
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			if( callbacks->on_volume == NULL )
+			{
+				break;
+			}
+			if( memory_set(
+			     &volume_values,
+			     0,
+			     sizeof( libfwsi_volume_values_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear volume values.",
+				 function );
+
+				return( -1 );
+			}
+			result = libfwsi_volume_values_read_data(
+			          &volume_values,
+			          classifier_result->values_data,
+			          classifier_result->values_data_size,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read volume values.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result != 0 )
+			      && ( volume_values.has_name != 0 ) )
+			{
+				callback_result = callbacks->on_volume(
+				                   user_data,
+				                   volume_values.name,
+				                   volume_values.name_size );
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( callback_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: item values callback failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( callback_result );
+}
+
+/* Reads the extension blocks of a shell item and invokes the extension block callback
+ * Returns 1 if successful, 0 if parsing was stopped by a callback or -1 on error
+ */
+int libfwsi_parser_read_extension_blocks(
+     const uint8_t *data,
+     size_t data_size,
+     const libfwsi_parse_callbacks_t *callbacks,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfwsi_parser_read_extension_blocks";
+	size_t data_offset                    = 0;
+	uint32_t signature                    = 0;
+	uint16_t extension_block_size         = 0;
+	uint16_t first_extension_block_offset = 0;
+	uint16_t version                      = 0;
+	int callback_result                   = 0;
+	int result                            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	if( callbacks->on_extension_block == NULL )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ data_size - 2 ] ),
+	 first_extension_block_offset );
+
+	if( ( first_extension_block_offset < 4 )
+	 || ( (size_t) first_extension_block_offset >= ( data_size - 2 ) ) )
+	{
+		return( 1 );
+	}
+	data_offset = (size_t) first_extension_block_offset;
+
+	while( ( data_size - data_offset ) > 2 )
+	{
+		result = libfwsi_extension_block_read_header(
+		          &( data[ data_offset ] ),
+		          data_size - data_offset,
+		          &extension_block_size,
+		          &version,
+		          &signature,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extension block header at offset: %" PRIzd ".",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( extension_block_size == 2 )
+		{
+			break;
+		}
+		callback_result = callbacks->on_extension_block(
+		                   user_data,
+		                   signature,
+		                   version,
+		                   &( data[ data_offset ] ),
+		                   (size_t) extension_block_size );
+
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: extension block callback failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( callback_result == 0 )
+		{
+			return( 0 );
+		}
+		data_offset += (size_t) extension_block_size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,65 @@
+/*
+ * Shell item list callback parser functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_PARSER_H )
+#define _LIBFWSI_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_classifier.h"
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_with_callbacks(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     const libfwsi_parse_callbacks_t *callbacks,
+     void *user_data,
+     libcerror_error_t **error );
+
+int libfwsi_parser_read_item_values(
+     const libfwsi_classifier_result_t *classifier_result,
+     int ascii_codepage,
+     const libfwsi_parse_callbacks_t *callbacks,
+     void *user_data,
+     libcerror_error_t **error );
+
+int libfwsi_parser_read_extension_blocks(
+     const uint8_t *data,
+     size_t data_size,
+     const libfwsi_parse_callbacks_t *callbacks,
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_PARSER_H ) */
+
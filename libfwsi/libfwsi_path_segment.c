@@ -0,0 +1,592 @@
+/*
+ * Path segment functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfwsi_codepage.h"
+#include "libfwsi_compressed_folder_values.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_file_entry_extension_values.h"
+#include "libfwsi_file_entry_values.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_network_location_values.h"
+#include "libfwsi_path_segment.h"
+#include "libfwsi_root_folder_values.h"
+#include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string_scan.h"
+#include "libfwsi_utf8_string.h"
+#include "libfwsi_volume_values.h"
+
+/* The upper case hexadecimal digits
+ */
+static const uint8_t libfwsi_path_segment_hexadecimal_digits[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+/* Sets the path segment from an item
+ * The path segment references the item data, which must remain valid while the path segment is used
+ * Returns 1 if successful, 0 if the item has no path segment or -1 on error
+ */
+int libfwsi_path_segment_set_from_item(
+     libfwsi_path_segment_t *path_segment,
+     libfwsi_internal_item_t *internal_item,
+     uint8_t path_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_compressed_folder_values_t *compressed_folder_values       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	libfwsi_file_entry_values_t *file_entry_values                     = NULL;
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_network_location_values_t *network_location_values         = NULL;
+	libfwsi_volume_values_t *volume_values                             = NULL;
+	static char *function                                              = "libfwsi_path_segment_set_from_item";
+
+	if( path_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	path_segment->string_data      = NULL;
+	path_segment->string_data_size = 0;
+	path_segment->is_utf16_stream  = 0;
+	path_segment->ascii_codepage   = internal_item->ascii_codepage;
+
+	switch( internal_item->type )
+	{
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
+		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		return( 0 );
+	}
+	switch( internal_item->type )
+	{
+		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
+			compressed_folder_values = (libfwsi_compressed_folder_values_t *) internal_item->value;
+
+			path_segment->string_data      = compressed_folder_values->name;
+			path_segment->string_data_size = compressed_folder_values->name_size;
+			path_segment->is_utf16_stream  = 1;
+
+			break;
+
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+			if( ( path_flags & LIBFWSI_PATH_FLAG_SHORT_NAMES ) == 0 )
+			{
+				internal_extension_block = internal_item->first_extension_block;
+
+				while( internal_extension_block != NULL )
+				{
+					if( ( internal_extension_block->signature == 0xbeef0004UL )
+					 && ( internal_extension_block->value != NULL ) )
+					{
+						file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+						if( ( file_entry_extension_values->long_name != NULL )
+						 && ( file_entry_extension_values->long_name_size != 0 ) )
+						{
+							path_segment->string_data      = file_entry_extension_values->long_name;
+							path_segment->string_data_size = file_entry_extension_values->long_name_size;
+							path_segment->is_utf16_stream  = 1;
+
+							break;
+						}
+					}
+					internal_extension_block = internal_extension_block->next_extension_block;
+				}
+			}
+			if( path_segment->string_data == NULL )
+			{
+				file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+				path_segment->string_data      = file_entry_values->name;
+				path_segment->string_data_size = file_entry_values->name_size;
+				path_segment->is_utf16_stream  = file_entry_values->is_unicode;
+			}
+			break;
+
+		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
+			network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+			path_segment->string_data      = network_location_values->location;
+			path_segment->string_data_size = network_location_values->location_size;
+			path_segment->ascii_codepage   = network_location_values->ascii_codepage;
+
+			break;
+
+		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
+			return( libfwsi_path_segment_set_guid(
+			         path_segment,
+			         ( (libfwsi_root_folder_values_t *) internal_item->value )->shell_folder_identifier,
+			         path_flags,
+			         error ) );
+
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			volume_values = (libfwsi_volume_values_t *) internal_item->value;
+
+			if( volume_values->has_name != 0 )
+			{
+				path_segment->string_data      = volume_values->name;
+				path_segment->string_data_size = volume_values->name_size;
+			}
+			else if( volume_values->has_shell_folder_identifier != 0 )
+			{
+				return( libfwsi_path_segment_set_guid(
+				         path_segment,
+				         volume_values->shell_folder_identifier,
+				         path_flags,
+				         error ) );
+			}
+			break;
+	}
+	if( ( path_segment->string_data == NULL )
+	 || ( path_segment->string_data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Sets the path segment from a shell folder identifier
+ * The known name of the shell folder is used unless LIBFWSI_PATH_FLAG_GUID_STRINGS is set,
+ * otherwise the GUID is formatted as a parsing name: "::{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}"
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_path_segment_set_guid(
+     libfwsi_path_segment_t *path_segment,
+     const uint8_t *guid_data,
+     uint8_t path_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_path_segment_set_guid";
+	size_t string_index   = 0;
+	int byte_index        = 0;
+	int definition_index  = 0;
+	int guid_data_index   = 0;
+
+	if( path_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	path_segment->is_utf16_stream = 0;
+	path_segment->ascii_codepage  = LIBFWSI_CODEPAGE_ASCII;
+
+	if( ( path_flags & LIBFWSI_PATH_FLAG_GUID_STRINGS ) == 0 )
+	{
+		definition_index = libfwsi_shell_folder_identifier_get_definition_index(
+		                    guid_data );
+
+		if( definition_index != -1 )
+		{
+			path_segment->string_data      = (const uint8_t *) ( libfwsi_shell_folder_identifier_definitions[ definition_index ] ).name;
+			path_segment->string_data_size = narrow_string_length(
+			                                  ( libfwsi_shell_folder_identifier_definitions[ definition_index ] ).name ) + 1;
+
+			return( 1 );
+		}
+	}
+	path_segment->guid_string[ string_index++ ] = (uint8_t) ':';
+	path_segment->guid_string[ string_index++ ] = (uint8_t) ':';
+	path_segment->guid_string[ string_index++ ] = (uint8_t) '{';
+
+	/* The first 3 parts of the GUID are stored in little-endian
+	 */
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		if( byte_index < 4 )
+		{
+			guid_data_index = 3 - byte_index;
+		}
+		else if( byte_index < 6 )
+		{
+			guid_data_index = 9 - byte_index;
+		}
+		else if( byte_index < 8 )
+		{
+			guid_data_index = 13 - byte_index;
+		}
+		else
+		{
+			guid_data_index = byte_index;
+		}
+		if( ( byte_index == 4 )
+		 || ( byte_index == 6 )
+		 || ( byte_index == 8 )
+		 || ( byte_index == 10 ) )
+		{
+			path_segment->guid_string[ string_index++ ] = (uint8_t) '-';
+		}
+		path_segment->guid_string[ string_index++ ] = libfwsi_path_segment_hexadecimal_digits[ guid_data[ guid_data_index ] >> 4 ];
+		path_segment->guid_string[ string_index++ ] = libfwsi_path_segment_hexadecimal_digits[ guid_data[ guid_data_index ] & 0x0f ];
+	}
+	path_segment->guid_string[ string_index++ ] = (uint8_t) '}';
+	path_segment->guid_string[ string_index++ ] = 0;
+
+	path_segment->string_data      = path_segment->guid_string;
+	path_segment->string_data_size = string_index;
+
+	return( 1 );
+}
+
+/* Determines if the path segment ends with a path separator
+ * Both '\' and '/' are considered path separators in addition to the path separator
+ * Returns 1 if the path segment ends with a path separator or 0 if not
+ */
+int libfwsi_path_segment_has_trailing_separator(
+     libfwsi_path_segment_t *path_segment,
+     uint16_t path_separator )
+{
+	size_t string_data_offset = 0;
+	uint16_t last_character   = 0;
+
+	if( ( path_segment == NULL )
+	 || ( path_segment->string_data == NULL ) )
+	{
+		return( 0 );
+	}
+	if( path_segment->is_utf16_stream != 0 )
+	{
+		string_data_offset = libfwsi_string_scan_find_utf16_terminator(
+		                      path_segment->string_data,
+		                      path_segment->string_data_size,
+		                      libfwsi_string_scan_get_kernel() );
+
+		string_data_offset &= ~( (size_t) 1 );
+
+		if( string_data_offset < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( path_segment->string_data[ string_data_offset - 2 ] ),
+		 last_character );
+	}
+	else
+	{
+		string_data_offset = libfwsi_string_scan_find_byte_terminator(
+		                      path_segment->string_data,
+		                      path_segment->string_data_size,
+		                      libfwsi_string_scan_get_kernel() );
+
+		if( string_data_offset < 1 )
+		{
+			return( 0 );
+		}
+		last_character = path_segment->string_data[ string_data_offset - 1 ];
+	}
+	if( ( last_character == (uint16_t) '\\' )
+	 || ( last_character == (uint16_t) '/' )
+	 || ( last_character == path_separator ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the size of the UTF-8 formatted path segment
+ * The size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_path_segment_get_utf8_string_size(
+     libfwsi_path_segment_t *path_segment,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_path_segment_get_utf8_string_size";
+	int result            = 0;
+
+	if( path_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_segment->is_utf16_stream != 0 )
+	{
+		result = libfwsi_utf8_string_size_from_utf16_stream(
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_utf8_string_size_from_byte_stream(
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          path_segment->ascii_codepage,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the path segment to an UTF-8 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_path_segment_copy_to_utf8_string(
+     libfwsi_path_segment_t *path_segment,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_path_segment_copy_to_utf8_string";
+	int result            = 0;
+
+	if( path_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_segment->is_utf16_stream != 0 )
+	{
+		result = libfwsi_utf8_string_copy_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_utf8_string_copy_from_byte_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          path_segment->ascii_codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted path segment
+ * The size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_path_segment_get_utf16_string_size(
+     libfwsi_path_segment_t *path_segment,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_path_segment_get_utf16_string_size";
+	int result            = 0;
+
+	if( path_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_segment->is_utf16_stream != 0 )
+	{
+		result = libuna_utf16_string_size_from_utf16_stream(
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf16_string_size_from_byte_stream(
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          path_segment->ascii_codepage,
+		          utf16_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the path segment to an UTF-16 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_path_segment_copy_to_utf16_string(
+     libfwsi_path_segment_t *path_segment,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_path_segment_copy_to_utf16_string";
+	int result            = 0;
+
+	if( path_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_segment->is_utf16_stream != 0 )
+	{
+		result = libuna_utf16_string_copy_from_utf16_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          path_segment->string_data,
+		          path_segment->string_data_size,
+		          path_segment->ascii_codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
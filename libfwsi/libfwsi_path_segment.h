@@ -0,0 +1,108 @@
+/*
+ * Path segment functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_PATH_SEGMENT_H )
+#define _LIBFWSI_PATH_SEGMENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a formatted GUID path segment: "::{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}"
+ * The size includes the end-of-string character
+ */
+#define LIBFWSI_PATH_SEGMENT_GUID_STRING_SIZE		41
+
+typedef struct libfwsi_path_segment libfwsi_path_segment_t;
+
+struct libfwsi_path_segment
+{
+	/* The string data, references the item data or the GUID string
+	 */
+	const uint8_t *string_data;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+
+	/* Value to indicate the string data is an UTF-16 little-endian stream
+	 */
+	uint8_t is_utf16_stream;
+
+	/* The codepage of the extended ASCII string data
+	 */
+	int ascii_codepage;
+
+	/* The formatted GUID string
+	 */
+	uint8_t guid_string[ LIBFWSI_PATH_SEGMENT_GUID_STRING_SIZE ];
+};
+
+int libfwsi_path_segment_set_from_item(
+     libfwsi_path_segment_t *path_segment,
+     libfwsi_internal_item_t *internal_item,
+     uint8_t path_flags,
+     libcerror_error_t **error );
+
+int libfwsi_path_segment_set_guid(
+     libfwsi_path_segment_t *path_segment,
+     const uint8_t *guid_data,
+     uint8_t path_flags,
+     libcerror_error_t **error );
+
+int libfwsi_path_segment_has_trailing_separator(
+     libfwsi_path_segment_t *path_segment,
+     uint16_t path_separator );
+
+int libfwsi_path_segment_get_utf8_string_size(
+     libfwsi_path_segment_t *path_segment,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_path_segment_copy_to_utf8_string(
+     libfwsi_path_segment_t *path_segment,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_path_segment_get_utf16_string_size(
+     libfwsi_path_segment_t *path_segment,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_path_segment_copy_to_utf16_string(
+     libfwsi_path_segment_t *path_segment,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_PATH_SEGMENT_H ) */
+
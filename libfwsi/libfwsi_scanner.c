@@ -0,0 +1,284 @@
+/*
+ * Shell item list structural scan functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfwsi_classifier.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_scanner.h"
+#include "libfwsi_types.h"
+
+/* Scans the structure of a shell item list in a byte stream
+ * The shell item size chain and terminator are validated and the shell items
+ * are classified without creating item objects or decoding the item values
+ * The first maximum_number_of_entries shell items are stored in entries,
+ * number_of_items contains the total number of shell items in the shell item list
+ * and data_size the size of the shell item list including the terminator
+ * Returns 1 if successful, 0 if the byte stream does not contain a valid shell item list or -1 on error
+ */
+int libfwsi_item_list_scan(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libfwsi_item_scan_entry_t *entries,
+     int maximum_number_of_entries,
+     int *number_of_items,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_classifier_result_t classifier_result;
+
+	static char *function          = "libfwsi_item_list_scan";
+	size_t byte_stream_offset      = 0;
+	uint16_t shell_item_size       = 0;
+	int number_of_extension_blocks = 0;
+	int parent_item_type           = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	int result                     = 0;
+	int shell_item_index           = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entries == NULL )
+	 && ( maximum_number_of_entries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_items = 0;
+	*data_size       = 0;
+
+	/* Invalid data is not reported as an error, which would require an allocation,
+	 * hence the classifier and extension block functions are called without error
+	 */
+	while( ( byte_stream_size - byte_stream_offset ) >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( shell_item_size == 0 )
+		{
+			*number_of_items = shell_item_index;
+			*data_size       = byte_stream_offset + 2;
+
+			return( 1 );
+		}
+		if( ( shell_item_size < 4 )
+		 || ( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) ) )
+		{
+			return( 0 );
+		}
+		if( shell_item_index == INT_MAX )
+		{
+			return( 0 );
+		}
+		if( libfwsi_classifier_classify_data(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     (size_t) shell_item_size,
+		     parent_item_type,
+		     &classifier_result,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		result = libfwsi_scanner_get_number_of_extension_blocks(
+		          &( byte_stream[ byte_stream_offset ] ),
+		          (size_t) shell_item_size,
+		          &number_of_extension_blocks,
+		          NULL );
+
+		if( result != 1 )
+		{
+			return( 0 );
+		}
+		if( shell_item_index < maximum_number_of_entries )
+		{
+			entries[ shell_item_index ].offset                     = byte_stream_offset;
+			entries[ shell_item_index ].size                       = shell_item_size;
+			entries[ shell_item_index ].class_type                 = classifier_result.class_type;
+			entries[ shell_item_index ].item_type                  = classifier_result.item_type;
+			entries[ shell_item_index ].number_of_extension_blocks = number_of_extension_blocks;
+		}
+		parent_item_type    = classifier_result.item_type;
+		byte_stream_offset += (size_t) shell_item_size;
+
+		shell_item_index++;
+	}
+	/* The shell item list is missing the terminator
+	 */
+	return( 0 );
+}
+
+/* Retrieves the number of extension blocks of a shell item
+ * Returns 1 if successful, 0 if the extension blocks are not valid or -1 on error
+ */
+int libfwsi_scanner_get_number_of_extension_blocks(
+     const uint8_t *data,
+     size_t data_size,
+     int *number_of_extension_blocks,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfwsi_scanner_get_number_of_extension_blocks";
+	size_t data_offset                    = 0;
+	uint32_t signature                    = 0;
+	uint16_t extension_block_size         = 0;
+	uint16_t first_extension_block_offset = 0;
+	uint16_t version                      = 0;
+	int result                            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extension_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extension blocks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extension_blocks = 0;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ data_size - 2 ] ),
+	 first_extension_block_offset );
+
+	if( ( first_extension_block_offset < 4 )
+	 || ( (size_t) first_extension_block_offset >= ( data_size - 2 ) ) )
+	{
+		return( 1 );
+	}
+	data_offset = (size_t) first_extension_block_offset;
+
+	while( ( data_size - data_offset ) > 2 )
+	{
+		result = libfwsi_extension_block_read_header(
+		          &( data[ data_offset ] ),
+		          data_size - data_offset,
+		          &extension_block_size,
+		          &version,
+		          &signature,
+		          NULL );
+
+		if( result == -1 )
+		{
+			return( 0 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( extension_block_size == 2 )
+		{
+			break;
+		}
+		*number_of_extension_blocks += 1;
+
+		data_offset += (size_t) extension_block_size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,57 @@
+/*
+ * Shell item list structural scan functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_SCANNER_H )
+#define _LIBFWSI_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_scan(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libfwsi_item_scan_entry_t *entries,
+     int maximum_number_of_entries,
+     int *number_of_items,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfwsi_scanner_get_number_of_extension_blocks(
+     const uint8_t *data,
+     size_t data_size,
+     int *number_of_extension_blocks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_SCANNER_H ) */
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -625,433 +626,498 @@ uint8_t libfwsi_shell_folder_identifier_unknown[ 16 ] = {
 	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
 
 /* The shell folder identifiers
+ * The definitions are sorted by identifier byte value, the unknown identifier is used as terminator
  */
 libfwsi_shell_folder_identifier_definition_t libfwsi_shell_folder_identifier_definitions[ ] = {
-
-	{ libfwsi_shell_folder_identifier_3d_objects,
-	  "3D Objects" },
-	{ libfwsi_shell_folder_identifier_activex_cache_folder,
-	  "ActiveX Cache Folder" },
-	{ libfwsi_shell_folder_identifier_add_network_place,
-	  "Add Network Place" },
-	{ libfwsi_shell_folder_identifier_administrative_tools,
-	  "Administrative Tools" },
-	{ libfwsi_shell_folder_identifier_all_control_panel_items,
-	  "All Control Panel Items" },
-	{ libfwsi_shell_folder_identifier_all_tasks,
-	  "All Tasks" },
-	{ libfwsi_shell_folder_identifier_all_tasks2,
-	  "All Tasks" },
-	{ libfwsi_shell_folder_identifier_application_suggested_locations,
-	  "Application Suggested Locations" },
-	{ libfwsi_shell_folder_identifier_applications,
-	  "Applications" },
-	{ libfwsi_shell_folder_identifier_autoplay,
-	  "AutoPlay" },
-	{ libfwsi_shell_folder_identifier_backup_and_restore,
-	  "Backup And Restore" },
-	{ libfwsi_shell_folder_identifier_backup_and_restore_center,
-	  "Backup and Restore Center" },
-	{ libfwsi_shell_folder_identifier_biometrics,
-	  "Biometrics" },
-	{ libfwsi_shell_folder_identifier_bluetooth_devices,
-	  "Bluetooth Devices" },
-	{ libfwsi_shell_folder_identifier_briefcase,
-	  "Briefcase" },
-	{ libfwsi_shell_folder_identifier_cabinet_file,
-	  "Cabinet File" },
-	{ libfwsi_shell_folder_identifier_command_folder,
-	  "Command Folder" },
-	{ libfwsi_shell_folder_identifier_common_places_fs_folder,
-	  "Common Places FS Folder" },
-	{ libfwsi_shell_folder_identifier_compressed_folder,
-	  "Compressed Folder" },
-	{ libfwsi_shell_folder_identifier_computer_delegate_folder,
-	  "Computer (delegate folder)" },
-	{ libfwsi_shell_folder_identifier_computer_search_results_folder,
-	  "Computer Search Results Folder" },
-	{ libfwsi_shell_folder_identifier_computers_and_devices,
-	  "Computers and Devices" },
-	{ libfwsi_shell_folder_identifier_control_panel,
-	  "Control Panel" },
-	{ libfwsi_shell_folder_identifier_control_panel_command_object_for_start_menu_and_desktop,
-	  "Control Panel command object for Start menu and desktop" },
-	{ libfwsi_shell_folder_identifier_credential_manager,
-	  "Credential Manager" },
-	{ libfwsi_shell_folder_identifier_db_folder,
-	  "DB Folder" },
-	{ libfwsi_shell_folder_identifier_default_location,
-	  "Default Location" },
 	{ libfwsi_shell_folder_identifier_desktop,
 	  "Desktop" },
-	{ libfwsi_shell_folder_identifier_device_center,
-	  "Device Center" },
-	{ libfwsi_shell_folder_identifier_device_center_initialization,
-	  "Device Center Initialization" },
+	{ libfwsi_shell_folder_identifier_history,
+	  "History" },
+	{ libfwsi_shell_folder_identifier_temporary_internet_files,
+	  "Temporary Internet Files" },
+	{ libfwsi_shell_folder_identifier_web_folders,
+	  "Web Folders" },
+	{ libfwsi_shell_folder_identifier_internet_explorer_history_and_feeds_shell_data_source_for_windows_search,
+	  "Internet Explorer History and Feeds Shell Data Source for Windows Search" },
+	{ libfwsi_shell_folder_identifier_temporary_internet_files2,
+	  "Temporary Internet Files" },
+	{ libfwsi_shell_folder_identifier_previous_versions_results_delegate_folder,
+	  "Previous Versions Results Delegate Folder" },
+	{ libfwsi_shell_folder_identifier_storage_spaces,
+	  "Storage Spaces" },
+	{ libfwsi_shell_folder_identifier_computers_and_devices,
+	  "Computers and Devices" },
+	{ libfwsi_shell_folder_identifier_network_setup_wizard,
+	  "Network Setup Wizard" },
+	{ libfwsi_shell_folder_identifier_show_desktop,
+	  "Show Desktop" },
+	{ libfwsi_shell_folder_identifier_windows_anytime_upgrade,
+	  "Windows Anytime Upgrade" },
+	{ libfwsi_shell_folder_identifier_window_switcher,
+	  "Window Switcher" },
 	{ libfwsi_shell_folder_identifier_devicepairingfolder_initialization,
 	  "DevicePairingFolder Initialization" },
-	{ libfwsi_shell_folder_identifier_directory,
-	  "Directory" },
-	{ libfwsi_shell_folder_identifier_display,
-	  "Display" },
-	{ libfwsi_shell_folder_identifier_dlna_content_directory_data_source,
-	  "DLNA Content Directory Data Source" },
+	{ libfwsi_shell_folder_identifier_history3,
+	  "History" },
+	{ libfwsi_shell_folder_identifier_shell_file_system_folder,
+	  "Shell File System Folder" },
+	{ libfwsi_shell_folder_identifier_windows_desktop_search,
+	  "Windows Desktop Search" },
+	{ libfwsi_shell_folder_identifier_windows_features,
+	  "Windows Features" },
+	{ libfwsi_shell_folder_identifier_results_folder,
+	  "Results Folder" },
+	{ libfwsi_shell_folder_identifier_db_folder,
+	  "DB Folder" },
 	{ libfwsi_shell_folder_identifier_dlna_media_servers_data_source,
 	  "DLNA Media Servers Data Source" },
-	{ libfwsi_shell_folder_identifier_dxp,
-	  "DXP" },
-	{ libfwsi_shell_folder_identifier_ease_of_access,
-	  "Ease of Access" },
+	{ libfwsi_shell_folder_identifier_mobile_broadband_profile_settings_editor,
+	  "Mobile Broadband Profile Settings Editor" },
+	{ libfwsi_shell_folder_identifier_network_map,
+	  "Network Map" },
+	{ libfwsi_shell_folder_identifier_autoplay,
+	  "AutoPlay" },
+	{ libfwsi_shell_folder_identifier_all_control_panel_items,
+	  "All Control Panel Items" },
+	{ libfwsi_shell_folder_identifier_history2,
+	  "History" },
+	{ libfwsi_shell_folder_identifier_briefcase,
+	  "Briefcase" },
 	{ libfwsi_shell_folder_identifier_ecs,
 	  "ECS" },
-	{ libfwsi_shell_folder_identifier_email,
-	  "E-mail" },
+	{ libfwsi_shell_folder_identifier_users_libraries,
+	  "Users Libraries" },
+	{ libfwsi_shell_folder_identifier_secure_startup,
+	  "Secure Startup" },
+	{ libfwsi_shell_folder_identifier_printhood_delegate_folder,
+	  "Printhood delegate folder" },
 	{ libfwsi_shell_folder_identifier_enhanced_storage_data_source,
 	  "Enhanced Storage Data Source" },
-	{ libfwsi_shell_folder_identifier_explorer_browser_results_folder,
-	  "Explorer Browser Results Folder" },
-	{ libfwsi_shell_folder_identifier_extensions_manager_folder,
-	  "Extensions Manager Folder" },
-	{ libfwsi_shell_folder_identifier_favorites,
-	  "Favorites" },
-	{ libfwsi_shell_folder_identifier_feedback_tool,
-	  "Feedback Tool" },
-	{ libfwsi_shell_folder_identifier_file_backup_index,
-	  "File Backup Index" },
-	{ libfwsi_shell_folder_identifier_file_explorer,
-	  "File Explorer" },
-	{ libfwsi_shell_folder_identifier_file_history_data_source,
-	  "File History Data Source" },
-	{ libfwsi_shell_folder_identifier_folder_options,
-	  "Folder Options" },
-	{ libfwsi_shell_folder_identifier_folder_shortcut,
-	  "Folder Shortcut" },
-	{ libfwsi_shell_folder_identifier_font_settings,
-	  "Font Settings" },
-	{ libfwsi_shell_folder_identifier_fonts,
-	  "Fonts" },
-	{ libfwsi_shell_folder_identifier_frequent_places_folder,
-	  "Frequent Places Folder" },
-	{ libfwsi_shell_folder_identifier_fusion_cache,
-	  "Fusion Cache" },
-	{ libfwsi_shell_folder_identifier_games_explorer,
-	  "Games Explorer" },
-	{ libfwsi_shell_folder_identifier_help_and_support,
-	  "Help and Support" },
-	{ libfwsi_shell_folder_identifier_history,
-	  "History" },
-	{ libfwsi_shell_folder_identifier_history2,
-	  "History" },
-	{ libfwsi_shell_folder_identifier_history3,
-	  "History" },
-	{ libfwsi_shell_folder_identifier_history4,
-	  "History" },
-	{ libfwsi_shell_folder_identifier_history_vault,
-	  "History Vault" },
-	{ libfwsi_shell_folder_identifier_home_group_control_panel,
-	  "Home Group Control Panel" },
-	{ libfwsi_shell_folder_identifier_inbox,
-	  "Inbox" },
-	{ libfwsi_shell_folder_identifier_inbox2,
-	  "Inbox" },
+	{ libfwsi_shell_folder_identifier_search_home,
+	  "Search Home" },
 	{ libfwsi_shell_folder_identifier_install_new_programs,
 	  "Install New Programs" },
-	{ libfwsi_shell_folder_identifier_installed_updates,
-	  "Installed Updates" },
-	{ libfwsi_shell_folder_identifier_internet,
-	  "Internet" },
-	{ libfwsi_shell_folder_identifier_internet_explorer,
-	  "Internet Explorer" },
-	{ libfwsi_shell_folder_identifier_internet_explorer_history_and_feeds_shell_data_source_for_windows_search,
-	  "Internet Explorer History and Feeds Shell Data Source for Windows Search" },
-	{ libfwsi_shell_folder_identifier_internet_explorer_rss_feeds_folder,
-	  "Internet Explorer RSS Feeds Folder" },
-	{ libfwsi_shell_folder_identifier_internet_folder,
-	  "Internet Folder" },
-	{ libfwsi_shell_folder_identifier_language_settings,
-	  "Language Settings" },
-	{ libfwsi_shell_folder_identifier_layout_folder,
-	  "Layout Folder" },
-	{ libfwsi_shell_folder_identifier_libraries_users_files_folder_delegate_folder,
-	  "Libraries Users Files Folder (delegate folder)" },
+	{ libfwsi_shell_folder_identifier_windows_firewall,
+	  "Windows Firewall" },
+	{ libfwsi_shell_folder_identifier_sync_results_delegate_folder,
+	  "Sync Results Delegate Folder" },
+	{ libfwsi_shell_folder_identifier_removable_storage_devices,
+	  "Removable Storage Devices" },
+	{ libfwsi_shell_folder_identifier_server_manager,
+	  "Server Manager" },
+	{ libfwsi_shell_folder_identifier_system_restore,
+	  "System Restore" },
+	{ libfwsi_shell_folder_identifier_scanners_and_cameras,
+	  "Scanners & Cameras" },
+	{ libfwsi_shell_folder_identifier_skydrive,
+	  "SkyDrive" },
+	{ libfwsi_shell_folder_identifier_power_options,
+	  "Power Options" },
+	{ libfwsi_shell_folder_identifier_extensions_manager_folder,
+	  "Extensions Manager Folder" },
 	{ libfwsi_shell_folder_identifier_library_folder,
 	  "Library Folder" },
-	{ libfwsi_shell_folder_identifier_location_folder,
-	  "Location Folder" },
-	{ libfwsi_shell_folder_identifier_manage_wireless_networks,
-	  "Manage Wireless Networks" },
 	{ libfwsi_shell_folder_identifier_microsoft_browser_architecture,
 	  "Microsoft Browser Architecture" },
-	{ libfwsi_shell_folder_identifier_microsoft_browser_architecture2,
-	  "Microsoft Browser Architecture" },
-	{ libfwsi_shell_folder_identifier_microsoft_ftp_folder,
-	  "Microsoft FTP Folder" },
-	{ libfwsi_shell_folder_identifier_microsoft_office_outlook,
-	  "Microsoft Office Outlook" },
-	{ libfwsi_shell_folder_identifier_microsoft_onenote_namespace_extension_for_windows_desktop_search,
-	  "Microsoft OneNote Namespace Extension for Windows Desktop Search" },
-	{ libfwsi_shell_folder_identifier_microsoft_windows_font_folder,
-	  "Microsoft Windows Font Folder" },
-	{ libfwsi_shell_folder_identifier_mobile_broadband_profile_settings_editor,
-	  "Mobile Broadband Profile Settings Editor" },
-	{ libfwsi_shell_folder_identifier_mobility_center_control_panel,
-	  "Mobility Center Control Panel" },
-	{ libfwsi_shell_folder_identifier_ms_graph_recent_file_folder,
-	  "MS Graph Recent File Folder" },
-	{ libfwsi_shell_folder_identifier_my_computer,
-	  "My Computer" },
-	{ libfwsi_shell_folder_identifier_my_documents,
-	  "My Documents" },
-	{ libfwsi_shell_folder_identifier_my_network_places,
-	  "My Network Places" },
-	{ libfwsi_shell_folder_identifier_network_and_dialup_connections,
-	  "Network and Dial-up Connections" },
-	{ libfwsi_shell_folder_identifier_network_and_dialup_connections2,
-	  "Network and Dial-up Connections" },
-	{ libfwsi_shell_folder_identifier_network_and_sharing_center,
-	  "Network and Sharing Center" },
-	{ libfwsi_shell_folder_identifier_network_map,
-	  "Network Map" },
-	{ libfwsi_shell_folder_identifier_network_setup_wizard,
-	  "Network Setup Wizard" },
-	{ libfwsi_shell_folder_identifier_offline_files,
-	  "Offline Files" },
-	{ libfwsi_shell_folder_identifier_offline_files_folder,
-	  "Offline Files Folder" },
-	{ libfwsi_shell_folder_identifier_other_users_folder,
-	  "Other Users Folder" },
-	{ libfwsi_shell_folder_identifier_other_users_folder2,
-	  "Other Users Folder" },
-	{ libfwsi_shell_folder_identifier_parental_controls,
-	  "Parental Controls" },
-	{ libfwsi_shell_folder_identifier_pc_settings,
-	  "PC Settings" },
-	{ libfwsi_shell_folder_identifier_performance_information_and_tools,
-	  "Performance Information and Tools" },
-	{ libfwsi_shell_folder_identifier_personalization_control_panel,
-	  "Personalization Control Panel" },
+	{ libfwsi_shell_folder_identifier_previous_versions_results_folder,
+	  "Previous Versions Results Folder" },
 	{ libfwsi_shell_folder_identifier_portable_devices,
 	  "Portable Devices" },
-	{ libfwsi_shell_folder_identifier_portable_media_devices,
-	  "Portable Media Devices" },
-	{ libfwsi_shell_folder_identifier_power_options,
-	  "Power Options" },
 	{ libfwsi_shell_folder_identifier_previous_versions,
 	  "Previous Versions" },
-	{ libfwsi_shell_folder_identifier_previous_versions_delegate_folder,
-	  "Previous Versions Delegate Folder" },
-	{ libfwsi_shell_folder_identifier_previous_versions_results_delegate_folder,
-	  "Previous Versions Results Delegate Folder" },
-	{ libfwsi_shell_folder_identifier_previous_versions_results_folder,
-	  "Previous Versions Results Folder" },
-	{ libfwsi_shell_folder_identifier_printers_and_faxes,
-	  "Printers and Faxes" },
-	{ libfwsi_shell_folder_identifier_printhood_delegate_folder,
-	  "Printhood delegate folder" },
-	{ libfwsi_shell_folder_identifier_programs_and_features,
-	  "Programs and Features" },
 	{ libfwsi_shell_folder_identifier_programs_folder,
 	  "Programs Folder" },
-	{ libfwsi_shell_folder_identifier_programs_folder_and_fast_items,
-	  "Programs Folder and Fast Items" },
-	{ libfwsi_shell_folder_identifier_proximity_cpl,
-	  "Proximity CPL" },
+	{ libfwsi_shell_folder_identifier_3d_objects,
+	  "3D Objects" },
+	{ libfwsi_shell_folder_identifier_shell_docobject_viewer,
+	  "Shell DocObject Viewer" },
+	{ libfwsi_shell_folder_identifier_sync_center_conflict_delegate_folder,
+	  "Sync Center Conflict Delegate Folder" },
+	{ libfwsi_shell_folder_identifier_recycle_bin,
+	  "Recycle Bin" },
+	{ libfwsi_shell_folder_identifier_internet_explorer,
+	  "Internet Explorer" },
+	{ libfwsi_shell_folder_identifier_this_device,
+	  "This Device" },
+	{ libfwsi_shell_folder_identifier_speech_recognition,
+	  "Speech Recognition" },
+	{ libfwsi_shell_folder_identifier_layout_folder,
+	  "Layout Folder" },
+	{ libfwsi_shell_folder_identifier_shared_documents_folder,
+	  "Shared Documents Folder" },
+	{ libfwsi_shell_folder_identifier_mobility_center_control_panel,
+	  "Mobility Center Control Panel" },
+	{ libfwsi_shell_folder_identifier_microsoft_browser_architecture2,
+	  "Microsoft Browser Architecture" },
+	{ libfwsi_shell_folder_identifier_sticky_notes_namespace_extension_for_windows_desktop_search,
+	  "Sticky Notes Namespace Extension for Windows Desktop Search" },
 	{ libfwsi_shell_folder_identifier_public_folder,
 	  "Public Folder" },
-	{ libfwsi_shell_folder_identifier_quick_access,
-	  "Quick Access" },
+	{ libfwsi_shell_folder_identifier_softex_omnipass_encrypted_folder,
+	  "Softex OmniPass Encrypted Folder" },
+	{ libfwsi_shell_folder_identifier_add_network_place,
+	  "Add Network Place" },
+	{ libfwsi_shell_folder_identifier_home_group_control_panel,
+	  "Home Group Control Panel" },
+	{ libfwsi_shell_folder_identifier_windows_search_service_media_center_namespace_extension_handler,
+	  "Windows Search Service Media Center Namespace Extension Handler" },
+	{ libfwsi_shell_folder_identifier_sensors,
+	  "Sensors" },
+	{ libfwsi_shell_folder_identifier_user_accounts,
+	  "User Accounts" },
+	{ libfwsi_shell_folder_identifier_this_device2,
+	  "This Device" },
+	{ libfwsi_shell_folder_identifier_bluetooth_devices,
+	  "Bluetooth Devices" },
+	{ libfwsi_shell_folder_identifier_folder_options,
+	  "Folder Options" },
+	{ libfwsi_shell_folder_identifier_file_history_data_source,
+	  "File History Data Source" },
+	{ libfwsi_shell_folder_identifier_ease_of_access,
+	  "Ease of Access" },
+	{ libfwsi_shell_folder_identifier_performance_information_and_tools,
+	  "Performance Information and Tools" },
 	{ libfwsi_shell_folder_identifier_recent_items_instance_folder,
 	  "Recent Items Instance Folder" },
+	{ libfwsi_shell_folder_identifier_manage_wireless_networks,
+	  "Manage Wireless Networks" },
+	{ libfwsi_shell_folder_identifier_default_location,
+	  "Default Location" },
+	{ libfwsi_shell_folder_identifier_my_network_places,
+	  "My Network Places" },
+	{ libfwsi_shell_folder_identifier_history4,
+	  "History" },
+	{ libfwsi_shell_folder_identifier_windows_sideshow,
+	  "Windows SideShow" },
+	{ libfwsi_shell_folder_identifier_subscription_folder,
+	  "Subscription Folder" },
+	{ libfwsi_shell_folder_identifier_tree_property_value_folder,
+	  "Tree property value folder" },
+	{ libfwsi_shell_folder_identifier_explorer_browser_results_folder,
+	  "Explorer Browser Results Folder" },
+	{ libfwsi_shell_folder_identifier_sync_results_folder,
+	  "Sync Results Folder" },
+	{ libfwsi_shell_folder_identifier_history_vault,
+	  "History Vault" },
+	{ libfwsi_shell_folder_identifier_device_center,
+	  "Device Center" },
+	{ libfwsi_shell_folder_identifier_application_suggested_locations,
+	  "Application Suggested Locations" },
+	{ libfwsi_shell_folder_identifier_search_folder,
+	  "Search Folder" },
+	{ libfwsi_shell_folder_identifier_control_panel,
+	  "Control Panel" },
+	{ libfwsi_shell_folder_identifier_programs_and_features,
+	  "Programs and Features" },
+	{ libfwsi_shell_folder_identifier_previous_versions_delegate_folder,
+	  "Previous Versions Delegate Folder" },
 	{ libfwsi_shell_folder_identifier_recent_places_folder,
 	  "Recent Places Folder" },
-	{ libfwsi_shell_folder_identifier_recycle_bin,
-	  "Recycle Bin" },
-	{ libfwsi_shell_folder_identifier_remote_printers,
-	  "Remote Printers" },
-	{ libfwsi_shell_folder_identifier_removable_drives,
-	  "Removable Drives" },
-	{ libfwsi_shell_folder_identifier_removable_storage_devices,
-	  "Removable Storage Devices" },
-	{ libfwsi_shell_folder_identifier_results_folder,
-	  "Results Folder" },
-	{ libfwsi_shell_folder_identifier_run,
-	  "Run..." },
-	{ libfwsi_shell_folder_identifier_scanners_and_cameras,
-	  "Scanners & Cameras" },
-	{ libfwsi_shell_folder_identifier_scanners_and_cameras2,
-	  "Scanners & Cameras" },
-	{ libfwsi_shell_folder_identifier_scheduled_tasks,
-	  "Scheduled Tasks" },
-	{ libfwsi_shell_folder_identifier_search,
-	  "Search" },
+	{ libfwsi_shell_folder_identifier_offline_files_folder,
+	  "Offline Files Folder" },
 	{ libfwsi_shell_folder_identifier_search_connector_folder,
 	  "Search Connector Folder" },
-	{ libfwsi_shell_folder_identifier_search_folder,
-	  "Search Folder" },
-	{ libfwsi_shell_folder_identifier_search_home,
-	  "Search Home" },
-	{ libfwsi_shell_folder_identifier_search_results,
-	  "Search Results" },
-	{ libfwsi_shell_folder_identifier_secure_startup,
-	  "Secure Startup" },
-	{ libfwsi_shell_folder_identifier_security_and_maintenance_cpl,
-	  "Security and Maintenance CPL" },
+	{ libfwsi_shell_folder_identifier_all_tasks,
+	  "All Tasks" },
+	{ libfwsi_shell_folder_identifier_computer_search_results_folder,
+	  "Computer Search Results Folder" },
+	{ libfwsi_shell_folder_identifier_inbox,
+	  "Inbox" },
+	{ libfwsi_shell_folder_identifier_inbox2,
+	  "Inbox" },
+	{ libfwsi_shell_folder_identifier_microsoft_office_outlook,
+	  "Microsoft Office Outlook" },
+	{ libfwsi_shell_folder_identifier_programs_folder_and_fast_items,
+	  "Programs Folder and Fast Items" },
+	{ libfwsi_shell_folder_identifier_removable_drives,
+	  "Removable Drives" },
+	{ libfwsi_shell_folder_identifier_offline_files,
+	  "Offline Files" },
+	{ libfwsi_shell_folder_identifier_all_tasks2,
+	  "All Tasks" },
 	{ libfwsi_shell_folder_identifier_security_center,
 	  "Security Center" },
-	{ libfwsi_shell_folder_identifier_sensors,
-	  "Sensors" },
-	{ libfwsi_shell_folder_identifier_server_manager,
-	  "Server Manager" },
-	{ libfwsi_shell_folder_identifier_set_program_access_and_defaults,
-	  "Set Program Access and Defaults" },
+	{ libfwsi_shell_folder_identifier_feedback_tool,
+	  "Feedback Tool" },
+	{ libfwsi_shell_folder_identifier_internet_folder,
+	  "Internet Folder" },
+	{ libfwsi_shell_folder_identifier_uncfatshellfolder_class,
+	  "UNCFATShellFolder Class" },
+	{ libfwsi_shell_folder_identifier_printers_and_faxes,
+	  "Printers and Faxes" },
+	{ libfwsi_shell_folder_identifier_favorites,
+	  "Favorites" },
+	{ libfwsi_shell_folder_identifier_microsoft_windows_font_folder,
+	  "Microsoft Windows Font Folder" },
+	{ libfwsi_shell_folder_identifier_activex_cache_folder,
+	  "ActiveX Cache Folder" },
+	{ libfwsi_shell_folder_identifier_parental_controls,
+	  "Parental Controls" },
 	{ libfwsi_shell_folder_identifier_set_user_defaults,
 	  "Set User Defaults" },
-	{ libfwsi_shell_folder_identifier_shared_documents_folder,
-	  "Shared Documents Folder" },
-	{ libfwsi_shell_folder_identifier_shell_docobject_viewer,
-	  "Shell DocObject Viewer" },
-	{ libfwsi_shell_folder_identifier_shell_favorite_folder,
-	  "Shell Favorite Folder" },
-	{ libfwsi_shell_folder_identifier_shell_file_system_folder,
-	  "Shell File System Folder" },
-	{ libfwsi_shell_folder_identifier_shell_file_system_folder2,
-	  "Shell File System Folder" },
-	{ libfwsi_shell_folder_identifier_shell_file_system_netfolder,
-	  "Shell File System NetFolder" },
-	{ libfwsi_shell_folder_identifier_shell_storage_folder_viewer,
-	  "Shell Storage Folder Viewer" },
-	{ libfwsi_shell_folder_identifier_show_desktop,
-	  "Show Desktop" },
-	{ libfwsi_shell_folder_identifier_skydrive,
-	  "SkyDrive" },
-	{ libfwsi_shell_folder_identifier_softex_omnipass_encrypted_folder,
-	  "Softex OmniPass Encrypted Folder" },
+	{ libfwsi_shell_folder_identifier_font_settings,
+	  "Font Settings" },
+	{ libfwsi_shell_folder_identifier_scanners_and_cameras2,
+	  "Scanners & Cameras" },
+	{ libfwsi_shell_folder_identifier_display,
+	  "Display" },
+	{ libfwsi_shell_folder_identifier_welcome_center,
+	  "Welcome Center" },
+	{ libfwsi_shell_folder_identifier_windows_desktop_search_mapi_namespace_extension_class,
+	  "Windows Desktop Search MAPI Namespace Extension Class" },
+	{ libfwsi_shell_folder_identifier_pc_settings,
+	  "PC Settings" },
+	{ libfwsi_shell_folder_identifier_dxp,
+	  "DXP" },
+	{ libfwsi_shell_folder_identifier_scheduled_tasks,
+	  "Scheduled Tasks" },
+	{ libfwsi_shell_folder_identifier_troubleshooting,
+	  "Troubleshooting" },
 	{ libfwsi_shell_folder_identifier_solidworks_enterprise_pdm,
 	  "SolidWorks Enterprise PDM" },
-	{ libfwsi_shell_folder_identifier_speech_recognition,
-	  "Speech Recognition" },
-	{ libfwsi_shell_folder_identifier_start_menu_all_programs,
-	  "Start Menu All Programs" },
-	{ libfwsi_shell_folder_identifier_start_menu_folder,
-	  "Start Menu Folder" },
-	{ libfwsi_shell_folder_identifier_sticky_notes_namespace_extension_for_windows_desktop_search,
-	  "Sticky Notes Namespace Extension for Windows Desktop Search" },
-	{ libfwsi_shell_folder_identifier_storage_spaces,
-	  "Storage Spaces" },
-	{ libfwsi_shell_folder_identifier_stream_backed_folder,
-	  "Stream Backed Folder" },
-	{ libfwsi_shell_folder_identifier_subscription_folder,
-	  "Subscription Folder" },
-	{ libfwsi_shell_folder_identifier_sync_center_conflict_delegate_folder,
-	  "Sync Center Conflict Delegate Folder" },
-	{ libfwsi_shell_folder_identifier_sync_center_conflict_folder,
-	  "Sync Center Conflict Folder" },
-	{ libfwsi_shell_folder_identifier_sync_center_folder,
-	  "Sync Center Folder" },
-	{ libfwsi_shell_folder_identifier_sync_results_delegate_folder,
-	  "Sync Results Delegate Folder" },
-	{ libfwsi_shell_folder_identifier_sync_results_folder,
-	  "Sync Results Folder" },
+	{ libfwsi_shell_folder_identifier_control_panel_command_object_for_start_menu_and_desktop,
+	  "Control Panel command object for Start menu and desktop" },
+	{ libfwsi_shell_folder_identifier_workspaces_center,
+	  "Workspaces Center" },
+	{ libfwsi_shell_folder_identifier_other_users_folder2,
+	  "Other Users Folder" },
 	{ libfwsi_shell_folder_identifier_sync_setup_delegate_folder,
 	  "Sync Setup Delegate Folder" },
-	{ libfwsi_shell_folder_identifier_sync_setup_folder,
-	  "Sync Setup Folder" },
-	{ libfwsi_shell_folder_identifier_system,
-	  "System" },
-	{ libfwsi_shell_folder_identifier_system_recovery,
-	  "System Recovery" },
-	{ libfwsi_shell_folder_identifier_system_restore,
-	  "System Restore" },
-	{ libfwsi_shell_folder_identifier_taskbar,
-	  "Taskbar" },
+	{ libfwsi_shell_folder_identifier_applications,
+	  "Applications" },
+	{ libfwsi_shell_folder_identifier_shell_file_system_folder2,
+	  "Shell File System Folder" },
+	{ libfwsi_shell_folder_identifier_shell_favorite_folder,
+	  "Shell Favorite Folder" },
+	{ libfwsi_shell_folder_identifier_network_and_dialup_connections2,
+	  "Network and Dial-up Connections" },
+	{ libfwsi_shell_folder_identifier_installed_updates,
+	  "Installed Updates" },
+	{ libfwsi_shell_folder_identifier_common_places_fs_folder,
+	  "Common Places FS Folder" },
+	{ libfwsi_shell_folder_identifier_security_and_maintenance_cpl,
+	  "Security and Maintenance CPL" },
+	{ libfwsi_shell_folder_identifier_location_folder,
+	  "Location Folder" },
 	{ libfwsi_shell_folder_identifier_taskbar_and_start_menu,
 	  "Taskbar and Start Menu" },
-	{ libfwsi_shell_folder_identifier_temporary_internet_files,
-	  "Temporary Internet Files" },
-	{ libfwsi_shell_folder_identifier_temporary_internet_files2,
-	  "Temporary Internet Files" },
-	{ libfwsi_shell_folder_identifier_this_device,
-	  "This Device" },
-	{ libfwsi_shell_folder_identifier_this_device2,
-	  "This Device" },
-	{ libfwsi_shell_folder_identifier_this_pc,
-	  "This PC" },
-	{ libfwsi_shell_folder_identifier_tree_property_value_folder,
-	  "Tree property value folder" },
-	{ libfwsi_shell_folder_identifier_troubleshooting,
-	  "Troubleshooting" },
-	{ libfwsi_shell_folder_identifier_uncfatshellfolder_class,
-	  "UNCFATShellFolder Class" },
-	{ libfwsi_shell_folder_identifier_user_accounts,
-	  "User Accounts" },
-	{ libfwsi_shell_folder_identifier_user_pinned,
-	  "User Pinned" },
+	{ libfwsi_shell_folder_identifier_start_menu_folder,
+	  "Start Menu Folder" },
+	{ libfwsi_shell_folder_identifier_sync_center_conflict_folder,
+	  "Sync Center Conflict Folder" },
+	{ libfwsi_shell_folder_identifier_file_backup_index,
+	  "File Backup Index" },
+	{ libfwsi_shell_folder_identifier_other_users_folder,
+	  "Other Users Folder" },
+	{ libfwsi_shell_folder_identifier_shell_storage_folder_viewer,
+	  "Shell Storage Folder Viewer" },
+	{ libfwsi_shell_folder_identifier_portable_media_devices,
+	  "Portable Media Devices" },
+	{ libfwsi_shell_folder_identifier_internet_explorer_rss_feeds_folder,
+	  "Internet Explorer RSS Feeds Folder" },
+	{ libfwsi_shell_folder_identifier_microsoft_onenote_namespace_extension_for_windows_desktop_search,
+	  "Microsoft OneNote Namespace Extension for Windows Desktop Search" },
+	{ libfwsi_shell_folder_identifier_windows_defender,
+	  "Windows Defender" },
+	{ libfwsi_shell_folder_identifier_my_documents,
+	  "My Documents" },
 	{ libfwsi_shell_folder_identifier_users_and_passwords,
 	  "Users and Passwords" },
+	{ libfwsi_shell_folder_identifier_search_results,
+	  "Search Results" },
+	{ libfwsi_shell_folder_identifier_sync_setup_folder,
+	  "Sync Setup Folder" },
+	{ libfwsi_shell_folder_identifier_microsoft_ftp_folder,
+	  "Microsoft FTP Folder" },
+	{ libfwsi_shell_folder_identifier_cabinet_file,
+	  "Cabinet File" },
+	{ libfwsi_shell_folder_identifier_command_folder,
+	  "Command Folder" },
 	{ libfwsi_shell_folder_identifier_users_files_folder_delegate_folder,
 	  "Users Files Folder (delegate folder)" },
-	{ libfwsi_shell_folder_identifier_users_libraries,
-	  "Users Libraries" },
-	{ libfwsi_shell_folder_identifier_web_folders,
-	  "Web Folders" },
-	{ libfwsi_shell_folder_identifier_welcome_center,
-	  "Welcome Center" },
-	{ libfwsi_shell_folder_identifier_window_switcher,
-	  "Window Switcher" },
-	{ libfwsi_shell_folder_identifier_windows_anytime_upgrade,
-	  "Windows Anytime Upgrade" },
-	{ libfwsi_shell_folder_identifier_windows_defender,
-	  "Windows Defender" },
-	{ libfwsi_shell_folder_identifier_windows_desktop_search,
-	  "Windows Desktop Search" },
-	{ libfwsi_shell_folder_identifier_windows_desktop_search_mapi_namespace_extension_class,
-	  "Windows Desktop Search MAPI Namespace Extension Class" },
-	{ libfwsi_shell_folder_identifier_windows_features,
-	  "Windows Features" },
-	{ libfwsi_shell_folder_identifier_windows_firewall,
-	  "Windows Firewall" },
-	{ libfwsi_shell_folder_identifier_windows_search_service_media_center_namespace_extension_handler,
-	  "Windows Search Service Media Center Namespace Extension Handler" },
+	{ libfwsi_shell_folder_identifier_network_and_dialup_connections,
+	  "Network and Dial-up Connections" },
+	{ libfwsi_shell_folder_identifier_user_pinned,
+	  "User Pinned" },
+	{ libfwsi_shell_folder_identifier_language_settings,
+	  "Language Settings" },
+	{ libfwsi_shell_folder_identifier_fusion_cache,
+	  "Fusion Cache" },
+	{ libfwsi_shell_folder_identifier_network_and_sharing_center,
+	  "Network and Sharing Center" },
+	{ libfwsi_shell_folder_identifier_quick_access,
+	  "Quick Access" },
+	{ libfwsi_shell_folder_identifier_this_pc,
+	  "This PC" },
 	{ libfwsi_shell_folder_identifier_windows_search_service_outlook_express_protocol_handler,
 	  "Windows Search Service Outlook Express Protocol Handler" },
-	{ libfwsi_shell_folder_identifier_windows_security,
-	  "Windows Security" },
-	{ libfwsi_shell_folder_identifier_windows_sideshow,
-	  "Windows SideShow" },
+	{ libfwsi_shell_folder_identifier_biometrics,
+	  "Biometrics" },
+	{ libfwsi_shell_folder_identifier_folder_shortcut,
+	  "Folder Shortcut" },
+	{ libfwsi_shell_folder_identifier_personalization_control_panel,
+	  "Personalization Control Panel" },
+	{ libfwsi_shell_folder_identifier_stream_backed_folder,
+	  "Stream Backed Folder" },
+	{ libfwsi_shell_folder_identifier_file_explorer,
+	  "File Explorer" },
 	{ libfwsi_shell_folder_identifier_windows_update,
 	  "Windows Update" },
-	{ libfwsi_shell_folder_identifier_workspaces_center,
-	  "Workspaces Center" },
+	{ libfwsi_shell_folder_identifier_backup_and_restore_center,
+	  "Backup and Restore Center" },
+	{ libfwsi_shell_folder_identifier_dlna_content_directory_data_source,
+	  "DLNA Content Directory Data Source" },
+	{ libfwsi_shell_folder_identifier_games_explorer,
+	  "Games Explorer" },
+	{ libfwsi_shell_folder_identifier_my_computer,
+	  "My Computer" },
+	{ libfwsi_shell_folder_identifier_compressed_folder,
+	  "Compressed Folder" },
+	{ libfwsi_shell_folder_identifier_fonts,
+	  "Fonts" },
+	{ libfwsi_shell_folder_identifier_administrative_tools,
+	  "Administrative Tools" },
+	{ libfwsi_shell_folder_identifier_device_center_initialization,
+	  "Device Center Initialization" },
+	{ libfwsi_shell_folder_identifier_proximity_cpl,
+	  "Proximity CPL" },
+	{ libfwsi_shell_folder_identifier_system,
+	  "System" },
+	{ libfwsi_shell_folder_identifier_frequent_places_folder,
+	  "Frequent Places Folder" },
+	{ libfwsi_shell_folder_identifier_sync_center_folder,
+	  "Sync Center Folder" },
+	{ libfwsi_shell_folder_identifier_start_menu_all_programs,
+	  "Start Menu All Programs" },
+	{ libfwsi_shell_folder_identifier_ms_graph_recent_file_folder,
+	  "MS Graph Recent File Folder" },
+	{ libfwsi_shell_folder_identifier_backup_and_restore,
+	  "Backup And Restore" },
+	{ libfwsi_shell_folder_identifier_directory,
+	  "Directory" },
+	{ libfwsi_shell_folder_identifier_search,
+	  "Search" },
+	{ libfwsi_shell_folder_identifier_help_and_support,
+	  "Help and Support" },
+	{ libfwsi_shell_folder_identifier_credential_manager,
+	  "Credential Manager" },
+	{ libfwsi_shell_folder_identifier_windows_security,
+	  "Windows Security" },
+	{ libfwsi_shell_folder_identifier_run,
+	  "Run..." },
+	{ libfwsi_shell_folder_identifier_internet,
+	  "Internet" },
+	{ libfwsi_shell_folder_identifier_taskbar,
+	  "Taskbar" },
+	{ libfwsi_shell_folder_identifier_email,
+	  "E-mail" },
+	{ libfwsi_shell_folder_identifier_libraries_users_files_folder_delegate_folder,
+	  "Libraries Users Files Folder (delegate folder)" },
+	{ libfwsi_shell_folder_identifier_set_program_access_and_defaults,
+	  "Set Program Access and Defaults" },
+	{ libfwsi_shell_folder_identifier_computer_delegate_folder,
+	  "Computer (delegate folder)" },
+	{ libfwsi_shell_folder_identifier_system_recovery,
+	  "System Recovery" },
+	{ libfwsi_shell_folder_identifier_shell_file_system_netfolder,
+	  "Shell File System NetFolder" },
+	{ libfwsi_shell_folder_identifier_remote_printers,
+	  "Remote Printers" },
 
 	{ libfwsi_shell_folder_identifier_unknown,
 	  "Unknown" } };
 
+/* Retrieves the number of definitions, excluding the unknown identifier terminator
+ * Returns the number of definitions
+ */
+int libfwsi_shell_folder_identifier_get_number_of_definitions(
+     void )
+{
+	return( (int) ( sizeof( libfwsi_shell_folder_identifier_definitions ) / sizeof( libfwsi_shell_folder_identifier_definition_t ) ) - 1 );
+}
+
+/* Retrieves the index of the definition of a shell folder identifier
+ * Returns the index if found or -1 if not
+ */
+int libfwsi_shell_folder_identifier_get_definition_index(
+     const uint8_t *shell_folder_identifier )
+{
+	const libfwsi_shell_folder_identifier_definition_t *definition = NULL;
+	size_t number_of_definitions                                   = 0;
+	size_t half_number_of_definitions                              = 0;
+	uint64_t identifier_lower                                      = 0;
+	uint64_t identifier_upper                                      = 0;
+	uint64_t value_64bit                                           = 0;
+
+	if( shell_folder_identifier == NULL )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 shell_folder_identifier,
+	 identifier_upper );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( shell_folder_identifier[ 8 ] ),
+	 identifier_lower );
+
+	definition            = libfwsi_shell_folder_identifier_definitions;
+	number_of_definitions = ( sizeof( libfwsi_shell_folder_identifier_definitions ) / sizeof( libfwsi_shell_folder_identifier_definition_t ) ) - 1;
+
+	/* Binary search the sorted definitions, the comparison only selects the next definition
+	 * so that the compiler can use a conditional move instead of a branch
+	 */
+	while( number_of_definitions > 1 )
+	{
+		half_number_of_definitions = number_of_definitions / 2;
+
+		byte_stream_copy_to_uint64_big_endian(
+		 definition[ half_number_of_definitions ].identifier,
+		 value_64bit );
+
+		if( value_64bit == identifier_upper )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( ( definition[ half_number_of_definitions ].identifier )[ 8 ] ),
+			 value_64bit );
+
+			definition = ( value_64bit <= identifier_lower ) ? &( definition[ half_number_of_definitions ] ) : definition;
+		}
+		else
+		{
+			definition = ( value_64bit < identifier_upper ) ? &( definition[ half_number_of_definitions ] ) : definition;
+		}
+		number_of_definitions -= half_number_of_definitions;
+	}
+	if( memory_compare(
+	     definition->identifier,
+	     shell_folder_identifier,
+	     16 ) != 0 )
+	{
+		return( -1 );
+	}
+	return( (int) ( definition - libfwsi_shell_folder_identifier_definitions ) );
+}
+
 /* Retrieves a string containing the name of the folder identifier
  */
 const char *libfwsi_shell_folder_identifier_get_name(
              const uint8_t *shell_folder_identifier )
 {
-	int iterator = 0;
+	int definition_index = 0;
 
 	if( shell_folder_identifier == NULL )
 	{
 		return( "Invalid shell folder identifier" );
 	}
-	while( memory_compare(
-	        ( libfwsi_shell_folder_identifier_definitions[ iterator ] ).identifier,
-	        libfwsi_shell_folder_identifier_unknown,
-	        16 ) != 0 )
+	definition_index = libfwsi_shell_folder_identifier_get_definition_index(
+	                    shell_folder_identifier );
+
+	if( definition_index == -1 )
 	{
-		if( memory_compare(
-		     ( libfwsi_shell_folder_identifier_definitions[ iterator ] ).identifier,
-		     shell_folder_identifier,
-		     16 ) == 0 )
-		{
-			break;
-		}
-		iterator++;
+		definition_index = libfwsi_shell_folder_identifier_get_number_of_definitions();
 	}
 	return(
-	 ( libfwsi_shell_folder_identifier_definitions[ iterator ] ).name );
+	 ( libfwsi_shell_folder_identifier_definitions[ definition_index ] ).name );
 }
 
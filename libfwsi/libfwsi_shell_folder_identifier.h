@@ -248,6 +248,14 @@ extern uint8_t libfwsi_shell_folder_identifier_workspaces_center[ 16 ];
 extern uint8_t libfwsi_shell_folder_identifier_empty[ 16 ];
 extern uint8_t libfwsi_shell_folder_identifier_unknown[ 16 ];
 
+extern libfwsi_shell_folder_identifier_definition_t libfwsi_shell_folder_identifier_definitions[ ];
+
+int libfwsi_shell_folder_identifier_get_number_of_definitions(
+     void );
+
+int libfwsi_shell_folder_identifier_get_definition_index(
+     const uint8_t *shell_folder_identifier );
+
 LIBFWSI_EXTERN \
 const char *libfwsi_shell_folder_identifier_get_name(
              const uint8_t *shell_folder_identifier );
@@ -0,0 +1,622 @@
+/*
+ * Decoded string cache functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcthreads.h"
+#include "libfwsi_string_cache.h"
+
+/* Clears the string cache
+ * Frees the cached strings, the read/write lock is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_cache_clear(
+     libfwsi_string_cache_t *string_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_string_cache_clear";
+	int string_index      = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS;
+	     string_index++ )
+	{
+		if( string_cache->utf8_strings[ string_index ] != NULL )
+		{
+			memory_free(
+			 string_cache->utf8_strings[ string_index ] );
+
+			string_cache->utf8_strings[ string_index ] = NULL;
+		}
+		string_cache->utf8_string_lengths[ string_index ] = 0;
+
+		if( string_cache->utf16_strings[ string_index ] != NULL )
+		{
+			memory_free(
+			 string_cache->utf16_strings[ string_index ] );
+
+			string_cache->utf16_strings[ string_index ] = NULL;
+		}
+		string_cache->utf16_string_lengths[ string_index ] = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves a cached UTF-8 string
+ * The string is converted using the string getter functions of the owner on first use
+ * and the cached string remains valid until the owner is cleared or freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_string_cache_get_utf8_string(
+     libfwsi_string_cache_t *string_cache,
+     int string_index,
+     intptr_t *owner,
+     int (*get_utf8_string_size)(
+            intptr_t *owner,
+            size_t *utf8_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf8_string)(
+            intptr_t *owner,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libcerror_error_t **error ),
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *cached_string      = NULL;
+	uint8_t *new_string         = NULL;
+	static char *function       = "libfwsi_string_cache_get_utf8_string";
+	size_t cached_string_length = 0;
+	size_t new_string_size      = 0;
+	int result                  = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get UTF-8 string size function.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get UTF-8 string function.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( string_cache->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     string_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	cached_string        = string_cache->utf8_strings[ string_index ];
+	cached_string_length = string_cache->utf8_string_lengths[ string_index ];
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( string_cache->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     string_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( cached_string == NULL )
+	{
+		/* The string is converted without holding the lock, since the string getter functions
+		 * of the owner grab the lock to decode the values
+		 */
+		result = get_utf8_string_size(
+		          owner,
+		          &new_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( new_string_size == 0 )
+		 || ( new_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		new_string = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * new_string_size );
+
+		if( new_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( get_utf8_string(
+		     owner,
+		     new_string,
+		     new_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		new_string[ new_string_size - 1 ] = 0;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( string_cache->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_grab_for_write(
+			     string_cache->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* Another thread could have cached the string before the lock was grabbed for writing
+		 */
+		if( string_cache->utf8_strings[ string_index ] == NULL )
+		{
+			string_cache->utf8_strings[ string_index ]        = new_string;
+			string_cache->utf8_string_lengths[ string_index ] = new_string_size - 1;
+
+			new_string = NULL;
+		}
+		cached_string        = string_cache->utf8_strings[ string_index ];
+		cached_string_length = string_cache->utf8_string_lengths[ string_index ];
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( string_cache->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_release_for_write(
+			     string_cache->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		if( new_string != NULL )
+		{
+			memory_free(
+			 new_string );
+
+			new_string = NULL;
+		}
+	}
+	*utf8_string        = cached_string;
+	*utf8_string_length = cached_string_length;
+
+	return( 1 );
+
+on_error:
+	if( new_string != NULL )
+	{
+		memory_free(
+		 new_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves a cached UTF-16 string
+ * The string is converted using the string getter functions of the owner on first use
+ * and the cached string remains valid until the owner is cleared or freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_string_cache_get_utf16_string(
+     libfwsi_string_cache_t *string_cache,
+     int string_index,
+     intptr_t *owner,
+     int (*get_utf16_string_size)(
+            intptr_t *owner,
+            size_t *utf16_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf16_string)(
+            intptr_t *owner,
+            uint16_t *utf16_string,
+            size_t utf16_string_size,
+            libcerror_error_t **error ),
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint16_t *cached_string     = NULL;
+	uint16_t *new_string        = NULL;
+	static char *function       = "libfwsi_string_cache_get_utf16_string";
+	size_t cached_string_length = 0;
+	size_t new_string_size      = 0;
+	int result                  = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get UTF-16 string size function.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get UTF-16 string function.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( string_cache->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     string_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	cached_string        = string_cache->utf16_strings[ string_index ];
+	cached_string_length = string_cache->utf16_string_lengths[ string_index ];
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	if( string_cache->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     string_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( cached_string == NULL )
+	{
+		/* The string is converted without holding the lock, since the string getter functions
+		 * of the owner grab the lock to decode the values
+		 */
+		result = get_utf16_string_size(
+		          owner,
+		          &new_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( new_string_size == 0 )
+		 || ( new_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		new_string = (uint16_t *) memory_allocate(
+		                          sizeof( uint16_t ) * new_string_size );
+
+		if( new_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( get_utf16_string(
+		     owner,
+		     new_string,
+		     new_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		new_string[ new_string_size - 1 ] = 0;
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( string_cache->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_grab_for_write(
+			     string_cache->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* Another thread could have cached the string before the lock was grabbed for writing
+		 */
+		if( string_cache->utf16_strings[ string_index ] == NULL )
+		{
+			string_cache->utf16_strings[ string_index ]        = new_string;
+			string_cache->utf16_string_lengths[ string_index ] = new_string_size - 1;
+
+			new_string = NULL;
+		}
+		cached_string        = string_cache->utf16_strings[ string_index ];
+		cached_string_length = string_cache->utf16_string_lengths[ string_index ];
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+		if( string_cache->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_release_for_write(
+			     string_cache->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		if( new_string != NULL )
+		{
+			memory_free(
+			 new_string );
+
+			new_string = NULL;
+		}
+	}
+	*utf16_string        = cached_string;
+	*utf16_string_length = cached_string_length;
+
+	return( 1 );
+
+on_error:
+	if( new_string != NULL )
+	{
+		memory_free(
+		 new_string );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,125 @@
+/*
+ * Decoded string cache functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_STRING_CACHE_H )
+#define _LIBFWSI_STRING_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of strings that can be cached per item or extension block
+ */
+#define LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS	3
+
+/* The string cache indexes, the index is specific to the owner of the cache
+ */
+enum LIBFWSI_STRING_CACHE_INDEXES
+{
+	LIBFWSI_STRING_CACHE_INDEX_NAME			= 0,
+
+	LIBFWSI_STRING_CACHE_INDEX_LOCATION		= 0,
+	LIBFWSI_STRING_CACHE_INDEX_DESCRIPTION		= 1,
+	LIBFWSI_STRING_CACHE_INDEX_COMMENTS		= 2,
+
+	LIBFWSI_STRING_CACHE_INDEX_LONG_NAME		= 0,
+	LIBFWSI_STRING_CACHE_INDEX_LOCALIZED_NAME	= 1,
+
+	LIBFWSI_STRING_CACHE_INDEX_PATH			= 0
+};
+
+typedef struct libfwsi_string_cache libfwsi_string_cache_t;
+
+struct libfwsi_string_cache
+{
+	/* The UTF-8 strings
+	 */
+	uint8_t *utf8_strings[ LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ];
+
+	/* The UTF-8 string lengths, without the end-of-string character
+	 */
+	size_t utf8_string_lengths[ LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ];
+
+	/* The UTF-16 strings
+	 */
+	uint16_t *utf16_strings[ LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ];
+
+	/* The UTF-16 string lengths, without the end-of-string character
+	 */
+	size_t utf16_string_lengths[ LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ];
+
+#if defined( HAVE_LIBFWSI_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the item list that manages the cache owner, NULL if not managed
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfwsi_string_cache_clear(
+     libfwsi_string_cache_t *string_cache,
+     libcerror_error_t **error );
+
+int libfwsi_string_cache_get_utf8_string(
+     libfwsi_string_cache_t *string_cache,
+     int string_index,
+     intptr_t *owner,
+     int (*get_utf8_string_size)(
+            intptr_t *owner,
+            size_t *utf8_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf8_string)(
+            intptr_t *owner,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libcerror_error_t **error ),
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int libfwsi_string_cache_get_utf16_string(
+     libfwsi_string_cache_t *string_cache,
+     int string_index,
+     intptr_t *owner,
+     int (*get_utf16_string_size)(
+            intptr_t *owner,
+            size_t *utf16_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf16_string)(
+            intptr_t *owner,
+            uint16_t *utf16_string,
+            size_t utf16_string_size,
+            libcerror_error_t **error ),
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_STRING_CACHE_H ) */
+
@@ -0,0 +1,586 @@
+/*
+ * String scanning functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_string_scan.h"
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+/* Determines if a 64-bit value contains a byte with a value of 0
+ */
+#define libfwsi_string_scan_has_zero_byte( value_64bit ) \
+	( ( ( value_64bit ) - 0x0101010101010101ULL ) & ~( value_64bit ) & 0x8080808080808080ULL )
+
+/* Determines if a 64-bit value contains a 16-bit value of 0
+ */
+#define libfwsi_string_scan_has_zero_16bit( value_64bit ) \
+	( ( ( value_64bit ) - 0x0001000100010001ULL ) & ~( value_64bit ) & 0x8000800080008000ULL )
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) || defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+
+/* Retrieves the index of the least significant bit that is set
+ * The mask cannot be 0
+ * Returns the index of the bit
+ */
+static size_t libfwsi_string_scan_get_first_bit_index(
+               uint32_t mask )
+{
+#if defined( __GNUC__ )
+	return( (size_t) __builtin_ctz( mask ) );
+
+#elif defined( _MSC_VER )
+	unsigned long bit_index = 0;
+
+	_BitScanForward(
+	 &bit_index,
+	 (unsigned long) mask );
+
+	return( (size_t) bit_index );
+#else
+	size_t bit_index = 0;
+
+	while( ( mask & 1 ) == 0 )
+	{
+		mask >>= 1;
+
+		bit_index++;
+	}
+	return( bit_index );
+#endif
+}
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) || defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 ) */
+
+/* Finds the first byte with a value of 0 using 64-bit words
+ * Returns the offset of the byte or data_size if not found
+ */
+static size_t libfwsi_string_scan_find_byte_terminator_portable(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	uint64_t value_64bit = 0;
+
+	while( ( data_offset + 8 ) <= data_size )
+	{
+		/* The zero tests are independent of the byte order
+		 */
+		memory_copy(
+		 &value_64bit,
+		 &( data[ data_offset ] ),
+		 8 );
+
+		if( libfwsi_string_scan_has_zero_byte( value_64bit ) != 0 )
+		{
+			break;
+		}
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] == 0 )
+		{
+			return( data_offset );
+		}
+		data_offset++;
+	}
+	return( data_size );
+}
+
+/* Finds the first 16-bit aligned 16-bit value of 0 using 64-bit words
+ * Returns the offset of the 16-bit value or data_size if not found
+ */
+static size_t libfwsi_string_scan_find_utf16_terminator_portable(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	uint64_t value_64bit = 0;
+
+	while( ( data_offset + 8 ) <= data_size )
+	{
+		/* The zero tests are independent of the byte order
+		 */
+		memory_copy(
+		 &value_64bit,
+		 &( data[ data_offset ] ),
+		 8 );
+
+		if( libfwsi_string_scan_has_zero_16bit( value_64bit ) != 0 )
+		{
+			break;
+		}
+		data_offset += 8;
+	}
+	while( ( data_offset + 1 ) < data_size )
+	{
+		if( ( data[ data_offset ] == 0 )
+		 && ( data[ data_offset + 1 ] == 0 ) )
+		{
+			return( data_offset );
+		}
+		data_offset += 2;
+	}
+	return( data_size );
+}
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+
+/* Finds the first byte with a value of 0 using SSE2
+ * Returns the offset of the byte or data_size if not found
+ */
+static size_t libfwsi_string_scan_find_byte_terminator_sse2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	__m128i zero_vector = _mm_setzero_si128();
+	__m128i data_vector;
+	uint32_t mask       = 0;
+
+	while( ( data_offset + 16 ) <= data_size )
+	{
+		data_vector = _mm_loadu_si128(
+		               (const __m128i *) &( data[ data_offset ] ) );
+
+		mask = (uint32_t) _mm_movemask_epi8(
+		                   _mm_cmpeq_epi8(
+		                    data_vector,
+		                    zero_vector ) );
+
+		if( mask != 0 )
+		{
+			return( data_offset + libfwsi_string_scan_get_first_bit_index( mask ) );
+		}
+		data_offset += 16;
+	}
+	return( libfwsi_string_scan_find_byte_terminator_portable(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+/* Finds the first 16-bit aligned 16-bit value of 0 using SSE2
+ * Returns the offset of the 16-bit value or data_size if not found
+ */
+static size_t libfwsi_string_scan_find_utf16_terminator_sse2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	__m128i zero_vector = _mm_setzero_si128();
+	__m128i data_vector;
+	uint32_t mask       = 0;
+
+	while( ( data_offset + 16 ) <= data_size )
+	{
+		data_vector = _mm_loadu_si128(
+		               (const __m128i *) &( data[ data_offset ] ) );
+
+		mask = (uint32_t) _mm_movemask_epi8(
+		                   _mm_cmpeq_epi16(
+		                    data_vector,
+		                    zero_vector ) );
+
+		if( mask != 0 )
+		{
+			return( data_offset + libfwsi_string_scan_get_first_bit_index( mask ) );
+		}
+		data_offset += 16;
+	}
+	return( libfwsi_string_scan_find_utf16_terminator_portable(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) */
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+
+/* Finds the first byte with a value of 0 using AVX2
+ * Returns the offset of the byte or data_size if not found
+ */
+__attribute__((target("avx2")))
+static size_t libfwsi_string_scan_find_byte_terminator_avx2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	__m256i zero_vector = _mm256_setzero_si256();
+	__m256i data_vector;
+	uint32_t mask       = 0;
+
+	while( ( data_offset + 32 ) <= data_size )
+	{
+		data_vector = _mm256_loadu_si256(
+		               (const __m256i *) &( data[ data_offset ] ) );
+
+		mask = (uint32_t) _mm256_movemask_epi8(
+		                   _mm256_cmpeq_epi8(
+		                    data_vector,
+		                    zero_vector ) );
+
+		if( mask != 0 )
+		{
+			return( data_offset + libfwsi_string_scan_get_first_bit_index( mask ) );
+		}
+		data_offset += 32;
+	}
+	return( libfwsi_string_scan_find_byte_terminator_sse2(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+/* Finds the first 16-bit aligned 16-bit value of 0 using AVX2
+ * Returns the offset of the 16-bit value or data_size if not found
+ */
+__attribute__((target("avx2")))
+static size_t libfwsi_string_scan_find_utf16_terminator_avx2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	__m256i zero_vector = _mm256_setzero_si256();
+	__m256i data_vector;
+	uint32_t mask       = 0;
+
+	while( ( data_offset + 32 ) <= data_size )
+	{
+		data_vector = _mm256_loadu_si256(
+		               (const __m256i *) &( data[ data_offset ] ) );
+
+		mask = (uint32_t) _mm256_movemask_epi8(
+		                   _mm256_cmpeq_epi16(
+		                    data_vector,
+		                    zero_vector ) );
+
+		if( mask != 0 )
+		{
+			return( data_offset + libfwsi_string_scan_get_first_bit_index( mask ) );
+		}
+		data_offset += 32;
+	}
+	return( libfwsi_string_scan_find_utf16_terminator_sse2(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 ) */
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_NEON )
+
+/* Finds the first byte with a value of 0 using NEON
+ * Returns the offset of the byte or data_size if not found
+ */
+static size_t libfwsi_string_scan_find_byte_terminator_neon(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	uint8x16_t zero_vector = vdupq_n_u8( 0 );
+	uint8x16_t data_vector;
+
+	while( ( data_offset + 16 ) <= data_size )
+	{
+		data_vector = vld1q_u8(
+		               &( data[ data_offset ] ) );
+
+		if( vmaxvq_u8( vceqq_u8( data_vector, zero_vector ) ) != 0 )
+		{
+			/* The block contains the terminator
+			 */
+			return( libfwsi_string_scan_find_byte_terminator_portable(
+			         data,
+			         data_offset + 16,
+			         data_offset ) );
+		}
+		data_offset += 16;
+	}
+	return( libfwsi_string_scan_find_byte_terminator_portable(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+/* Finds the first 16-bit aligned 16-bit value of 0 using NEON
+ * Returns the offset of the 16-bit value or data_size if not found
+ */
+static size_t libfwsi_string_scan_find_utf16_terminator_neon(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	uint16x8_t zero_vector = vdupq_n_u16( 0 );
+	uint16x8_t data_vector;
+
+	while( ( data_offset + 16 ) <= data_size )
+	{
+		data_vector = vreinterpretq_u16_u8(
+		               vld1q_u8(
+		                &( data[ data_offset ] ) ) );
+
+		if( vmaxvq_u16( vceqq_u16( data_vector, zero_vector ) ) != 0 )
+		{
+			/* The block contains the terminator
+			 */
+			return( libfwsi_string_scan_find_utf16_terminator_portable(
+			         data,
+			         data_offset + 16,
+			         data_offset ) );
+		}
+		data_offset += 16;
+	}
+	return( libfwsi_string_scan_find_utf16_terminator_portable(
+	         data,
+	         data_size,
+	         data_offset ) );
+}
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_NEON ) */
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+
+/* The string scanning kernel selected on first use, where -1 represents not selected
+ */
+static int libfwsi_string_scan_selected_kernel = -1;
+
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 ) */
+
+/* Retrieves the fastest string scanning kernel supported by the CPU
+ * The CPU features are only detected on first use
+ * Returns a LIBFWSI_STRING_SCAN_KERNELS value
+ */
+int libfwsi_string_scan_get_kernel(
+     void )
+{
+#if defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+	int kernel = __atomic_load_n(
+	              &libfwsi_string_scan_selected_kernel,
+	              __ATOMIC_RELAXED );
+
+	if( kernel != -1 )
+	{
+		return( kernel );
+	}
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		kernel = LIBFWSI_STRING_SCAN_KERNEL_AVX2;
+	}
+	else
+	{
+		kernel = LIBFWSI_STRING_SCAN_KERNEL_SSE2;
+	}
+	/* Concurrent first uses select the same kernel
+	 */
+	__atomic_store_n(
+	 &libfwsi_string_scan_selected_kernel,
+	 kernel,
+	 __ATOMIC_RELAXED );
+
+	return( kernel );
+
+#elif defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+	return( LIBFWSI_STRING_SCAN_KERNEL_SSE2 );
+
+#elif defined( LIBFWSI_STRING_SCAN_HAVE_NEON )
+	return( LIBFWSI_STRING_SCAN_KERNEL_NEON );
+
+#else
+	return( LIBFWSI_STRING_SCAN_KERNEL_PORTABLE );
+#endif
+}
+
+/* Finds the first byte with a value of 0
+ * Kernels that are not supported by the build fall back to the portable kernel
+ * Returns the offset of the byte or data_size if not found
+ */
+size_t libfwsi_string_scan_find_byte_terminator(
+        const uint8_t *data,
+        size_t data_size,
+        int kernel )
+{
+	switch( kernel )
+	{
+#if defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+		case LIBFWSI_STRING_SCAN_KERNEL_AVX2:
+			return( libfwsi_string_scan_find_byte_terminator_avx2(
+			         data,
+			         data_size,
+			         0 ) );
+#endif
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+		case LIBFWSI_STRING_SCAN_KERNEL_SSE2:
+			return( libfwsi_string_scan_find_byte_terminator_sse2(
+			         data,
+			         data_size,
+			         0 ) );
+#endif
+#if defined( LIBFWSI_STRING_SCAN_HAVE_NEON )
+		case LIBFWSI_STRING_SCAN_KERNEL_NEON:
+			return( libfwsi_string_scan_find_byte_terminator_neon(
+			         data,
+			         data_size,
+			         0 ) );
+#endif
+		default:
+			break;
+	}
+	return( libfwsi_string_scan_find_byte_terminator_portable(
+	         data,
+	         data_size,
+	         0 ) );
+}
+
+/* Finds the first 16-bit aligned 16-bit value of 0
+ * Kernels that are not supported by the build fall back to the portable kernel
+ * Returns the offset of the 16-bit value or data_size if not found
+ */
+size_t libfwsi_string_scan_find_utf16_terminator(
+        const uint8_t *data,
+        size_t data_size,
+        int kernel )
+{
+	switch( kernel )
+	{
+#if defined( LIBFWSI_STRING_SCAN_HAVE_AVX2 )
+		case LIBFWSI_STRING_SCAN_KERNEL_AVX2:
+			return( libfwsi_string_scan_find_utf16_terminator_avx2(
+			         data,
+			         data_size,
+			         0 ) );
+#endif
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+		case LIBFWSI_STRING_SCAN_KERNEL_SSE2:
+			return( libfwsi_string_scan_find_utf16_terminator_sse2(
+			         data,
+			         data_size,
+			         0 ) );
+#endif
+#if defined( LIBFWSI_STRING_SCAN_HAVE_NEON )
+		case LIBFWSI_STRING_SCAN_KERNEL_NEON:
+			return( libfwsi_string_scan_find_utf16_terminator_neon(
+			         data,
+			         data_size,
+			         0 ) );
+#endif
+		default:
+			break;
+	}
+	return( libfwsi_string_scan_find_utf16_terminator_portable(
+	         data,
+	         data_size,
+	         0 ) );
+}
+
+/* Determines the size of a byte string that starts at the data offset
+ * The caller is responsible for passing valid data
+ * Returns the size of the string including the end-of-string character or
+ * the remaining data size if the end-of-string character was not found
+ */
+size_t libfwsi_string_scan_get_byte_string_size(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset )
+{
+	size_t scan_size    = 0;
+	size_t string_index = 0;
+	int kernel          = LIBFWSI_STRING_SCAN_KERNEL_PORTABLE;
+
+	if( data_offset >= data_size )
+	{
+		return( 0 );
+	}
+	scan_size = data_size - data_offset;
+
+	if( scan_size >= LIBFWSI_STRING_SCAN_MINIMUM_VECTOR_SIZE )
+	{
+		kernel = libfwsi_string_scan_get_kernel();
+	}
+	string_index = libfwsi_string_scan_find_byte_terminator(
+	                &( data[ data_offset ] ),
+	                scan_size,
+	                kernel );
+
+	if( string_index < scan_size )
+	{
+		return( string_index + 1 );
+	}
+	return( scan_size );
+}
+
+/* Determines the size of an UTF-16 string that starts at the data offset
+ * The caller is responsible for passing valid data
+ * Returns the size of the string including the end-of-string character or
+ * the size of the remaining 16-bit values if the end-of-string character was not found
+ */
+size_t libfwsi_string_scan_get_utf16_string_size(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset )
+{
+	size_t scan_size    = 0;
+	size_t string_index = 0;
+	int kernel          = LIBFWSI_STRING_SCAN_KERNEL_PORTABLE;
+
+	if( data_offset >= data_size )
+	{
+		return( 0 );
+	}
+	scan_size = data_size - data_offset;
+
+	if( scan_size >= LIBFWSI_STRING_SCAN_MINIMUM_VECTOR_SIZE )
+	{
+		kernel = libfwsi_string_scan_get_kernel();
+	}
+	string_index = libfwsi_string_scan_find_utf16_terminator(
+	                &( data[ data_offset ] ),
+	                scan_size,
+	                kernel );
+
+	if( string_index < scan_size )
+	{
+		return( string_index + 2 );
+	}
+	return( scan_size - ( scan_size % 2 ) );
+}
+
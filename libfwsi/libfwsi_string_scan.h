@@ -0,0 +1,90 @@
+/*
+ * String scanning functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_STRING_SCAN_H )
+#define _LIBFWSI_STRING_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SSE2 kernels are available on every x86-64 and most x86 targets
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBFWSI_STRING_SCAN_HAVE_SSE2		1
+#endif
+
+/* The AVX2 kernels are compiled for a per function target and selected at runtime
+ */
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) && defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBFWSI_STRING_SCAN_HAVE_AVX2		1
+#endif
+
+/* The NEON kernels are available on every AArch64 target
+ */
+#if defined( __aarch64__ ) && defined( __ARM_NEON )
+#define LIBFWSI_STRING_SCAN_HAVE_NEON		1
+#endif
+
+/* The minimum number of bytes to scan before the vector kernels are used
+ */
+#define LIBFWSI_STRING_SCAN_MINIMUM_VECTOR_SIZE	16
+
+enum LIBFWSI_STRING_SCAN_KERNELS
+{
+	LIBFWSI_STRING_SCAN_KERNEL_PORTABLE	= 0,
+	LIBFWSI_STRING_SCAN_KERNEL_SSE2		= 1,
+	LIBFWSI_STRING_SCAN_KERNEL_AVX2		= 2,
+	LIBFWSI_STRING_SCAN_KERNEL_NEON		= 3
+};
+
+int libfwsi_string_scan_get_kernel(
+     void );
+
+size_t libfwsi_string_scan_find_byte_terminator(
+        const uint8_t *data,
+        size_t data_size,
+        int kernel );
+
+size_t libfwsi_string_scan_find_utf16_terminator(
+        const uint8_t *data,
+        size_t data_size,
+        int kernel );
+
+size_t libfwsi_string_scan_get_byte_string_size(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset );
+
+size_t libfwsi_string_scan_get_utf16_string_size(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_STRING_SCAN_H ) */
+
@@ -34,17 +34,177 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfwsi_carver {}		libfwsi_carver_t;
 typedef struct libfwsi_extension_block {}	libfwsi_extension_block_t;
 typedef struct libfwsi_item {}			libfwsi_item_t;
+typedef struct libfwsi_item_cache {}		libfwsi_item_cache_t;
 typedef struct libfwsi_item_list {}		libfwsi_item_list_t;
+typedef struct libfwsi_item_list_iterator {}	libfwsi_item_list_iterator_t;
 
 #else
+typedef intptr_t libfwsi_carver_t;
 typedef intptr_t libfwsi_extension_block_t;
 typedef intptr_t libfwsi_item_t;
+typedef intptr_t libfwsi_item_cache_t;
 typedef intptr_t libfwsi_item_list_t;
+typedef intptr_t libfwsi_item_list_iterator_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The parse callbacks
+ * A callback returns 1 to continue parsing, 0 to stop parsing or -1 on error
+ * Callbacks that are NULL are not invoked
+ * Data and strings passed to the callbacks reference the byte stream being parsed
+ * or memory that is only valid during the callback
+ */
+typedef struct libfwsi_parse_callbacks libfwsi_parse_callbacks_t;
+
+struct libfwsi_parse_callbacks
+{
+	/* Invoked at the start of a shell item
+	 */
+	int (*on_item_begin)(
+	       void *user_data,
+	       int item_index,
+	       int item_type,
+	       uint8_t class_type,
+	       const uint8_t *data,
+	       size_t data_size );
+
+	/* Invoked for a file entry shell item
+	 * The name is an extended ASCII string or an UTF-16 little-endian string if is_unicode is set
+	 */
+	int (*on_file_entry)(
+	       void *user_data,
+	       uint32_t file_size,
+	       uint32_t modification_time,
+	       uint16_t file_attribute_flags,
+	       const uint8_t *name,
+	       size_t name_size,
+	       uint8_t is_unicode );
+
+	/* Invoked for a volume shell item
+	 * The name is an extended ASCII string
+	 */
+	int (*on_volume)(
+	       void *user_data,
+	       const uint8_t *name,
+	       size_t name_size );
+
+	/* Invoked for every extension block of a shell item
+	 */
+	int (*on_extension_block)(
+	       void *user_data,
+	       uint32_t signature,
+	       uint16_t version,
+	       const uint8_t *data,
+	       size_t data_size );
+
+	/* Invoked at the end of a shell item
+	 */
+	int (*on_item_end)(
+	       void *user_data,
+	       int item_index,
+	       int item_type );
+};
+
+/* The batch parse input
+ * Describes a single shell item list byte stream of a batch
+ */
+typedef struct libfwsi_batch_input libfwsi_batch_input_t;
+
+struct libfwsi_batch_input
+{
+	/* The byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+};
+
+/* The shell item scan entry
+ * Describes the structure of a single shell item of a shell item list
+ */
+typedef struct libfwsi_item_scan_entry libfwsi_item_scan_entry_t;
+
+struct libfwsi_item_scan_entry
+{
+	/* The offset of the shell item relative to the start of the byte stream
+	 */
+	size_t offset;
+
+	/* The size of the shell item
+	 */
+	uint16_t size;
+
+	/* The class type
+	 */
+	uint8_t class_type;
+
+	/* The item type
+	 */
+	int item_type;
+
+	/* The number of extension blocks
+	 */
+	int number_of_extension_blocks;
+};
+
+/* The carver hit
+ * Describes a shell item list found by the carver
+ */
+typedef struct libfwsi_carver_hit libfwsi_carver_hit_t;
+
+struct libfwsi_carver_hit
+{
+	/* The offset of the shell item list relative to the start of the buffer
+	 */
+	size_t offset;
+
+	/* The size of the shell item list including the terminator
+	 */
+	size_t size;
+
+	/* The number of shell items
+	 */
+	int number_of_items;
+
+	/* The confidence, a value between 0 and 100
+	 */
+	uint8_t confidence;
+};
+
+/* The timestamp
+ * Describes a timestamp of an item in an item list
+ */
+typedef struct libfwsi_timestamp libfwsi_timestamp_t;
+
+struct libfwsi_timestamp
+{
+	/* The FILETIME, 0 if the FAT date time is invalid
+	 * The FAT date time is stored in local time and no time zone is applied
+	 */
+	uint64_t filetime;
+
+	/* The FAT date time
+	 */
+	uint32_t fat_date_time;
+
+	/* The index of the item in the item list
+	 */
+	int item_index;
+
+	/* The timestamp type
+	 */
+	uint8_t type;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFWSI ) */
 
 #endif /* !defined( _LIBFWSI_INTERNAL_TYPES_H ) */
@@ -29,6 +29,7 @@
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfdatetime.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_scan.h"
 #include "libfwsi_uri_values.h"
 
 /* Creates URI values
@@ -546,34 +547,17 @@ int libfwsi_uri_values_read_data(
 	 */
 	if( ( flags & 0x80 ) != 0 )
 	{
-		for( string_size = data_offset;
-		     ( string_size + 1 ) < data_size;
-		     string_size += 2 )
-		{
-			if( ( data[ string_size ] == 0 )
-			 && ( data[ string_size + 1 ] == 0 ) )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= data_offset;
+		string_size = libfwsi_string_scan_get_utf16_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 	}
 	else
 	{
-		for( string_size = data_offset;
-		     string_size < data_size;
-		     string_size++ )
-		{
-			if( data[ string_size ] == 0 )
-			{
-				string_size++;
-
-				break;
-			}
-		}
-		string_size -= data_offset;
+		string_size = libfwsi_string_scan_get_byte_string_size(
+		               data,
+		               data_size,
+		               data_offset );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -68,6 +68,19 @@ int libfwsi_users_property_view_get_known_folder_identifier(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_users_property_view_values_get_known_folder_identifier(
 	          (libfwsi_users_property_view_values_t *) internal_item->value,
 	          guid_data,
@@ -124,6 +137,19 @@ int libfwsi_users_property_view_get_property_store_data_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	users_property_view_values = (libfwsi_users_property_view_values_t *) internal_item->value;
 
 	if( data_size == NULL )
@@ -179,6 +205,19 @@ int libfwsi_users_property_view_copy_property_store_data(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	users_property_view_values = (libfwsi_users_property_view_values_t *) internal_item->value;
 
 	if( data == NULL )
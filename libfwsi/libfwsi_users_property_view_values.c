@@ -127,11 +127,6 @@ int libfwsi_users_property_view_values_free(
 	}
 	if( *users_property_view_values != NULL )
 	{
-		if( ( *users_property_view_values )->property_store_data != NULL )
-		{
-			memory_free(
-			 ( *users_property_view_values )->property_store_data );
-		}
 		memory_free(
 		 *users_property_view_values );
 
@@ -414,34 +409,7 @@ int libfwsi_users_property_view_values_read_data(
 #endif
 	if( property_store_size > 0 )
 	{
-		users_property_view_values->property_store_data = (uint8_t *) memory_allocate(
-		                                                               sizeof( uint8_t ) * property_store_size );
-
-		if( users_property_view_values->property_store_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create property store data.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     users_property_view_values->property_store_data,
-		     &( data[ data_offset ] ),
-		     property_store_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy property store data.",
-			 function );
-
-			goto on_error;
-		}
+		users_property_view_values->property_store_data = &( data[ data_offset ] );
 		users_property_view_values->property_store_data_size = property_store_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -486,13 +454,7 @@ int libfwsi_users_property_view_values_read_data(
 	return( 1 );
 
 on_error:
-	if( users_property_view_values->property_store_data != NULL )
-	{
-		memory_free(
-		 users_property_view_values->property_store_data );
-
-		users_property_view_values->property_store_data = NULL;
-	}
+	users_property_view_values->property_store_data = NULL;
 	users_property_view_values->property_store_data_size = 0;
 
 	return( -1 );
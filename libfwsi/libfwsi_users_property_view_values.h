@@ -45,7 +45,7 @@ struct libfwsi_users_property_view_values
 
 	/* The property store data
 	 */
-	uint8_t *property_store_data;
+	const uint8_t *property_store_data;
 
 	/* The property store data size
 	 */
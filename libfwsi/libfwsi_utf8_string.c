@@ -0,0 +1,692 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_string_scan.h"
+#include "libfwsi_utf8_string.h"
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+/* The NEON kernels narrow the UTF-16 values in the lanes of the vector
+ * which only contain little-endian values on little-endian targets
+ */
+#if defined( LIBFWSI_STRING_SCAN_HAVE_NEON ) && !defined( __ARM_BIG_ENDIAN )
+#define LIBFWSI_UTF8_STRING_HAVE_NEON	1
+
+#include <arm_neon.h>
+#endif
+
+/* Determines if an UTF-16 stream value is a byte order mark
+ */
+#define libfwsi_utf8_string_is_byte_order_mark( utf16_stream ) \
+	( ( ( ( utf16_stream )[ 0 ] == 0xff ) && ( ( utf16_stream )[ 1 ] == 0xfe ) ) \
+	 || ( ( ( utf16_stream )[ 0 ] == 0xfe ) && ( ( utf16_stream )[ 1 ] == 0xff ) ) )
+
+/* Copies the leading ASCII characters of an UTF-16 little-endian stream
+ * The copy stops at the first value that is 0 or larger than 0x007f
+ * The UTF-8 string can be NULL to only count the characters, otherwise
+ * it must be large enough to contain number_of_values characters
+ * Returns the number of ASCII characters
+ */
+size_t libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+        uint8_t *utf8_string,
+        const uint8_t *utf16_stream,
+        size_t number_of_values )
+{
+	size_t value_index    = 0;
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+	__m128i ascii_mask    = _mm_set1_epi16( (short) 0xff80 );
+	__m128i zero_vector   = _mm_setzero_si128();
+	__m128i first_vector;
+	__m128i second_vector;
+	int mask              = 0;
+
+	/* Narrow 16 values at a time
+	 */
+	while( ( value_index + 16 ) <= number_of_values )
+	{
+		first_vector = _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ value_index * 2 ] ) );
+
+		second_vector = _mm_loadu_si128(
+		                 (const __m128i *) &( utf16_stream[ ( value_index * 2 ) + 16 ] ) );
+
+		mask = _mm_movemask_epi8(
+		        _mm_cmpeq_epi16(
+		         _mm_and_si128(
+		          _mm_or_si128(
+		           first_vector,
+		           second_vector ),
+		          ascii_mask ),
+		         zero_vector ) );
+
+		if( mask != 0xffff )
+		{
+			break;
+		}
+		mask = _mm_movemask_epi8(
+		        _mm_cmpeq_epi16(
+		         first_vector,
+		         zero_vector ) )
+		     | _mm_movemask_epi8(
+		        _mm_cmpeq_epi16(
+		         second_vector,
+		         zero_vector ) );
+
+		if( mask != 0 )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			_mm_storeu_si128(
+			 (__m128i *) &( utf8_string[ value_index ] ),
+			 _mm_packus_epi16(
+			  first_vector,
+			  second_vector ) );
+		}
+		value_index += 16;
+	}
+	/* Narrow 8 values at a time
+	 */
+	if( ( value_index + 8 ) <= number_of_values )
+	{
+		first_vector = _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ value_index * 2 ] ) );
+
+		mask = _mm_movemask_epi8(
+		        _mm_cmpeq_epi16(
+		         _mm_and_si128(
+		          first_vector,
+		          ascii_mask ),
+		         zero_vector ) )
+		     & ~_mm_movemask_epi8(
+		         _mm_cmpeq_epi16(
+		          first_vector,
+		          zero_vector ) );
+
+		if( mask == 0xffff )
+		{
+			if( utf8_string != NULL )
+			{
+				_mm_storel_epi64(
+				 (__m128i *) &( utf8_string[ value_index ] ),
+				 _mm_packus_epi16(
+				  first_vector,
+				  first_vector ) );
+			}
+			value_index += 8;
+		}
+	}
+#elif defined( LIBFWSI_UTF8_STRING_HAVE_NEON )
+	uint16x8_t first_vector;
+	uint16x8_t second_vector;
+
+	/* Narrow 16 values at a time
+	 */
+	while( ( value_index + 16 ) <= number_of_values )
+	{
+		first_vector = vreinterpretq_u16_u8(
+		                vld1q_u8(
+		                 &( utf16_stream[ value_index * 2 ] ) ) );
+
+		second_vector = vreinterpretq_u16_u8(
+		                 vld1q_u8(
+		                  &( utf16_stream[ ( value_index * 2 ) + 16 ] ) ) );
+
+		if( ( vmaxvq_u16( vorrq_u16( first_vector, second_vector ) ) > 0x007f )
+		 || ( vminvq_u16( vminq_u16( first_vector, second_vector ) ) == 0 ) )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			vst1q_u8(
+			 &( utf8_string[ value_index ] ),
+			 vcombine_u8(
+			  vmovn_u16(
+			   first_vector ),
+			  vmovn_u16(
+			   second_vector ) ) );
+		}
+		value_index += 16;
+	}
+	/* Narrow 8 values at a time
+	 */
+	if( ( value_index + 8 ) <= number_of_values )
+	{
+		first_vector = vreinterpretq_u16_u8(
+		                vld1q_u8(
+		                 &( utf16_stream[ value_index * 2 ] ) ) );
+
+		if( ( vmaxvq_u16( first_vector ) <= 0x007f )
+		 && ( vminvq_u16( first_vector ) != 0 ) )
+		{
+			if( utf8_string != NULL )
+			{
+				vst1_u8(
+				 &( utf8_string[ value_index ] ),
+				 vmovn_u16(
+				  first_vector ) );
+			}
+			value_index += 8;
+		}
+	}
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) */
+
+	while( value_index < number_of_values )
+	{
+		if( ( utf16_stream[ ( value_index * 2 ) + 1 ] != 0 )
+		 || ( utf16_stream[ value_index * 2 ] == 0 )
+		 || ( utf16_stream[ value_index * 2 ] > 0x7f ) )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			utf8_string[ value_index ] = utf16_stream[ value_index * 2 ];
+		}
+		value_index++;
+	}
+	return( value_index );
+}
+
+/* Copies the leading ASCII characters of a byte stream
+ * The copy stops at the first byte that is 0 or larger than 0x7f
+ * The UTF-8 string can be NULL to only count the characters, otherwise
+ * it must be large enough to contain byte_stream_size characters
+ * Returns the number of ASCII characters
+ */
+size_t libfwsi_utf8_string_copy_ascii_from_byte_stream(
+        uint8_t *utf8_string,
+        const uint8_t *byte_stream,
+        size_t byte_stream_size )
+{
+	size_t byte_stream_index = 0;
+
+#if defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 )
+	__m128i zero_vector      = _mm_setzero_si128();
+	__m128i data_vector;
+
+	while( ( byte_stream_index + 16 ) <= byte_stream_size )
+	{
+		data_vector = _mm_loadu_si128(
+		               (const __m128i *) &( byte_stream[ byte_stream_index ] ) );
+
+		/* The most significant bits and bytes of 0 end the ASCII characters
+		 */
+		if( ( _mm_movemask_epi8( data_vector ) != 0 )
+		 || ( _mm_movemask_epi8( _mm_cmpeq_epi8( data_vector, zero_vector ) ) != 0 ) )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			_mm_storeu_si128(
+			 (__m128i *) &( utf8_string[ byte_stream_index ] ),
+			 data_vector );
+		}
+		byte_stream_index += 16;
+	}
+#elif defined( LIBFWSI_UTF8_STRING_HAVE_NEON )
+	uint8x16_t data_vector;
+
+	while( ( byte_stream_index + 16 ) <= byte_stream_size )
+	{
+		data_vector = vld1q_u8(
+		               &( byte_stream[ byte_stream_index ] ) );
+
+		if( ( vmaxvq_u8( data_vector ) > 0x7f )
+		 || ( vminvq_u8( data_vector ) == 0 ) )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			vst1q_u8(
+			 &( utf8_string[ byte_stream_index ] ),
+			 data_vector );
+		}
+		byte_stream_index += 16;
+	}
+#endif /* defined( LIBFWSI_STRING_SCAN_HAVE_SSE2 ) */
+
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( ( byte_stream[ byte_stream_index ] == 0 )
+		 || ( byte_stream[ byte_stream_index ] > 0x7f ) )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			utf8_string[ byte_stream_index ] = byte_stream[ byte_stream_index ];
+		}
+		byte_stream_index++;
+	}
+	return( byte_stream_index );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 stream
+ * Leading ASCII characters of a little-endian stream are counted directly,
+ * the remainder of the stream is handled by libuna
+ * The size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwsi_utf8_string_size_from_utf16_stream";
+	size_t number_of_characters  = 0;
+	size_t number_of_values      = 0;
+	size_t remaining_string_size = 0;
+	size_t utf16_stream_offset   = 0;
+
+	/* Invalid arguments are reported by libuna
+	 */
+	if( ( utf16_stream != NULL )
+	 && ( utf16_stream_size <= (size_t) SSIZE_MAX )
+	 && ( ( utf16_stream_size % 2 ) == 0 )
+	 && ( ( byte_order & 0xff ) == LIBUNA_ENDIAN_LITTLE )
+	 && ( utf8_string_size != NULL ) )
+	{
+		number_of_values = utf16_stream_size / 2;
+	}
+	if( number_of_values > 0 )
+	{
+		number_of_characters = libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+		                        NULL,
+		                        utf16_stream,
+		                        number_of_values );
+
+		utf16_stream_offset = number_of_characters * 2;
+
+		if( ( number_of_characters == number_of_values )
+		 || ( ( utf16_stream[ utf16_stream_offset ] == 0 )
+		  &&  ( utf16_stream[ utf16_stream_offset + 1 ] == 0 ) ) )
+		{
+			*utf8_string_size = number_of_characters + 1;
+
+			return( 1 );
+		}
+		/* libuna would skip a byte order mark at the start of the remainder
+		 */
+		if( ( number_of_characters > 0 )
+		 && !libfwsi_utf8_string_is_byte_order_mark( &( utf16_stream[ utf16_stream_offset ] ) ) )
+		{
+			if( libuna_utf8_string_size_from_utf16_stream(
+			     &( utf16_stream[ utf16_stream_offset ] ),
+			     utf16_stream_size - utf16_stream_offset,
+			     byte_order,
+			     &remaining_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size of UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			*utf8_string_size = number_of_characters + remaining_string_size;
+
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     byte_order,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 stream
+ * Leading ASCII characters of a little-endian stream are copied directly,
+ * the remainder of the stream is handled by libuna
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfwsi_utf8_string_copy_from_utf16_stream";
+	size_t maximum_number_of_values = 0;
+	size_t number_of_characters     = 0;
+	size_t number_of_values         = 0;
+	size_t utf16_stream_offset      = 0;
+
+	/* Invalid arguments are reported by libuna
+	 */
+	if( ( utf8_string != NULL )
+	 && ( utf8_string_size <= (size_t) SSIZE_MAX )
+	 && ( utf16_stream != NULL )
+	 && ( utf16_stream_size <= (size_t) SSIZE_MAX )
+	 && ( ( utf16_stream_size % 2 ) == 0 )
+	 && ( ( byte_order & 0xff ) == LIBUNA_ENDIAN_LITTLE ) )
+	{
+		number_of_values = utf16_stream_size / 2;
+	}
+	if( number_of_values > 0 )
+	{
+		maximum_number_of_values = number_of_values;
+
+		if( maximum_number_of_values > utf8_string_size )
+		{
+			maximum_number_of_values = utf8_string_size;
+		}
+		number_of_characters = libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+		                        utf8_string,
+		                        utf16_stream,
+		                        maximum_number_of_values );
+
+		utf16_stream_offset = number_of_characters * 2;
+
+		if( ( number_of_characters == number_of_values )
+		 || ( ( utf16_stream[ utf16_stream_offset ] == 0 )
+		  &&  ( utf16_stream[ utf16_stream_offset + 1 ] == 0 ) ) )
+		{
+			if( number_of_characters >= utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ number_of_characters ] = 0;
+
+			return( 1 );
+		}
+		if( number_of_characters >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		/* libuna would skip a byte order mark at the start of the remainder
+		 */
+		if( ( number_of_characters > 0 )
+		 && !libfwsi_utf8_string_is_byte_order_mark( &( utf16_stream[ utf16_stream_offset ] ) ) )
+		{
+			if( libuna_utf8_string_copy_from_utf16_stream(
+			     &( utf8_string[ number_of_characters ] ),
+			     utf8_string_size - number_of_characters,
+			     &( utf16_stream[ utf16_stream_offset ] ),
+			     utf16_stream_size - utf16_stream_offset,
+			     byte_order,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     utf16_stream,
+	     utf16_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from a byte stream
+ * Leading ASCII characters are counted directly, the remainder of
+ * the stream is handled by libuna
+ * The size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_utf8_string_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwsi_utf8_string_size_from_byte_stream";
+	size_t number_of_characters  = 0;
+	size_t remaining_string_size = 0;
+
+	/* Invalid arguments are reported by libuna
+	 */
+	if( ( byte_stream != NULL )
+	 && ( byte_stream_size > 0 )
+	 && ( byte_stream_size <= (size_t) SSIZE_MAX )
+	 && ( utf8_string_size != NULL ) )
+	{
+		number_of_characters = libfwsi_utf8_string_copy_ascii_from_byte_stream(
+		                        NULL,
+		                        byte_stream,
+		                        byte_stream_size );
+
+		if( ( number_of_characters == byte_stream_size )
+		 || ( byte_stream[ number_of_characters ] == 0 ) )
+		{
+			*utf8_string_size = number_of_characters + 1;
+
+			return( 1 );
+		}
+		if( number_of_characters > 0 )
+		{
+			if( libuna_utf8_string_size_from_byte_stream(
+			     &( byte_stream[ number_of_characters ] ),
+			     byte_stream_size - number_of_characters,
+			     codepage,
+			     &remaining_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size of UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			*utf8_string_size = number_of_characters + remaining_string_size;
+
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_size_from_byte_stream(
+	     byte_stream,
+	     byte_stream_size,
+	     codepage,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from a byte stream
+ * Leading ASCII characters are copied directly, the remainder of
+ * the stream is handled by libuna
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_utf8_string_copy_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfwsi_utf8_string_copy_from_byte_stream";
+	size_t maximum_number_of_bytes = 0;
+	size_t number_of_characters    = 0;
+
+	/* Invalid arguments are reported by libuna
+	 */
+	if( ( utf8_string != NULL )
+	 && ( utf8_string_size <= (size_t) SSIZE_MAX )
+	 && ( byte_stream != NULL )
+	 && ( byte_stream_size > 0 )
+	 && ( byte_stream_size <= (size_t) SSIZE_MAX ) )
+	{
+		maximum_number_of_bytes = byte_stream_size;
+
+		if( maximum_number_of_bytes > utf8_string_size )
+		{
+			maximum_number_of_bytes = utf8_string_size;
+		}
+		number_of_characters = libfwsi_utf8_string_copy_ascii_from_byte_stream(
+		                        utf8_string,
+		                        byte_stream,
+		                        maximum_number_of_bytes );
+
+		if( ( number_of_characters == byte_stream_size )
+		 || ( byte_stream[ number_of_characters ] == 0 ) )
+		{
+			if( number_of_characters >= utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ number_of_characters ] = 0;
+
+			return( 1 );
+		}
+		if( number_of_characters >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_characters > 0 )
+		{
+			if( libuna_utf8_string_copy_from_byte_stream(
+			     &( utf8_string[ number_of_characters ] ),
+			     utf8_string_size - number_of_characters,
+			     &( byte_stream[ number_of_characters ] ),
+			     byte_stream_size - number_of_characters,
+			     codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_copy_from_byte_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     byte_stream,
+	     byte_stream_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
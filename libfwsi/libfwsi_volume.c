@@ -27,6 +27,7 @@
 #include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string_cache.h"
 #include "libfwsi_volume.h"
 #include "libfwsi_volume_values.h"
 
@@ -66,6 +67,19 @@ int libfwsi_volume_get_utf8_name_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_volume_values_get_utf8_name_size(
 	          (libfwsi_volume_values_t *) internal_item->value,
 	          utf8_string_size,
@@ -123,6 +137,19 @@ int libfwsi_volume_get_utf8_name(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_volume_values_get_utf8_name(
 	          (libfwsi_volume_values_t *) internal_item->value,
 	          utf8_string,
@@ -180,6 +207,19 @@ int libfwsi_volume_get_utf16_name_size(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_volume_values_get_utf16_name_size(
 	          (libfwsi_volume_values_t *) internal_item->value,
 	          utf16_string_size,
@@ -237,6 +277,19 @@ int libfwsi_volume_get_utf16_name(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_volume_values_get_utf16_name(
 	          (libfwsi_volume_values_t *) internal_item->value,
 	          utf16_string,
@@ -258,6 +311,134 @@ int libfwsi_volume_get_utf16_name(
 	return( result );
 }
 
+/* Retrieves the UTF-8 formatted name
+ * The name is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_volume_get_cached_utf8_name(
+     libfwsi_item_t *volume,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_volume_get_cached_utf8_name";
+	int result                             = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) volume;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf8_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_NAME,
+	          (intptr_t *) volume,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_volume_get_utf8_name_size,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfwsi_volume_get_utf8_name,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 formatted name
+ * The name is converted on first use and cached on the item, the string must not be freed
+ * and remains valid until the item is reset or freed
+ * The length does not include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_volume_get_cached_utf16_name(
+     libfwsi_item_t *volume,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_volume_get_cached_utf16_name";
+	int result                             = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) volume;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_string_cache_get_utf16_string(
+	          &( internal_item->string_cache ),
+	          LIBFWSI_STRING_CACHE_INDEX_NAME,
+	          (intptr_t *) volume,
+	          (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libfwsi_volume_get_utf16_name_size,
+	          (int (*)(intptr_t *, uint16_t *, size_t, libcerror_error_t **)) &libfwsi_volume_get_utf16_name,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the identifier
  * The identifier is a GUID and is 16 bytes of size
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -296,6 +477,19 @@ int libfwsi_volume_get_identifier(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_volume_values_get_identifier(
 	          (libfwsi_volume_values_t *) internal_item->value,
 	          guid_data,
@@ -354,6 +548,19 @@ int libfwsi_volume_get_shell_folder_identifier(
 
 		return( -1 );
 	}
+	if( libfwsi_internal_item_read_values(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfwsi_volume_values_get_shell_folder_identifier(
 	          (libfwsi_volume_values_t *) internal_item->value,
 	          guid_data,
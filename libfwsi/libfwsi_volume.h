@@ -59,6 +59,20 @@ int libfwsi_volume_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_volume_get_cached_utf8_name(
+     libfwsi_item_t *volume,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_volume_get_cached_utf16_name(
+     libfwsi_item_t *volume,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_volume_get_identifier(
      libfwsi_item_t *volume,
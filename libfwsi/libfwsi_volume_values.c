@@ -31,6 +31,8 @@
 #include "libfwsi_libfguid.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string_scan.h"
+#include "libfwsi_utf8_string.h"
 #include "libfwsi_volume_values.h"
 
 /* Creates volume values
@@ -148,7 +150,6 @@ int libfwsi_volume_values_read_data(
 {
 	static char *function        = "libfwsi_volume_values_read_data";
 	size_t data_offset           = 0;
-	size_t string_size           = 0;
 	uint8_t class_type_indicator = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -293,16 +294,12 @@ int libfwsi_volume_values_read_data(
 		}
 		volume_values->has_name = 1;
 
-		for( string_size = 0;
-		     string_size < 20;
-		     string_size++ )
-		{
-			if( volume_values->name[ string_size ] == 0 )
-			{
-				break;
-			}
-		}
-		volume_values->name_size = string_size;
+		/* The name is too small to benefit from the vector kernels
+		 */
+		volume_values->name_size = libfwsi_string_scan_find_byte_terminator(
+		                            volume_values->name,
+		                            20,
+		                            LIBFWSI_STRING_SCAN_KERNEL_PORTABLE );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -431,7 +428,7 @@ int libfwsi_volume_values_get_utf8_name_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_utf8_string_size_from_byte_stream(
 	     volume_values->name,
 	     volume_values->name_size,
 	     ascii_codepage,
@@ -477,7 +474,7 @@ int libfwsi_volume_values_get_utf8_name(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_utf8_string_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     volume_values->name,
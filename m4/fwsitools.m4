@@ -0,0 +1,17 @@
+dnl Functions for fwsitools
+dnl
+dnl Version: 20261017
+
+dnl Function to detect if fwsitools dependencies are available
+AC_DEFUN([AX_FWSITOOLS_CHECK_LOCAL],
+  [AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h unistd.h])
+
+  AC_CHECK_FUNCS([close getopt lseek madvise mmap munmap open sysconf])
+
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno && test "x$ac_cv_func_getopt" != xyes],
+    [AC_MSG_FAILURE(
+      [Missing function: getopt],
+      [1])
+  ])
+])
@@ -0,0 +1,729 @@
+/*
+ * Library arena functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_arena_t *arena   = NULL;
+	int result               = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_arena_initialize(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_arena_free(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_arena_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libfwsi_arena_t *) 0x12345678UL;
+
+	result = libfwsi_arena_initialize(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = NULL;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_arena_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_arena_initialize(
+		          &arena,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwsi_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_arena_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_arena_initialize(
+		          &arena,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwsi_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwsi_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_arena_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_arena_t *arena   = NULL;
+	uint8_t *data1           = NULL;
+	uint8_t *data2           = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_arena_initialize(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_arena_allocate(
+	          arena,
+	          3,
+	          &data1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "data1",
+	 data1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_arena_allocate(
+	          arena,
+	          8,
+	          &data2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Allocations are aligned and taken from the same block
+	 */
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "data2 - data1",
+	 (int) ( data2 - data1 ),
+	 LIBFWSI_ARENA_ALIGNMENT );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 1 );
+
+	/* Test an allocation that exceeds the maximum block size
+	 */
+	result = libfwsi_arena_allocate(
+	          arena,
+	          LIBFWSI_ARENA_MAXIMUM_BLOCK_SIZE + 1,
+	          &data1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_arena_allocate(
+	          NULL,
+	          8,
+	          &data1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_arena_allocate(
+	          arena,
+	          0,
+	          &data1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_arena_allocate(
+	          arena,
+	          (size_t) SSIZE_MAX + 1,
+	          &data1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_arena_allocate(
+	          arena,
+	          8,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	/* Test libfwsi_arena_allocate with malloc failing
+	 */
+	fwsi_test_malloc_attempts_before_fail = 0;
+
+	result = libfwsi_arena_allocate(
+	          arena,
+	          LIBFWSI_ARENA_MAXIMUM_BLOCK_SIZE,
+	          &data1,
+	          &error );
+
+	if( fwsi_test_malloc_attempts_before_fail != -1 )
+	{
+		fwsi_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfwsi_arena_free(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwsi_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_arena_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_arena_t *arena   = NULL;
+	uint8_t *data1           = NULL;
+	uint8_t *data2           = NULL;
+	int allocation_index     = 0;
+	int number_of_blocks     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_arena_initialize(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( allocation_index = 0;
+	     allocation_index < 64;
+	     allocation_index++ )
+	{
+		result = libfwsi_arena_allocate(
+		          arena,
+		          256,
+		          &data2,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( allocation_index == 0 )
+		{
+			data1 = data2;
+		}
+	}
+	number_of_blocks = arena->number_of_blocks;
+
+	FWSI_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_arena_reset(
+	          arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The blocks are retained and reused after a reset
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 64;
+	     allocation_index++ )
+	{
+		result = libfwsi_arena_allocate(
+		          arena,
+		          256,
+		          &data2,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( allocation_index == 0 )
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "data2 == data1",
+			 (int) ( data2 == data1 ),
+			 1 );
+		}
+	}
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 number_of_blocks );
+
+	/* Test error cases
+	 */
+	result = libfwsi_arena_reset(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_arena_free(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwsi_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_arena_initialize",
+	 fwsi_test_arena_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_arena_free",
+	 fwsi_test_arena_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_arena_allocate",
+	 fwsi_test_arena_allocate );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_arena_reset",
+	 fwsi_test_arena_reset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+}
+
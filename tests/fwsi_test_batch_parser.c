@@ -0,0 +1,423 @@
+/*
+ * Library batch parser functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+unsigned char fwsi_test_batch_parser_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+#define FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS		200
+
+/* Tests the libfwsi_item_list_batch_parse function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_batch_parse(
+     void )
+{
+	libfwsi_batch_input_t inputs[ FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS ];
+	libfwsi_item_list_t *item_lists[ FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS ];
+	int results[ FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS ];
+
+	libcerror_error_t *error   = NULL;
+	int input_index            = 0;
+	int number_of_items        = 0;
+	int number_of_threads      = 0;
+	int result                 = 0;
+	int threads_index          = 0;
+
+	/* Initialize test
+	 */
+	for( input_index = 0;
+	     input_index < FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS;
+	     input_index++ )
+	{
+		inputs[ input_index ].byte_stream      = &( fwsi_test_batch_parser_data1[ 2 ] );
+		inputs[ input_index ].byte_stream_size = 343;
+		inputs[ input_index ].ascii_codepage   = LIBFWSI_CODEPAGE_WINDOWS_1252;
+
+		item_lists[ input_index ] = NULL;
+	}
+	/* Test regular cases
+	 */
+	for( threads_index = 0;
+	     threads_index < 3;
+	     threads_index++ )
+	{
+		number_of_threads = threads_index * 2;
+
+		result = libfwsi_item_list_batch_parse(
+		          inputs,
+		          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+		          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM,
+		          number_of_threads,
+		          item_lists,
+		          results,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( input_index = 0;
+		     input_index < FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS;
+		     input_index++ )
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "results[ input_index ]",
+			 results[ input_index ],
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item_lists[ input_index ]",
+			 item_lists[ input_index ] );
+
+			result = libfwsi_item_list_get_number_of_items(
+			          item_lists[ input_index ],
+			          &number_of_items,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_items",
+			 number_of_items,
+			 5 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_free(
+			          &( item_lists[ input_index ] ),
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test batch with inputs that cannot be parsed
+	 */
+	for( input_index = 0;
+	     input_index < FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS;
+	     input_index += 7 )
+	{
+		inputs[ input_index ].byte_stream_size = 1;
+	}
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+	          0,
+	          4,
+	          item_lists,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( input_index = 0;
+	     input_index < FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS;
+	     input_index++ )
+	{
+		if( ( input_index % 7 ) == 0 )
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "results[ input_index ]",
+			 results[ input_index ],
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "item_lists[ input_index ]",
+			 item_lists[ input_index ] );
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "results[ input_index ]",
+			 results[ input_index ],
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item_lists[ input_index ]",
+			 item_lists[ input_index ] );
+
+			result = libfwsi_item_list_free(
+			          &( item_lists[ input_index ] ),
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test batch without inputs
+	 */
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          0,
+	          0,
+	          4,
+	          item_lists,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_batch_parse(
+	          NULL,
+	          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+	          0,
+	          4,
+	          item_lists,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          -1,
+	          0,
+	          4,
+	          item_lists,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+	          0xff,
+	          4,
+	          item_lists,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+	          0,
+	          -1,
+	          item_lists,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+	          0,
+	          4,
+	          NULL,
+	          results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_batch_parse(
+	          inputs,
+	          FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS,
+	          0,
+	          4,
+	          item_lists,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( input_index = 0;
+	     input_index < FWSI_TEST_BATCH_PARSER_NUMBER_OF_INPUTS;
+	     input_index++ )
+	{
+		if( item_lists[ input_index ] != NULL )
+		{
+			libfwsi_item_list_free(
+			 &( item_lists[ input_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_batch_parse",
+	 fwsi_test_item_list_batch_parse );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1308 @@
+/*
+ * Library carver functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_carver.h"
+
+unsigned char fwsi_test_carver_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_carver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwsi_carver_t *carver        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carver = (libfwsi_carver_t *) 0x12345678UL;
+
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	carver = NULL;
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_carver_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libfwsi_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_carver_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libfwsi_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_get_minimum_confidence and libfwsi_carver_set_minimum_confidence functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_minimum_confidence(
+     libfwsi_carver_t *carver )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t minimum_confidence= 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_carver_get_minimum_confidence(
+	          carver,
+	          &minimum_confidence,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "minimum_confidence",
+	 minimum_confidence,
+	 50 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_minimum_confidence(
+	          carver,
+	          75,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_minimum_confidence(
+	          carver,
+	          &minimum_confidence,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "minimum_confidence",
+	 minimum_confidence,
+	 75 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_minimum_confidence(
+	          carver,
+	          50,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_get_minimum_confidence(
+	          NULL,
+	          &minimum_confidence,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_get_minimum_confidence(
+	          carver,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_set_minimum_confidence(
+	          NULL,
+	          75,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_set_minimum_confidence(
+	          carver,
+	          101,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_get_minimum_number_of_items and libfwsi_carver_set_minimum_number_of_items functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_minimum_number_of_items(
+     libfwsi_carver_t *carver )
+{
+	libcerror_error_t *error = NULL;
+	int minimum_number_of_items= 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_carver_get_minimum_number_of_items(
+	          carver,
+	          &minimum_number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "minimum_number_of_items",
+	 minimum_number_of_items,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_minimum_number_of_items(
+	          carver,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_minimum_number_of_items(
+	          carver,
+	          &minimum_number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "minimum_number_of_items",
+	 minimum_number_of_items,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_minimum_number_of_items(
+	          carver,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_get_minimum_number_of_items(
+	          NULL,
+	          &minimum_number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_get_minimum_number_of_items(
+	          carver,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_set_minimum_number_of_items(
+	          NULL,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_set_minimum_number_of_items(
+	          carver,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_scan_buffer(
+     libfwsi_carver_t *carver )
+{
+	uint8_t buffer[ 1024 ];
+
+	libfwsi_carver_hit_t hits[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	size_t buffer_offset     = 0;
+	int number_of_hits       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 * The buffer contains a shell item list at offset 100 and a shell item list
+	 * of only the "Users" file entry shell item at offset 500
+	 */
+	memory_set(
+	 buffer,
+	 0xff,
+	 1024 );
+
+	memory_copy(
+	 &( buffer[ 100 ] ),
+	 &( fwsi_test_carver_data1[ 2 ] ),
+	 343 );
+
+	memory_copy(
+	 &( buffer[ 500 ] ),
+	 &( fwsi_test_carver_data1[ 47 ] ),
+	 120 );
+
+	buffer[ 620 ] = 0x00;
+	buffer[ 621 ] = 0x00;
+
+	/* Test regular cases
+	 */
+	buffer_offset = 0;
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 1024 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits[ 0 ].offset",
+	 hits[ 0 ].offset,
+	 (size_t) 100 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits[ 0 ].size",
+	 hits[ 0 ].size,
+	 (size_t) 343 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "hits[ 0 ].number_of_items",
+	 hits[ 0 ].number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hits[ 0 ].confidence",
+	 hits[ 0 ].confidence,
+	 100 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits[ 1 ].offset",
+	 hits[ 1 ].offset,
+	 (size_t) 500 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits[ 1 ].size",
+	 hits[ 1 ].size,
+	 (size_t) 122 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "hits[ 1 ].number_of_items",
+	 hits[ 1 ].number_of_items,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hits[ 1 ].confidence",
+	 hits[ 1 ].confidence,
+	 60 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scanning with a full hits array
+	 */
+	buffer_offset = 0;
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          1,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 443 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits[ 0 ].offset",
+	 hits[ 0 ].offset,
+	 (size_t) 100 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          1,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 622 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits[ 0 ].offset",
+	 hits[ 0 ].offset,
+	 (size_t) 500 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          1,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 1024 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	buffer_offset = 0;
+
+	result = libfwsi_carver_scan_buffer(
+	          NULL,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          NULL,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &buffer_offset,
+	          hits,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          NULL,
+	          hits,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          NULL,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          0,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          4,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffer_offset = 1025;
+
+	result = libfwsi_carver_scan_buffer(
+	          carver,
+	          buffer,
+	          1024,
+	          &buffer_offset,
+	          hits,
+	          4,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_carver_find_candidate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_find_candidate(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	size_t candidate_offset = 0;
+
+	memory_set(
+	 buffer,
+	 0xff,
+	 64 );
+
+	/* Test regular cases
+	 */
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    buffer,
+	                    64,
+	                    0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 64 );
+
+	/* A root folder shell item
+	 */
+	buffer[ 37 ] = 0x14;
+	buffer[ 38 ] = 0x00;
+	buffer[ 39 ] = 0x1f;
+
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    buffer,
+	                    64,
+	                    0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 37 );
+
+	/* A file entry extension block signature
+	 */
+	buffer[ 21 ] = 0x04;
+	buffer[ 22 ] = 0x00;
+	buffer[ 23 ] = 0xef;
+	buffer[ 24 ] = 0xbe;
+
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    buffer,
+	                    64,
+	                    0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 21 );
+
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    buffer,
+	                    64,
+	                    22 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 37 );
+
+	/* A candidate at the end of the data
+	 */
+	buffer[ 61 ] = 0x14;
+	buffer[ 62 ] = 0x00;
+	buffer[ 63 ] = 0x1f;
+
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    buffer,
+	                    64,
+	                    38 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 61 );
+
+	/* Test error cases
+	 */
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    NULL,
+	                    64,
+	                    0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 64 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_get_item_offset_from_extension_block and libfwsi_carver_get_list_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_get_list_offset(
+     void )
+{
+	size_t item_offset = 0;
+	size_t list_offset = 0;
+
+	/* Test regular cases
+	 * The file entry extension block of the "Users" file entry shell item
+	 * starts at offset 67 and its signature at offset 71
+	 */
+	item_offset = libfwsi_carver_get_item_offset_from_extension_block(
+	               fwsi_test_carver_data1,
+	               345,
+	               71 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "item_offset",
+	 item_offset,
+	 (size_t) 47 );
+
+	list_offset = libfwsi_carver_get_list_offset(
+	               fwsi_test_carver_data1,
+	               item_offset,
+	               0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "list_offset",
+	 list_offset,
+	 (size_t) 2 );
+
+	list_offset = libfwsi_carver_get_list_offset(
+	               fwsi_test_carver_data1,
+	               item_offset,
+	               10 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "list_offset",
+	 list_offset,
+	 (size_t) 22 );
+
+	/* Test error cases
+	 */
+	item_offset = libfwsi_carver_get_item_offset_from_extension_block(
+	               fwsi_test_carver_data1,
+	               345,
+	               72 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "item_offset",
+	 item_offset,
+	 (size_t) 345 );
+
+	item_offset = libfwsi_carver_get_item_offset_from_extension_block(
+	               NULL,
+	               345,
+	               71 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "item_offset",
+	 item_offset,
+	 (size_t) 345 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_carver_t *carver = NULL;
+	int result               = 0;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_initialize",
+	 fwsi_test_carver_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_free",
+	 fwsi_test_carver_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_find_candidate",
+	 fwsi_test_carver_find_candidate );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_get_list_offset",
+	 fwsi_test_carver_get_list_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize carver for tests
+	 */
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_carver_minimum_confidence",
+	 fwsi_test_carver_minimum_confidence,
+	 carver );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_carver_minimum_number_of_items",
+	 fwsi_test_carver_minimum_number_of_items,
+	 carver );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_carver_scan_buffer",
+	 fwsi_test_carver_scan_buffer,
+	 carver );
+
+	/* Clean up
+	 */
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
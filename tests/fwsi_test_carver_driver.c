@@ -0,0 +1,936 @@
+/*
+ * Library carver driver functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_carver_driver.h"
+
+unsigned char fwsi_test_carver_driver_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_carver_driver_buffer[ 1024 ];
+
+typedef struct fwsi_test_carver_driver_hits fwsi_test_carver_driver_hits_t;
+
+struct fwsi_test_carver_driver_hits
+{
+	/* The offsets of the hits
+	 */
+	size_t offsets[ 8 ];
+
+	/* The sizes of the hits
+	 */
+	size_t sizes[ 8 ];
+
+	/* The number of hits
+	 */
+	int number_of_hits;
+
+	/* The number of hits after which the callback stops carving
+	 */
+	int maximum_number_of_hits;
+
+	/* The value returned by the callback
+	 */
+	int callback_result;
+};
+
+/* Initializes the carver driver test buffer
+ * The buffer contains a shell item list at offset 100 and a shell item list
+ * of only the "Users" file entry shell item at offset 500
+ */
+void fwsi_test_carver_driver_initialize_buffer(
+      void )
+{
+	memory_set(
+	 fwsi_test_carver_driver_buffer,
+	 0xff,
+	 1024 );
+
+	memory_copy(
+	 &( fwsi_test_carver_driver_buffer[ 100 ] ),
+	 &( fwsi_test_carver_driver_data1[ 2 ] ),
+	 343 );
+
+	memory_copy(
+	 &( fwsi_test_carver_driver_buffer[ 500 ] ),
+	 &( fwsi_test_carver_driver_data1[ 47 ] ),
+	 120 );
+
+	fwsi_test_carver_driver_buffer[ 620 ] = 0x00;
+	fwsi_test_carver_driver_buffer[ 621 ] = 0x00;
+}
+
+/* Resets the carver driver test hits
+ */
+void fwsi_test_carver_driver_reset_hits(
+      fwsi_test_carver_driver_hits_t *hits,
+      int maximum_number_of_hits,
+      int callback_result )
+{
+	memory_set(
+	 hits,
+	 0,
+	 sizeof( fwsi_test_carver_driver_hits_t ) );
+
+	hits->maximum_number_of_hits = maximum_number_of_hits;
+	hits->callback_result        = callback_result;
+}
+
+/* The hit callback of the carver driver tests
+ * Returns 1 to continue carving, 0 to stop carving or -1 on error
+ */
+int fwsi_test_carver_driver_hit_callback(
+     void *user_data,
+     const libfwsi_carver_hit_t *hit )
+{
+	fwsi_test_carver_driver_hits_t *hits = NULL;
+
+	if( ( user_data == NULL )
+	 || ( hit == NULL ) )
+	{
+		return( -1 );
+	}
+	hits = (fwsi_test_carver_driver_hits_t *) user_data;
+
+	if( hits->number_of_hits >= 8 )
+	{
+		return( -1 );
+	}
+	hits->offsets[ hits->number_of_hits ] = hit->offset;
+	hits->sizes[ hits->number_of_hits ]   = hit->size;
+
+	hits->number_of_hits += 1;
+
+	if( hits->number_of_hits >= hits->maximum_number_of_hits )
+	{
+		return( hits->callback_result );
+	}
+	return( 1 );
+}
+
+/* Tests the libfwsi_carver_scan_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_scan_data(
+     libfwsi_carver_t *carver )
+{
+	fwsi_test_carver_driver_hits_t hits;
+
+	size_t chunk_sizes[ 5 ] = { 0, 1024, 128, 37, 1 };
+
+	libcerror_error_t *error = NULL;
+	int chunk_size_index     = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The hits must not depend on the chunk size or the number of threads
+	 */
+	for( chunk_size_index = 0;
+	     chunk_size_index < 5;
+	     chunk_size_index++ )
+	{
+		for( number_of_threads = 0;
+		     number_of_threads <= 4;
+		     number_of_threads += 4 )
+		{
+			fwsi_test_carver_driver_reset_hits(
+			 &hits,
+			 8,
+			 1 );
+
+			result = libfwsi_carver_scan_data(
+			          carver,
+			          fwsi_test_carver_driver_buffer,
+			          1024,
+			          chunk_sizes[ chunk_size_index ],
+			          number_of_threads,
+			          &fwsi_test_carver_driver_hit_callback,
+			          &hits,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "hits.number_of_hits",
+			 hits.number_of_hits,
+			 2 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "hits.offsets[ 0 ]",
+			 hits.offsets[ 0 ],
+			 (size_t) 100 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "hits.sizes[ 0 ]",
+			 hits.sizes[ 0 ],
+			 (size_t) 343 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "hits.offsets[ 1 ]",
+			 hits.offsets[ 1 ],
+			 (size_t) 500 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "hits.sizes[ 1 ]",
+			 hits.sizes[ 1 ],
+			 (size_t) 122 );
+		}
+	}
+	/* Test carving empty data
+	 */
+	fwsi_test_carver_driver_reset_hits(
+	 &hits,
+	 8,
+	 1 );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          0,
+	          0,
+	          0,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "hits.number_of_hits",
+	 hits.number_of_hits,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping carving from the hit callback
+	 */
+	fwsi_test_carver_driver_reset_hits(
+	 &hits,
+	 1,
+	 0 );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          128,
+	          4,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "hits.number_of_hits",
+	 hits.number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "hits.offsets[ 0 ]",
+	 hits.offsets[ 0 ],
+	 (size_t) 100 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	fwsi_test_carver_driver_reset_hits(
+	 &hits,
+	 1,
+	 -1 );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          0,
+	          0,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	fwsi_test_carver_driver_reset_hits(
+	 &hits,
+	 8,
+	 1 );
+
+	result = libfwsi_carver_scan_data(
+	          NULL,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          0,
+	          0,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          NULL,
+	          1024,
+	          0,
+	          0,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          0,
+	          -1,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          0,
+	          LIBFWSI_CARVER_DRIVER_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &fwsi_test_carver_driver_hit_callback,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          fwsi_test_carver_driver_buffer,
+	          1024,
+	          0,
+	          0,
+	          NULL,
+	          &hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_scan_data function with a shell item list that is larger
+ * than the overlap of a chunk with the next chunk
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_scan_data_with_large_list(
+     libfwsi_carver_t *carver )
+{
+	fwsi_test_carver_driver_hits_t hits;
+
+	size_t chunk_sizes[ 3 ] = { 0, 1024, 4096 };
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	size_t list_size         = 0;
+	int chunk_size_index     = 0;
+	int item_index           = 0;
+	int number_of_items      = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 * The data contains a shell item list at offset 1000 of a root folder shell item,
+	 * "Users" file entry shell items and the terminator, which crosses multiple
+	 * chunk boundaries and is larger than LIBFWSI_CARVER_DRIVER_OVERLAP_SIZE
+	 */
+	number_of_items = (int) ( LIBFWSI_CARVER_DRIVER_OVERLAP_SIZE / 120 ) + 64;
+	list_size       = 20 + ( (size_t) number_of_items * 120 ) + 2;
+	data_size       = 1000 + list_size + 1000;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	memory_set(
+	 data,
+	 0xff,
+	 data_size );
+
+	data_offset = 1000;
+
+	memory_copy(
+	 &( data[ data_offset ] ),
+	 &( fwsi_test_carver_driver_data1[ 2 ] ),
+	 20 );
+
+	data_offset += 20;
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 &( fwsi_test_carver_driver_data1[ 47 ] ),
+		 120 );
+
+		data_offset += 120;
+	}
+	data[ data_offset++ ] = 0x00;
+	data[ data_offset++ ] = 0x00;
+
+	/* Test regular cases
+	 * The hits must not depend on the chunk size or the number of threads
+	 */
+	for( chunk_size_index = 0;
+	     chunk_size_index < 3;
+	     chunk_size_index++ )
+	{
+		for( number_of_threads = 0;
+		     number_of_threads <= 4;
+		     number_of_threads += 4 )
+		{
+			fwsi_test_carver_driver_reset_hits(
+			 &hits,
+			 8,
+			 1 );
+
+			result = libfwsi_carver_scan_data(
+			          carver,
+			          data,
+			          data_size,
+			          chunk_sizes[ chunk_size_index ],
+			          number_of_threads,
+			          &fwsi_test_carver_driver_hit_callback,
+			          &hits,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "hits.number_of_hits",
+			 hits.number_of_hits,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "hits.offsets[ 0 ]",
+			 hits.offsets[ 0 ],
+			 (size_t) 1000 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "hits.sizes[ 0 ]",
+			 hits.sizes[ 0 ],
+			 list_size );
+		}
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_carver_driver_carve_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_driver_carve_chunk(
+     libfwsi_carver_t *carver )
+{
+	libfwsi_carver_chunk_t chunk;
+	libfwsi_carver_driver_t carver_driver;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	carver_driver.carver    = carver;
+	carver_driver.data      = fwsi_test_carver_driver_buffer;
+	carver_driver.data_size = 1024;
+
+	memory_set(
+	 &chunk,
+	 0,
+	 sizeof( libfwsi_carver_chunk_t ) );
+
+	/* Test regular cases
+	 * Only the hit that starts within the chunk is kept
+	 */
+	chunk.offset = 0;
+	chunk.size   = 128;
+
+	result = libfwsi_carver_driver_carve_chunk(
+	          &carver_driver,
+	          &chunk,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "chunk.number_of_hits",
+	 chunk.number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk.hits[ 0 ].offset",
+	 chunk.hits[ 0 ].offset,
+	 (size_t) 100 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk.hits[ 0 ].size",
+	 chunk.hits[ 0 ].size,
+	 (size_t) 343 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The hit offsets are relative to the start of the data
+	 */
+	chunk.offset = 384;
+	chunk.size   = 640;
+
+	result = libfwsi_carver_driver_carve_chunk(
+	          &carver_driver,
+	          &chunk,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "chunk.number_of_hits",
+	 chunk.number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk.hits[ 0 ].offset",
+	 chunk.hits[ 0 ].offset,
+	 (size_t) 500 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk.hits[ 0 ].size",
+	 chunk.hits[ 0 ].size,
+	 (size_t) 122 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_driver_carve_chunk(
+	          NULL,
+	          &chunk,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_driver_carve_chunk(
+	          &carver_driver,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk.offset = 1024;
+	chunk.size   = 1;
+
+	result = libfwsi_carver_driver_carve_chunk(
+	          &carver_driver,
+	          &chunk,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk.offset = 1000;
+	chunk.size   = 25;
+
+	result = libfwsi_carver_driver_carve_chunk(
+	          &carver_driver,
+	          &chunk,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 chunk.hits );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk.hits != NULL )
+	{
+		memory_free(
+		 chunk.hits );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_carver_t *carver = NULL;
+	int result               = 0;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	fwsi_test_carver_driver_initialize_buffer();
+
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_carver_scan_data",
+	 fwsi_test_carver_scan_data,
+	 carver );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_carver_scan_data_with_large_list",
+	 fwsi_test_carver_scan_data_with_large_list,
+	 carver );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_carver_driver_carve_chunk",
+	 fwsi_test_carver_driver_carve_chunk,
+	 carver );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+}
@@ -0,0 +1,801 @@
+/*
+ * Library classifier functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_classifier.h"
+#include "../libfwsi/libfwsi_definitions.h"
+
+uint8_t fwsi_test_classifier_data1[ 20 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d };
+
+uint8_t fwsi_test_classifier_data2[ 18 ] = {
+	0x12, 0x00, 0x00, 0x00, 0x41, 0x75, 0x67, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00 };
+
+uint8_t fwsi_test_classifier_data3[ 92 ] = {
+	0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_classifier_signature_table
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_classifier_signature_table(
+     void )
+{
+	int number_of_signatures = 0;
+	int table_index          = 0;
+
+	for( table_index = 0;
+	     table_index < LIBFWSI_CLASSIFIER_NUMBER_OF_SIGNATURE_TABLE_ENTRIES;
+	     table_index++ )
+	{
+		if( libfwsi_classifier_signature_table[ table_index ].item_type == LIBFWSI_ITEM_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "hash",
+		 libfwsi_classifier_signature_hash( libfwsi_classifier_signature_table[ table_index ].signature ),
+		 table_index );
+
+		number_of_signatures++;
+	}
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_signatures",
+	 number_of_signatures,
+	 14 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "class_type_table[ 0x1f ]",
+	 (int) libfwsi_classifier_class_type_table[ 0x1f ],
+	 LIBFWSI_ITEM_TYPE_ROOT_FOLDER );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "class_type_table[ 0x2f ]",
+	 (int) libfwsi_classifier_class_type_table[ 0x2f ],
+	 LIBFWSI_ITEM_TYPE_VOLUME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "class_type_table[ 0xb1 ]",
+	 (int) libfwsi_classifier_class_type_table[ 0xb1 ],
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "class_type_table[ 0x60 ]",
+	 (int) libfwsi_classifier_class_type_table[ 0x60 ],
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_classifier_get_signature_item_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_classifier_get_signature_item_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t signature       = 0;
+	int item_type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_classifier_get_signature_item_type(
+	          fwsi_test_classifier_data2,
+	          8,
+	          &item_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_CDBURN );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "signature",
+	 signature,
+	 (uint32_t) 0x4d677541UL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The signature is only valid at offset 4
+	 */
+	result = libfwsi_classifier_get_signature_item_type(
+	          &( fwsi_test_classifier_data2[ 2 ] ),
+	          6,
+	          &item_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_classifier_get_signature_item_type(
+	          NULL,
+	          8,
+	          &item_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_get_signature_item_type(
+	          fwsi_test_classifier_data2,
+	          (size_t) SSIZE_MAX + 1,
+	          &item_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_get_signature_item_type(
+	          fwsi_test_classifier_data2,
+	          8,
+	          NULL,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_get_signature_item_type(
+	          fwsi_test_classifier_data2,
+	          8,
+	          &item_type,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_classifier_match_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_classifier_match_pattern(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_classifier_match_pattern(
+	          &( libfwsi_classifier_compressed_folder_patterns[ 1 ] ),
+	          fwsi_test_classifier_data3,
+	          78,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_match_pattern(
+	          &( libfwsi_classifier_compressed_folder_patterns[ 1 ] ),
+	          fwsi_test_classifier_data3,
+	          77,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_match_pattern(
+	          &( libfwsi_classifier_compressed_folder_patterns[ 2 ] ),
+	          fwsi_test_classifier_data3,
+	          78,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_classifier_match_pattern(
+	          NULL,
+	          fwsi_test_classifier_data3,
+	          78,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_match_pattern(
+	          &( libfwsi_classifier_compressed_folder_patterns[ 1 ] ),
+	          NULL,
+	          78,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_match_pattern(
+	          &( libfwsi_classifier_compressed_folder_patterns[ 1 ] ),
+	          fwsi_test_classifier_data3,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_classifier_is_supported_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_classifier_is_supported_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	          fwsi_test_classifier_data1,
+	          20,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	          fwsi_test_classifier_data1,
+	          19,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_VOLUME,
+	          fwsi_test_classifier_data1,
+	          20,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER,
+	          fwsi_test_classifier_data3,
+	          92,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER,
+	          fwsi_test_classifier_data3,
+	          78,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          fwsi_test_classifier_data1,
+	          20,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	          NULL,
+	          20,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_is_supported_data(
+	          LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	          fwsi_test_classifier_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_classifier_classify_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_classifier_classify_data(
+     void )
+{
+	libfwsi_classifier_result_t classifier_result;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data1,
+	          20,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "classifier_result.item_type",
+	 classifier_result.item_type,
+	 LIBFWSI_ITEM_TYPE_ROOT_FOLDER );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "classifier_result.class_type",
+	 classifier_result.class_type,
+	 (uint8_t) 0x1f );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "classifier_result.signature",
+	 classifier_result.signature,
+	 (uint32_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "classifier_result.values_data_size",
+	 classifier_result.values_data_size,
+	 (size_t) 20 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data2,
+	          18,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "classifier_result.item_type",
+	 classifier_result.item_type,
+	 LIBFWSI_ITEM_TYPE_CDBURN );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "classifier_result.signature",
+	 classifier_result.signature,
+	 (uint32_t) 0x4d677541UL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data3,
+	          92,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "classifier_result.item_type",
+	 classifier_result.item_type,
+	 LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Items of which the values are not supported are unknown
+	 */
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data3,
+	          78,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "classifier_result.item_type",
+	 classifier_result.item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data1,
+	          20,
+	          LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "classifier_result.item_type",
+	 classifier_result.item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "classifier_result.class_type",
+	 classifier_result.class_type,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_classifier_classify_data(
+	          NULL,
+	          20,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data1,
+	          3,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &classifier_result,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_classifier_classify_data(
+	          fwsi_test_classifier_data1,
+	          20,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_classifier_signature_table",
+	 fwsi_test_classifier_signature_table );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_classifier_get_signature_item_type",
+	 fwsi_test_classifier_get_signature_item_type );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_classifier_match_pattern",
+	 fwsi_test_classifier_match_pattern );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_classifier_is_supported_data",
+	 fwsi_test_classifier_is_supported_data );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_classifier_classify_data",
+	 fwsi_test_classifier_classify_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+}
+
@@ -520,6 +520,151 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwsi_extension_block_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_extension_block_get_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	const uint8_t *data                        = NULL;
+	size_t data_size                           = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_extension_block_initialize(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_extension_block_get_data(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an extension block without data
+	 */
+	result = libfwsi_extension_block_get_data(
+	          extension_block,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libfwsi_internal_extension_block_t *) extension_block )->data = (uint8_t *) "\x08\x00\x00\x00\x00\x00\xef\xbe";
+
+	result = libfwsi_extension_block_get_data(
+	          extension_block,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_extension_block_get_data(
+	          extension_block,
+	          &data,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_internal_extension_block_free(
+	          (libfwsi_internal_extension_block_t **) &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_internal_extension_block_free(
+		 (libfwsi_internal_extension_block_t **) &extension_block,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -561,6 +706,10 @@ int main(
 	 "libfwsi_extension_block_get_data_size",
 	 fwsi_test_extension_block_get_data_size );
 
+	FWSI_TEST_RUN(
+	 "libfwsi_extension_block_get_data",
+	 fwsi_test_extension_block_get_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
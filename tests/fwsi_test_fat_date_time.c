@@ -0,0 +1,570 @@
+/*
+ * Library FAT date time functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+/* 2010-08-12 14:31:06, 0 (not set), month 0 (invalid), 2100-02-29 (invalid),
+ * 2008-02-29, 1980-01-01 00:00:00 and 2107-12-31 23:59:58
+ */
+uint32_t fwsi_test_fat_date_time_values[ 7 ] = {
+	0x73e33d0cUL, 0x00000000UL, 0x00003c01UL, 0x0000f05dUL, 0x0000385dUL, 0x00000021UL, 0xbf7dff9fUL };
+
+int64_t fwsi_test_fat_date_time_posix_times[ 7 ] = {
+	1281623466LL, 0, 0, 0, 1204243200LL, 315532800LL, 4354819198LL };
+
+uint64_t fwsi_test_fat_date_time_filetimes[ 7 ] = {
+	0x01cb3a2aff82f100ULL, 0, 0, 0, 0x01c87a6606d60000ULL, 0x01a8e79fe1d58000ULL, 0x023868b866d29300ULL };
+
+/* Tests the libfwsi_fat_date_time_copy_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_time_copy_to_posix_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0x73e33d0cUL,
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1281623466LL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0xbf7dff9fUL,
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 4354819198LL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a FAT date time that is not set
+	 */
+	posix_time = 0;
+
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0,
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0x73e33d0cUL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an invalid month
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0x00003c01UL,
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test 2100-02-29, which does not exist
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0x0000f05dUL,
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test 24:00:00
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time(
+	          0xc0003d0cUL,
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_fat_date_time_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_time_copy_to_filetime(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          0x73e33d0cUL,
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 0x01cb3a2aff82f100ULL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a FAT date time that is not set
+	 */
+	filetime = 0;
+
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          0,
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          0x73e33d0cUL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          0x00003c01UL,
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_fat_date_times_copy_to_posix_times function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_times_copy_to_posix_times(
+     void )
+{
+	int64_t posix_times[ 7 ];
+
+	libcerror_error_t *error = NULL;
+	size_t value_index       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_times_copy_to_posix_times(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 7;
+	     value_index++ )
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT64(
+		 "posix_times[ value_index ]",
+		 posix_times[ value_index ],
+		 fwsi_test_fat_date_time_posix_times[ value_index ] );
+	}
+	result = libfwsi_fat_date_times_copy_to_posix_times(
+	          fwsi_test_fat_date_time_values,
+	          0,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_times_copy_to_posix_times(
+	          NULL,
+	          7,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_times_copy_to_posix_times(
+	          fwsi_test_fat_date_time_values,
+	          (size_t) SSIZE_MAX,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_times_copy_to_posix_times(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_fat_date_times_copy_to_filetimes function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_times_copy_to_filetimes(
+     void )
+{
+	uint64_t filetimes[ 7 ];
+
+	libcerror_error_t *error = NULL;
+	size_t value_index       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_times_copy_to_filetimes(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          filetimes,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 7;
+	     value_index++ )
+	{
+		FWSI_TEST_ASSERT_EQUAL_UINT64(
+		 "filetimes[ value_index ]",
+		 filetimes[ value_index ],
+		 fwsi_test_fat_date_time_filetimes[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_times_copy_to_filetimes(
+	          NULL,
+	          7,
+	          filetimes,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_times_copy_to_filetimes(
+	          fwsi_test_fat_date_time_values,
+	          (size_t) SSIZE_MAX,
+	          filetimes,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_times_copy_to_filetimes(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_time_copy_to_posix_time",
+	 fwsi_test_fat_date_time_copy_to_posix_time );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_time_copy_to_filetime",
+	 fwsi_test_fat_date_time_copy_to_filetime );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_times_copy_to_posix_times",
+	 fwsi_test_fat_date_times_copy_to_posix_times );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_times_copy_to_filetimes",
+	 fwsi_test_fat_date_times_copy_to_filetimes );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
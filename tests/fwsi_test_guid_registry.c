@@ -0,0 +1,930 @@
+/*
+ * Library GUID registry functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+/* My Computer: {20d04fe0-3aea-1069-a2d8-08002b30309d}
+ */
+uint8_t fwsi_test_guid_registry_my_computer[ 16 ] = {
+	0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d };
+
+/* Local Documents: {f42ee2d3-909f-4907-8871-4c22fc0bf756}
+ */
+uint8_t fwsi_test_guid_registry_local_documents[ 16 ] = {
+	0xd3, 0xe2, 0x2e, 0xf4, 0x9f, 0x90, 0x07, 0x49, 0x88, 0x71, 0x4c, 0x22, 0xfc, 0x0b, 0xf7, 0x56 };
+
+/* Network Map: {e7de9b1a-7533-4556-9484-b26fb486475e}, both a shell folder and a control panel item
+ */
+uint8_t fwsi_test_guid_registry_network_map[ 16 ] = {
+	0x1a, 0x9b, 0xde, 0xe7, 0x33, 0x75, 0x56, 0x45, 0x94, 0x84, 0xb2, 0x6f, 0xb4, 0x86, 0x47, 0x5e };
+
+uint8_t fwsi_test_guid_registry_unknown[ 16 ] = {
+	0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+
+/* Tests the libfwsi_guid_registry_get_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_guid_registry_get_identifier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int registry_identifier  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_my_computer,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "registry_identifier",
+	 registry_identifier,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_my_computer,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "registry_identifier",
+	 registry_identifier,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_unknown,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_guid_registry_get_identifier(
+	          NULL,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_my_computer,
+	          15,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_my_computer,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_guid_registry_get_identifier_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_guid_registry_get_identifier_by_name(
+     void )
+{
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int expected_identifier  = 0;
+	int registry_identifier  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_local_documents,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &expected_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_get_identifier_by_name(
+	          "Local Documents",
+	          15,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "registry_identifier",
+	 registry_identifier,
+	 expected_identifier );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_get_guid(
+	          registry_identifier,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          fwsi_test_guid_registry_local_documents,
+	          16 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a name prefix does not match
+	 */
+	result = libfwsi_guid_registry_get_identifier_by_name(
+	          "Local Document",
+	          14,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_get_identifier_by_name(
+	          "Local Documents",
+	          15,
+	          LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_guid_registry_get_identifier_by_name(
+	          NULL,
+	          5,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_identifier_by_name(
+	          "Local Documents",
+	          15,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_guid_registry_classify function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_guid_registry_classify(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	uint8_t registry_types   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_guid_registry_classify(
+	          fwsi_test_guid_registry_network_map,
+	          16,
+	          &registry_types,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "registry_types",
+	 registry_types,
+	 (uint8_t) ( LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER | LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM ) );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_classify(
+	          fwsi_test_guid_registry_local_documents,
+	          16,
+	          &registry_types,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "registry_types",
+	 registry_types,
+	 (uint8_t) LIBFWSI_GUID_REGISTRY_TYPE_KNOWN_FOLDER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_classify(
+	          fwsi_test_guid_registry_unknown,
+	          16,
+	          &registry_types,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "registry_types",
+	 registry_types,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_guid_registry_classify(
+	          NULL,
+	          16,
+	          &registry_types,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_classify(
+	          fwsi_test_guid_registry_network_map,
+	          16,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_guid_registry_classify_guids function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_guid_registry_classify_guids(
+     void )
+{
+	uint8_t guids_data[ 64 ];
+	int registry_identifiers[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	int registry_identifier  = 0;
+	int result               = 0;
+
+	memory_copy(
+	 &( guids_data[ 0 ] ),
+	 fwsi_test_guid_registry_my_computer,
+	 16 );
+
+	memory_copy(
+	 &( guids_data[ 16 ] ),
+	 fwsi_test_guid_registry_unknown,
+	 16 );
+
+	memory_copy(
+	 &( guids_data[ 32 ] ),
+	 fwsi_test_guid_registry_local_documents,
+	 16 );
+
+	memory_copy(
+	 &( guids_data[ 48 ] ),
+	 fwsi_test_guid_registry_network_map,
+	 16 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_guid_registry_classify_guids(
+	          guids_data,
+	          64,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          registry_identifiers,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "registry_identifiers[ 1 ]",
+	 registry_identifiers[ 1 ],
+	 0 );
+
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_my_computer,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "registry_identifiers[ 0 ]",
+	 registry_identifiers[ 0 ],
+	 registry_identifier );
+
+	result = libfwsi_guid_registry_classify_guids(
+	          guids_data,
+	          64,
+	          LIBFWSI_GUID_REGISTRY_TYPE_CONTROL_PANEL_ITEM,
+	          registry_identifiers,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "registry_identifiers[ 3 ]",
+	 registry_identifiers[ 3 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_guid_registry_classify_guids(
+	          NULL,
+	          64,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          registry_identifiers,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_classify_guids(
+	          guids_data,
+	          63,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          registry_identifiers,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_classify_guids(
+	          guids_data,
+	          64,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          NULL,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_classify_guids(
+	          guids_data,
+	          64,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          registry_identifiers,
+	          3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_guid_registry_get_type, libfwsi_guid_registry_get_guid
+ * and libfwsi_guid_registry_get_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_guid_registry_get_definition_values(
+     void )
+{
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	const char *name         = NULL;
+	int registry_identifier  = 0;
+	int result               = 0;
+	uint8_t registry_type    = 0;
+
+	result = libfwsi_guid_registry_get_identifier(
+	          fwsi_test_guid_registry_network_map,
+	          16,
+	          LIBFWSI_GUID_REGISTRY_TYPE_ALL,
+	          &registry_identifier,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_guid_registry_get_type(
+	          registry_identifier,
+	          &registry_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "registry_type",
+	 registry_type,
+	 (uint8_t) LIBFWSI_GUID_REGISTRY_TYPE_SHELL_FOLDER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_guid_registry_get_guid(
+	          registry_identifier,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          fwsi_test_guid_registry_network_map,
+	          16 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwsi_guid_registry_get_name(
+	          registry_identifier,
+	          &name,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          name,
+	          "Network Map",
+	          12 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_guid_registry_get_type(
+	          0,
+	          &registry_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_type(
+	          registry_identifier,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_guid(
+	          registry_identifier | 0xffff,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_guid(
+	          registry_identifier,
+	          NULL,
+	          16,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_name(
+	          0x00ff0001,
+	          &name,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_guid_registry_get_name(
+	          registry_identifier,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_guid_registry_get_identifier",
+	 fwsi_test_guid_registry_get_identifier );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_guid_registry_get_identifier_by_name",
+	 fwsi_test_guid_registry_get_identifier_by_name );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_guid_registry_classify",
+	 fwsi_test_guid_registry_classify );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_guid_registry_classify_guids",
+	 fwsi_test_guid_registry_classify_guids );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_guid_registry_get_definition_values",
+	 fwsi_test_guid_registry_get_definition_values );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
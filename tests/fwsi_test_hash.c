@@ -0,0 +1,347 @@
+/*
+ * Library hash functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_hash.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_hash_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_hash_calculate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_hash_calculate(
+	          (uint8_t *) "",
+	          0,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xef46db3751d8e999ULL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_hash_calculate(
+	          (uint8_t *) "a",
+	          1,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xd24ec4f1a98c6e5bULL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_hash_calculate(
+	          (uint8_t *) "abc",
+	          3,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x44bc2cf5ad770999ULL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_hash_calculate(
+	          NULL,
+	          3,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_hash_calculate(
+	          (uint8_t *) "abc",
+	          3,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_hash_context_update function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_hash_context_update(
+     void )
+{
+	uint8_t data[ 100 ];
+
+	libfwsi_hash_context_t hash_context;
+
+	libcerror_error_t *error = NULL;
+	uint64_t expected_hash   = 0;
+	uint64_t hash            = 0;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	for( data_offset = 0;
+	     data_offset < 100;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset * 7 );
+	}
+	result = libfwsi_hash_calculate(
+	          data,
+	          100,
+	          &expected_hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The data is hashed in chunks that do not align with the 32-byte stripes
+	 */
+	result = libfwsi_hash_context_clear(
+	          &hash_context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+	data_size   = 1;
+
+	while( data_offset < 100 )
+	{
+		if( data_size > ( 100 - data_offset ) )
+		{
+			data_size = 100 - data_offset;
+		}
+		result = libfwsi_hash_context_update(
+		          &hash_context,
+		          &( data[ data_offset ] ),
+		          data_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset += data_size;
+		data_size   += 6;
+	}
+	result = libfwsi_hash_context_finalize(
+	          &hash_context,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_hash_context_update(
+	          NULL,
+	          data,
+	          100,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_hash_context_update(
+	          &hash_context,
+	          NULL,
+	          100,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_hash_calculate",
+	 fwsi_test_hash_calculate );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_hash_context_update",
+	 fwsi_test_hash_context_update );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+}
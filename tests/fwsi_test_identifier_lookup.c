@@ -0,0 +1,636 @@
+/*
+ * Library identifier lookup functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_control_panel_item_identifier.h"
+#include "../libfwsi/libfwsi_known_folder_identifier.h"
+#include "../libfwsi/libfwsi_shell_folder_identifier.h"
+
+#define FWSI_TEST_IDENTIFIER_LOOKUP_NUMBER_OF_ROUNDS	256
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+typedef struct fwsi_test_identifier_lookup_table fwsi_test_identifier_lookup_table_t;
+
+struct fwsi_test_identifier_lookup_table
+{
+	/* The description
+	 */
+	const char *description;
+
+	/* The identifiers
+	 */
+	uint8_t **identifiers;
+
+	/* The names
+	 */
+	const char **names;
+
+	/* The number of definitions, excluding the unknown terminator
+	 */
+	int number_of_definitions;
+
+	/* The name of the unknown terminator
+	 */
+	const char *unknown_name;
+
+	/* The get name function
+	 */
+	const char *(*get_name)(
+	               const uint8_t *identifier );
+};
+
+/* Retrieves a name using a linear scan of the table, as reference
+ * Returns the name
+ */
+const char *fwsi_test_identifier_lookup_linear(
+             fwsi_test_identifier_lookup_table_t *table,
+             const uint8_t *identifier )
+{
+	int definition_index = 0;
+
+	for( definition_index = 0;
+	     definition_index < table->number_of_definitions;
+	     definition_index++ )
+	{
+		if( memory_compare(
+		     table->identifiers[ definition_index ],
+		     identifier,
+		     16 ) == 0 )
+		{
+			return( table->names[ definition_index ] );
+		}
+	}
+	return( table->unknown_name );
+}
+
+/* Tests a lookup table
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_identifier_lookup_table(
+     fwsi_test_identifier_lookup_table_t *table )
+{
+	uint8_t identifier[ 16 ];
+
+	const char *expected_name = NULL;
+	const char *name          = NULL;
+	int definition_index      = 0;
+	int result                = 0;
+
+	FWSI_TEST_ASSERT_GREATER_THAN_INT(
+	 "table->number_of_definitions",
+	 table->number_of_definitions,
+	 0 );
+
+	for( definition_index = 0;
+	     definition_index < table->number_of_definitions;
+	     definition_index++ )
+	{
+		/* Test if the definitions are sorted
+		 */
+		if( definition_index > 0 )
+		{
+			result = memory_compare(
+			          table->identifiers[ definition_index - 1 ],
+			          table->identifiers[ definition_index ],
+			          16 );
+
+			FWSI_TEST_ASSERT_LESS_THAN_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* Test lookup that hits
+		 */
+		name = table->get_name(
+		        table->identifiers[ definition_index ] );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "name",
+		 name );
+
+		result = narrow_string_compare(
+		          name,
+		          table->names[ definition_index ],
+		          narrow_string_length( table->names[ definition_index ] ) + 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test lookup that misses with an identifier that differs in a single byte
+		 */
+		memory_copy(
+		 identifier,
+		 table->identifiers[ definition_index ],
+		 16 );
+
+		identifier[ definition_index % 16 ] ^= 0x5a;
+
+		expected_name = fwsi_test_identifier_lookup_linear(
+		                 table,
+		                 identifier );
+
+		name = table->get_name(
+		        identifier );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "name",
+		 name );
+
+		result = narrow_string_compare(
+		          name,
+		          expected_name,
+		          narrow_string_length( expected_name ) + 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test lookup of the lowest and highest identifier values
+	 */
+	memory_set(
+	 identifier,
+	 0x00,
+	 16 );
+
+	name = table->get_name(
+	        identifier );
+
+	expected_name = fwsi_test_identifier_lookup_linear(
+	                 table,
+	                 identifier );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = narrow_string_compare(
+	          name,
+	          expected_name,
+	          narrow_string_length( expected_name ) + 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_set(
+	 identifier,
+	 0xff,
+	 16 );
+
+	name = table->get_name(
+	        identifier );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = narrow_string_compare(
+	          name,
+	          table->unknown_name,
+	          narrow_string_length( table->unknown_name ) + 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	name = table->get_name(
+	        NULL );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Benchmarks a lookup table against a linear scan
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_identifier_lookup_benchmark_table(
+     fwsi_test_identifier_lookup_table_t *table )
+{
+	clock_t binary_search_hit_clocks  = 0;
+	clock_t binary_search_miss_clocks = 0;
+	clock_t linear_scan_hit_clocks    = 0;
+	clock_t linear_scan_miss_clocks   = 0;
+	clock_t start_clock               = 0;
+	uint8_t *miss_identifiers         = NULL;
+	size_t checksum                   = 0;
+	size_t reference_checksum         = 0;
+	int definition_index              = 0;
+	int round_index                   = 0;
+
+	miss_identifiers = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * 16 * table->number_of_definitions );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "miss_identifiers",
+	 miss_identifiers );
+
+	for( definition_index = 0;
+	     definition_index < table->number_of_definitions;
+	     definition_index++ )
+	{
+		memory_copy(
+		 &( miss_identifiers[ definition_index * 16 ] ),
+		 table->identifiers[ definition_index ],
+		 16 );
+
+		miss_identifiers[ ( definition_index * 16 ) + 15 ] ^= 0xa5;
+	}
+	start_clock = clock();
+
+	for( round_index = 0;
+	     round_index < FWSI_TEST_IDENTIFIER_LOOKUP_NUMBER_OF_ROUNDS;
+	     round_index++ )
+	{
+		for( definition_index = 0;
+		     definition_index < table->number_of_definitions;
+		     definition_index++ )
+		{
+			reference_checksum += (size_t) fwsi_test_identifier_lookup_linear(
+			                                table,
+			                                table->identifiers[ definition_index ] );
+		}
+	}
+	linear_scan_hit_clocks = clock() - start_clock;
+	start_clock            = clock();
+
+	for( round_index = 0;
+	     round_index < FWSI_TEST_IDENTIFIER_LOOKUP_NUMBER_OF_ROUNDS;
+	     round_index++ )
+	{
+		for( definition_index = 0;
+		     definition_index < table->number_of_definitions;
+		     definition_index++ )
+		{
+			checksum += (size_t) table->get_name(
+			                      table->identifiers[ definition_index ] );
+		}
+	}
+	binary_search_hit_clocks = clock() - start_clock;
+	start_clock              = clock();
+
+	for( round_index = 0;
+	     round_index < FWSI_TEST_IDENTIFIER_LOOKUP_NUMBER_OF_ROUNDS;
+	     round_index++ )
+	{
+		for( definition_index = 0;
+		     definition_index < table->number_of_definitions;
+		     definition_index++ )
+		{
+			reference_checksum += (size_t) fwsi_test_identifier_lookup_linear(
+			                                table,
+			                                &( miss_identifiers[ definition_index * 16 ] ) );
+		}
+	}
+	linear_scan_miss_clocks = clock() - start_clock;
+	start_clock             = clock();
+
+	for( round_index = 0;
+	     round_index < FWSI_TEST_IDENTIFIER_LOOKUP_NUMBER_OF_ROUNDS;
+	     round_index++ )
+	{
+		for( definition_index = 0;
+		     definition_index < table->number_of_definitions;
+		     definition_index++ )
+		{
+			checksum += (size_t) table->get_name(
+			                      &( miss_identifiers[ definition_index * 16 ] ) );
+		}
+	}
+	binary_search_miss_clocks = clock() - start_clock;
+
+	memory_free(
+	 miss_identifiers );
+
+	miss_identifiers = NULL;
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "checksum",
+	 checksum,
+	 reference_checksum );
+
+	fprintf(
+	 stdout,
+	 "%s: %d definitions, %d rounds\n",
+	 table->description,
+	 table->number_of_definitions,
+	 FWSI_TEST_IDENTIFIER_LOOKUP_NUMBER_OF_ROUNDS );
+
+	fprintf(
+	 stdout,
+	 "\thits\t: linear scan %.3f ms, binary search %.3f ms\n",
+	 (double) linear_scan_hit_clocks * 1000.0 / CLOCKS_PER_SEC,
+	 (double) binary_search_hit_clocks * 1000.0 / CLOCKS_PER_SEC );
+
+	fprintf(
+	 stdout,
+	 "\tmisses\t: linear scan %.3f ms, binary search %.3f ms\n",
+	 (double) linear_scan_miss_clocks * 1000.0 / CLOCKS_PER_SEC,
+	 (double) binary_search_miss_clocks * 1000.0 / CLOCKS_PER_SEC );
+
+	return( 1 );
+
+on_error:
+	if( miss_identifiers != NULL )
+	{
+		memory_free(
+		 miss_identifiers );
+	}
+	return( 0 );
+}
+
+/* Frees a lookup table
+ */
+void fwsi_test_identifier_lookup_table_free(
+      fwsi_test_identifier_lookup_table_t *table )
+{
+	if( table->identifiers != NULL )
+	{
+		memory_free(
+		 table->identifiers );
+
+		table->identifiers = NULL;
+	}
+	if( table->names != NULL )
+	{
+		memory_free(
+		 table->names );
+
+		table->names = NULL;
+	}
+}
+
+/* Allocates the identifiers and names of a lookup table
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_identifier_lookup_table_allocate(
+     fwsi_test_identifier_lookup_table_t *table,
+     int number_of_definitions )
+{
+	table->identifiers = (uint8_t **) memory_allocate(
+	                                   sizeof( uint8_t * ) * number_of_definitions );
+
+	if( table->identifiers == NULL )
+	{
+		return( 0 );
+	}
+	table->names = (const char **) memory_allocate(
+	                                sizeof( const char * ) * number_of_definitions );
+
+	if( table->names == NULL )
+	{
+		return( 0 );
+	}
+	table->number_of_definitions = number_of_definitions;
+
+	return( 1 );
+}
+
+/* Tests the libfwsi_shell_folder_identifier_get_name, libfwsi_known_folder_identifier_get_name
+ * and libfwsi_control_panel_item_identifier_get_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_identifier_lookup_get_name(
+     void )
+{
+	fwsi_test_identifier_lookup_table_t table;
+
+	int definition_index      = 0;
+	int number_of_definitions = 0;
+	int result                = 0;
+
+	/* Test shell folder identifiers
+	 */
+	memory_set(
+	 &table,
+	 0,
+	 sizeof( fwsi_test_identifier_lookup_table_t ) );
+
+	for( number_of_definitions = 0;
+	     libfwsi_shell_folder_identifier_definitions[ number_of_definitions ].identifier != libfwsi_shell_folder_identifier_unknown;
+	     number_of_definitions++ )
+	{
+	}
+	result = fwsi_test_identifier_lookup_table_allocate(
+	          &table,
+	          number_of_definitions );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		table.identifiers[ definition_index ] = libfwsi_shell_folder_identifier_definitions[ definition_index ].identifier;
+		table.names[ definition_index ]       = libfwsi_shell_folder_identifier_definitions[ definition_index ].name;
+	}
+	table.description  = "shell folder identifiers";
+	table.unknown_name = libfwsi_shell_folder_identifier_definitions[ number_of_definitions ].name;
+	table.get_name     = &libfwsi_shell_folder_identifier_get_name;
+
+	result = fwsi_test_identifier_lookup_table(
+	          &table );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fwsi_test_identifier_lookup_benchmark_table(
+	          &table );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fwsi_test_identifier_lookup_table_free(
+	 &table );
+
+	/* Test known folder identifiers
+	 */
+	for( number_of_definitions = 0;
+	     libfwsi_known_folder_identifier_definitions[ number_of_definitions ].identifier != libfwsi_known_folder_identifier_unknown;
+	     number_of_definitions++ )
+	{
+	}
+	result = fwsi_test_identifier_lookup_table_allocate(
+	          &table,
+	          number_of_definitions );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		table.identifiers[ definition_index ] = libfwsi_known_folder_identifier_definitions[ definition_index ].identifier;
+		table.names[ definition_index ]       = libfwsi_known_folder_identifier_definitions[ definition_index ].name;
+	}
+	table.description  = "known folder identifiers";
+	table.unknown_name = libfwsi_known_folder_identifier_definitions[ number_of_definitions ].name;
+	table.get_name     = &libfwsi_known_folder_identifier_get_name;
+
+	result = fwsi_test_identifier_lookup_table(
+	          &table );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fwsi_test_identifier_lookup_benchmark_table(
+	          &table );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fwsi_test_identifier_lookup_table_free(
+	 &table );
+
+	/* Test control panel item identifiers
+	 */
+	for( number_of_definitions = 0;
+	     libfwsi_control_panel_item_identifier_definitions[ number_of_definitions ].identifier != libfwsi_control_panel_item_identifier_unknown;
+	     number_of_definitions++ )
+	{
+	}
+	result = fwsi_test_identifier_lookup_table_allocate(
+	          &table,
+	          number_of_definitions );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		table.identifiers[ definition_index ] = libfwsi_control_panel_item_identifier_definitions[ definition_index ].identifier;
+		table.names[ definition_index ]       = libfwsi_control_panel_item_identifier_definitions[ definition_index ].name;
+	}
+	table.description  = "control panel item identifiers";
+	table.unknown_name = libfwsi_control_panel_item_identifier_definitions[ number_of_definitions ].name;
+	table.get_name     = &libfwsi_control_panel_item_identifier_get_name;
+
+	result = fwsi_test_identifier_lookup_table(
+	          &table );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fwsi_test_identifier_lookup_benchmark_table(
+	          &table );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fwsi_test_identifier_lookup_table_free(
+	 &table );
+
+	return( 1 );
+
+on_error:
+	fwsi_test_identifier_lookup_table_free(
+	 &table );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_identifier_get_name",
+	 fwsi_test_identifier_lookup_get_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+}
+
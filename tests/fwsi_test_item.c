@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -469,110 +470,1106 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwsi_item_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_reset(
+     void )
+{
+	uint8_t byte_stream[ 122 ];
+
+	libcerror_error_t *error         = NULL;
+	libfwsi_item_cache_t *item_cache = NULL;
+	libfwsi_item_list_t *item_list   = NULL;
+	libfwsi_item_t *item             = NULL;
+	libfwsi_item_t *list_item        = NULL;
+	int item_type                    = 0;
+	int iterator                     = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 3;
+	     iterator++ )
+	{
+		result = libfwsi_item_copy_from_byte_stream(
+		          item,
+		          fwsi_test_item_data1,
+		          120,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_type(
+		          item,
+		          &item_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "item_type",
+		 item_type,
+		 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_reset(
+		          item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_type(
+		          item,
+		          &item_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "item_type",
+		 item_type,
+		 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_item_reset(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test resetting an item that is managed by an item list
+	 * with and without an item cache
+	 */
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 byte_stream,
+	 fwsi_test_item_data1,
+	 120 );
+
+	byte_stream[ 120 ] = 0;
+	byte_stream[ 121 ] = 0;
+
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( iterator == 1 )
+		{
+			result = libfwsi_item_list_set_item_cache(
+			          item_list,
+			          item_cache,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          byte_stream,
+		          122,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_item(
+		          item_list,
+		          0,
+		          &list_item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "list_item",
+		 list_item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_reset(
+		          list_item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* The item must not have been modified by the reset
+		 */
+		result = libfwsi_item_get_type(
+		          list_item,
+		          &item_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "item_type",
+		 item_type,
+		 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_free(
+		          &list_item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The item cache can only be freed if the items are released by the item list
+	 */
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_cache",
+	 item_cache );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	if( item_cache != NULL )
+	{
+		libfwsi_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_classify_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_classify_byte_stream(
+     void )
+{
+	uint8_t empty_data[ 2 ]  = { 0x00, 0x00 };
+	libcerror_error_t *error = NULL;
+	int item_type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_classify_byte_stream(
+	          fwsi_test_item_data1,
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_classify_byte_stream(
+	          fwsi_test_item_data1,
+	          120,
+	          LIBFWSI_ITEM_TYPE_URI,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_URI_SUB_VALUES );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_classify_byte_stream(
+	          empty_data,
+	          2,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_classify_byte_stream(
+	          NULL,
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_classify_byte_stream(
+	          fwsi_test_item_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_classify_byte_stream(
+	          fwsi_test_item_data1,
+	          64,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_classify_byte_stream(
+	          fwsi_test_item_data1,
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwsi_item_get_type function
  * Returns 1 if successful or 0 if not
  */
-int fwsi_test_item_get_type(
+int fwsi_test_item_get_type(
+     libfwsi_item_t *item )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int type                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_get_type(
+	          item,
+	          &type,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_get_class_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_get_class_type(
+     libfwsi_item_t *item )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t class_type       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_get_class_type(
+	          item,
+	          &class_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_class_type(
+	          NULL,
+	          &class_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_class_type(
+	          item,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_get_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_get_signature(
+     libfwsi_item_t *item )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t signature       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_get_signature(
+	          item,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_signature(
+	          NULL,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_signature(
+	          item,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_get_data_size(
      libfwsi_item_t *item )
 {
 	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
 	int result               = 0;
-	int type                 = 0;
 
-	/* Test regular cases
+	/* Test regular cases
+	 */
+	result = libfwsi_item_get_data_size(
+	          item,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_data_size(
+	          item,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_get_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_get_hash(
+     libfwsi_item_t *item )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	uint64_t semantic_hash   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_get_hash(
+	          item,
+	          0,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_hash(
+	          item,
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &semantic_hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The test data contains a file entry extension block with an access time
+	 */
+	result = ( hash != semantic_hash );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_hash(
+	          NULL,
+	          0,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_hash(
+	          item,
+	          0xff,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_hash(
+	          item,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_compare(
+     libfwsi_item_t *item )
+{
+	uint8_t item_data[ 120 ];
+
+	libcerror_error_t *error    = NULL;
+	libfwsi_item_t *second_item = NULL;
+	uint64_t hash               = 0;
+	uint64_t second_hash        = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &second_item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "second_item",
+	 second_item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Modify the access time of the file entry extension block
 	 */
-	result = libfwsi_item_get_type(
-	          item,
-	          &type,
+	memory_copy(
+	 item_data,
+	 fwsi_test_item_data1,
+	 120 );
+
+	item_data[ 32 ] = 0x00;
+	item_data[ 33 ] = 0x00;
+	item_data[ 34 ] = 0x00;
+	item_data[ 35 ] = 0x00;
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          second_item,
+	          item_data,
+	          120,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libfwsi_item_get_type(
-	          NULL,
-	          &type,
+	result = libfwsi_item_compare(
+	          item,
+	          item,
+	          0,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 LIBFWSI_COMPARE_EQUAL );
 
-	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwsi_item_get_type(
+	result = libfwsi_item_compare(
 	          item,
-	          NULL,
+	          second_item,
+	          0,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 LIBFWSI_COMPARE_GREATER );
 
-	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfwsi_item_compare(
+	          second_item,
+	          item,
+	          0,
+	          &error );
 
-	return( 1 );
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_LESS );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libfwsi_item_get_class_type function
- * Returns 1 if successful or 0 if not
- */
-int fwsi_test_item_get_class_type(
-     libfwsi_item_t *item )
-{
-	libcerror_error_t *error = NULL;
-	uint8_t class_type       = 0;
-	int result               = 0;
+	result = libfwsi_item_compare(
+	          item,
+	          second_item,
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &error );
 
-	/* Test regular cases
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_EQUAL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The semantic hashes must match when the items compare equal
 	 */
-	result = libfwsi_item_get_class_type(
+	result = libfwsi_item_get_hash(
 	          item,
-	          &class_type,
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &hash,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_hash(
+	          second_item,
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &second_hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "second_hash",
+	 second_hash,
+	 hash );
+
 	/* Test error cases
 	 */
-	result = libfwsi_item_get_class_type(
+	result = libfwsi_item_compare(
 	          NULL,
-	          &class_type,
+	          second_item,
+	          0,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -587,9 +1584,28 @@ int fwsi_test_item_get_class_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwsi_item_get_class_type(
+	result = libfwsi_item_compare(
 	          item,
 	          NULL,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_compare(
+	          item,
+	          second_item,
+	          0xff,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -604,6 +1620,25 @@ int fwsi_test_item_get_class_type(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfwsi_item_free(
+	          &second_item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "second_item",
+	 second_item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -612,30 +1647,36 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( second_item != NULL )
+	{
+		libfwsi_item_free(
+		 &second_item,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfwsi_item_get_signature function
+/* Tests the libfwsi_item_get_number_of_extension_blocks function
  * Returns 1 if successful or 0 if not
  */
-int fwsi_test_item_get_signature(
+int fwsi_test_item_get_number_of_extension_blocks(
      libfwsi_item_t *item )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t signature       = 0;
-	int result               = 0;
+	libcerror_error_t *error       = NULL;
+	int number_of_extension_blocks = 0;
+	int result                     = 0;
 
 	/* Test regular cases
 	 */
-	result = libfwsi_item_get_signature(
+	result = libfwsi_item_get_number_of_extension_blocks(
 	          item,
-	          &signature,
+	          &number_of_extension_blocks,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -643,9 +1684,9 @@ int fwsi_test_item_get_signature(
 
 	/* Test error cases
 	 */
-	result = libfwsi_item_get_signature(
+	result = libfwsi_item_get_number_of_extension_blocks(
 	          NULL,
-	          &signature,
+	          &number_of_extension_blocks,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -660,7 +1701,7 @@ int fwsi_test_item_get_signature(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwsi_item_get_signature(
+	result = libfwsi_item_get_number_of_extension_blocks(
 	          item,
 	          NULL,
 	          &error );
@@ -688,100 +1729,132 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwsi_item_get_data_size function
+/* Tests the libfwsi_item_get_extension_block_by_signature function
  * Returns 1 if successful or 0 if not
  */
-int fwsi_test_item_get_data_size(
+int fwsi_test_item_get_extension_block_by_signature(
      libfwsi_item_t *item )
 {
-	libcerror_error_t *error = NULL;
-	size_t data_size         = 0;
-	int result               = 0;
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	const uint8_t *data                        = NULL;
+	size_t data_size                           = 0;
+	uint32_t signature                         = 0;
+	int result                                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libfwsi_item_get_data_size(
+	result = libfwsi_item_get_extension_block_by_signature(
 	          item,
-	          &data_size,
+	          0xbeef0004UL,
+	          &extension_block,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfwsi_item_get_data_size(
-	          NULL,
-	          &data_size,
+	result = libfwsi_extension_block_get_signature(
+	          extension_block,
+	          &signature,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "signature",
+	 signature,
+	 (uint32_t) 0xbeef0004UL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwsi_item_get_data_size(
-	          item,
-	          NULL,
+	/* The data references the item data and includes the extension block header
+	 */
+	result = libfwsi_extension_block_get_data(
+	          extension_block,
+	          &data,
+	          &data_size,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 100 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          data,
+	          &( fwsi_test_item_data1[ 20 ] ),
+	          100 );
 
-	return( 1 );
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	/* Test a signature that is not present
+	 */
+	extension_block = NULL;
 
-/* Tests the libfwsi_item_get_number_of_extension_blocks function
- * Returns 1 if successful or 0 if not
- */
-int fwsi_test_item_get_number_of_extension_blocks(
-     libfwsi_item_t *item )
-{
-	libcerror_error_t *error       = NULL;
-	int number_of_extension_blocks = 0;
-	int result                     = 0;
+	result = libfwsi_item_get_extension_block_by_signature(
+	          item,
+	          0xbeef0026UL,
+	          &extension_block,
+	          &error );
 
-	/* Test regular cases
-	 */
-	result = libfwsi_item_get_number_of_extension_blocks(
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block_by_signature(
 	          item,
-	          &number_of_extension_blocks,
+	          0x12345678UL,
+	          &extension_block,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -789,9 +1862,10 @@ int fwsi_test_item_get_number_of_extension_blocks(
 
 	/* Test error cases
 	 */
-	result = libfwsi_item_get_number_of_extension_blocks(
+	result = libfwsi_item_get_extension_block_by_signature(
 	          NULL,
-	          &number_of_extension_blocks,
+	          0xbeef0004UL,
+	          &extension_block,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -806,8 +1880,9 @@ int fwsi_test_item_get_number_of_extension_blocks(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwsi_item_get_number_of_extension_blocks(
+	result = libfwsi_item_get_extension_block_by_signature(
 	          item,
+	          0xbeef0004UL,
 	          NULL,
 	          &error );
 
@@ -867,6 +1942,14 @@ int main(
 	 "libfwsi_item_copy_from_byte_stream",
 	 fwsi_test_item_copy_from_byte_stream );
 
+	FWSI_TEST_RUN(
+	 "libfwsi_item_reset",
+	 fwsi_test_item_reset );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_classify_byte_stream",
+	 fwsi_test_item_classify_byte_stream );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize item for tests
@@ -924,6 +2007,16 @@ int main(
 	 fwsi_test_item_get_data_size,
 	 item );
 
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_get_hash",
+	 fwsi_test_item_get_hash,
+	 item );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_compare",
+	 fwsi_test_item_compare,
+	 item );
+
 	FWSI_TEST_RUN_WITH_ARGS(
 	 "libfwsi_item_get_number_of_extension_blocks",
 	 fwsi_test_item_get_number_of_extension_blocks,
@@ -931,6 +2024,11 @@ int main(
 
 	/* TODO: add tests for libfwsi_item_get_extension_block */
 
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_get_extension_block_by_signature",
+	 fwsi_test_item_get_extension_block_by_signature,
+	 item );
+
 	/* Clean up
 	 */
 	result = libfwsi_item_free(
@@ -0,0 +1,1317 @@
+/*
+ * Library item_cache type test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_item.h"
+#include "../libfwsi/libfwsi_item_cache.h"
+
+unsigned char fwsi_test_item_cache_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_item_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_cache_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfwsi_item_cache_t *item_cache = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 2;
+	int number_of_memset_fail_tests  = 2;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_cache",
+	 item_cache );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_cache_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_cache = (libfwsi_item_cache_t *) 0x12345678UL;
+
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          0,
+	          &error );
+
+	item_cache = NULL;
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          -1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_item_cache_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_item_cache_initialize(
+		          &item_cache,
+		          0,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( item_cache != NULL )
+			{
+				libfwsi_item_cache_free(
+				 &item_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "item_cache",
+			 item_cache );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_item_cache_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_item_cache_initialize(
+		          &item_cache,
+		          0,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( item_cache != NULL )
+			{
+				libfwsi_item_cache_free(
+				 &item_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "item_cache",
+			 item_cache );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_cache != NULL )
+	{
+		libfwsi_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_cache_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_cache_get_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_cache_get_number_of_items(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfwsi_item_cache_t *item_cache = NULL;
+	int number_of_items              = 0;
+	int result                       = 0;
+
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_cache_get_number_of_items(
+	          item_cache,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_cache_get_number_of_items(
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_cache_get_number_of_items(
+	          item_cache,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_cache != NULL )
+	{
+		libfwsi_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests sharing items between item lists
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_cache_shared_items(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfwsi_item_cache_t *item_cache    = NULL;
+	libfwsi_item_list_t *item_list1     = NULL;
+	libfwsi_item_list_t *item_list2     = NULL;
+	libfwsi_item_t *item1               = NULL;
+	libfwsi_item_t *item2               = NULL;
+	const uint8_t *utf8_path1           = NULL;
+	const uint8_t *utf8_path2           = NULL;
+	size_t utf8_path_length1            = 0;
+	size_t utf8_path_length2            = 0;
+	int item_index                      = 0;
+	int number_of_items                 = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &item_list1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_set_item_cache(
+	          item_list1,
+	          item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &item_list2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_set_item_cache(
+	          item_list2,
+	          item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_parse(
+	          item_list1,
+	          &( fwsi_test_item_cache_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_parse(
+	          item_list2,
+	          &( fwsi_test_item_cache_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_cache_get_number_of_items(
+	          item_cache,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < 5;
+	     item_index++ )
+	{
+		result = libfwsi_item_list_get_item(
+		          item_list1,
+		          item_index,
+		          &item1,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_item(
+		          item_list2,
+		          item_index,
+		          &item2,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = ( item1 == item2 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libfwsi_item_list_get_cached_utf8_path(
+	          item_list1,
+	          &utf8_path1,
+	          &utf8_path_length1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_cached_utf8_path(
+	          item_list2,
+	          &utf8_path2,
+	          &utf8_path_length2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_length2",
+	 utf8_path_length2,
+	 utf8_path_length1 );
+
+	result = memory_compare(
+	          utf8_path1,
+	          utf8_path2,
+	          utf8_path_length1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_set_item_cache(
+	          NULL,
+	          item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The item cache cannot be freed while its items are referenced
+	 */
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_reset(
+	          item_list1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list2 != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list2,
+		 NULL );
+	}
+	if( item_list1 != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list1,
+		 NULL );
+	}
+	if( item_cache != NULL )
+	{
+		libfwsi_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests an item cache with a maximum number of items
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_cache_maximum_number_of_items(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfwsi_item_cache_t *item_cache = NULL;
+	libfwsi_item_list_t *item_list   = NULL;
+	int number_of_items              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_set_item_cache(
+	          item_list,
+	          item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          &( fwsi_test_item_cache_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_cache_get_number_of_items(
+	          item_cache,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	if( item_cache != NULL )
+	{
+		libfwsi_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_internal_item_cache_get_item function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_internal_item_cache_get_item(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfwsi_internal_item_t *internal_item1 = NULL;
+	libfwsi_internal_item_t *internal_item2 = NULL;
+	libfwsi_internal_item_t *internal_item3 = NULL;
+	libfwsi_item_cache_t *item_cache        = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_cache_initialize(
+	          &item_cache,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_internal_item_cache_get_item(
+	          (libfwsi_internal_item_cache_t *) item_cache,
+	          &( fwsi_test_item_cache_data1[ 47 ] ),
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &internal_item1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_item1",
+	 internal_item1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "internal_item1->type",
+	 internal_item1->type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	/* A parent item type that does not change how the shell item is read
+	 * returns the same item
+	 */
+	result = libfwsi_internal_item_cache_get_item(
+	          (libfwsi_internal_item_cache_t *) item_cache,
+	          &( fwsi_test_item_cache_data1[ 47 ] ),
+	          120,
+	          LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &internal_item2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_item2",
+	 internal_item2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( internal_item2 == internal_item1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The child of a compressed folder is read differently
+	 * hence returns a different item
+	 */
+	result = libfwsi_internal_item_cache_get_item(
+	          (libfwsi_internal_item_cache_t *) item_cache,
+	          &( fwsi_test_item_cache_data1[ 47 ] ),
+	          120,
+	          LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &internal_item3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_item3",
+	 internal_item3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( internal_item3 != internal_item1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The file entry data is not supported as compressed folder values
+	 */
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "internal_item3->type",
+	 internal_item3->type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	result = libfwsi_internal_item_release(
+	          &internal_item1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_internal_item_release(
+	          &internal_item2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_internal_item_release(
+	          &internal_item3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_internal_item_cache_get_item(
+	          NULL,
+	          &( fwsi_test_item_cache_data1[ 47 ] ),
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &internal_item1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_internal_item_cache_get_item(
+	          (libfwsi_internal_item_cache_t *) item_cache,
+	          NULL,
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &internal_item1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_internal_item_cache_get_item(
+	          (libfwsi_internal_item_cache_t *) item_cache,
+	          &( fwsi_test_item_cache_data1[ 47 ] ),
+	          120,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a shell item that is not shared
+	 */
+	result = libfwsi_internal_item_cache_get_item(
+	          (libfwsi_internal_item_cache_t *) item_cache,
+	          &( fwsi_test_item_cache_data1[ 47 ] ),
+	          100,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &internal_item1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "internal_item1",
+	 internal_item1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_item3 != NULL )
+	{
+		libfwsi_internal_item_release(
+		 &internal_item3,
+		 NULL );
+	}
+	if( internal_item2 != NULL )
+	{
+		libfwsi_internal_item_release(
+		 &internal_item2,
+		 NULL );
+	}
+	if( internal_item1 != NULL )
+	{
+		libfwsi_internal_item_release(
+		 &internal_item1,
+		 NULL );
+	}
+	if( item_cache != NULL )
+	{
+		libfwsi_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_cache_initialize",
+	 fwsi_test_item_cache_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_cache_free",
+	 fwsi_test_item_cache_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_cache_get_number_of_items",
+	 fwsi_test_item_cache_get_number_of_items );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_cache_shared_items",
+	 fwsi_test_item_cache_shared_items );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_cache_maximum_number_of_items",
+	 fwsi_test_item_cache_maximum_number_of_items );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_internal_item_cache_get_item",
+	 fwsi_test_internal_item_cache_get_item );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
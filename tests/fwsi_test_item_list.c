@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -57,6 +58,17 @@ unsigned char fwsi_test_item_list_data1[ 345 ] = {
 	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
 	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
 
+/* A file entry that is too small, data that matches a compressed folder pattern
+ * but is not supported and a URI
+ */
+unsigned char fwsi_test_item_list_data2[ 87 ] = {
+	0x0a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x61, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 0x70,
+	0x3a, 0x2f, 0x2f, 0x78, 0x00, 0x00, 0x00 };
+
 /* Tests the libfwsi_item_list_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -483,105 +495,68 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwsi_item_list_get_data_size function
+/* Tests the libfwsi_item_list_parse_borrowed function
  * Returns 1 if successful or 0 if not
  */
-int fwsi_test_item_list_get_data_size(
-     libfwsi_item_list_t *item_list )
+int fwsi_test_item_list_parse_borrowed(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	size_t data_size         = 0;
-	int data_size_is_set     = 0;
-	int result               = 0;
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int number_of_items            = 0;
+	int result                     = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libfwsi_item_list_get_data_size(
-	          item_list,
-	          &data_size,
+	result = libfwsi_item_list_initialize(
+	          &item_list,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	data_size_is_set = result;
-
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libfwsi_item_list_get_data_size(
-	          NULL,
-	          &data_size,
+	result = libfwsi_item_list_parse_borrowed(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	if( data_size_is_set != 0 )
-	{
-		result = libfwsi_item_list_get_data_size(
-		          item_list,
-		          NULL,
-		          &error );
-
-		FWSI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FWSI_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfwsi_item_list_get_number_of_items function
- * Returns 1 if successful or 0 if not
- */
-int fwsi_test_item_list_get_number_of_items(
-     libfwsi_item_list_t *item_list )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_items      = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
 	result = libfwsi_item_list_get_number_of_items(
 	          item_list,
 	          &number_of_items,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -589,9 +564,11 @@ int fwsi_test_item_list_get_number_of_items(
 
 	/* Test error cases
 	 */
-	result = libfwsi_item_list_get_number_of_items(
+	result = libfwsi_item_list_parse_borrowed(
 	          NULL,
-	          &number_of_items,
+	          fwsi_test_item_list_data1,
+	          345,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -606,9 +583,30 @@ int fwsi_test_item_list_get_number_of_items(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwsi_item_list_get_number_of_items(
+	result = libfwsi_item_list_parse_borrowed(
 	          item_list,
 	          NULL,
+	          345,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_parse_borrowed(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -623,6 +621,25 @@ int fwsi_test_item_list_get_number_of_items(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -631,43 +648,30 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libfwsi_item_list_parse function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fwsi_test_item_list_parse(
+     void )
 {
 	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
 	libfwsi_item_list_t *item_list = NULL;
+	int item_type                  = 0;
+	int number_of_extension_blocks = 0;
+	int number_of_items            = 0;
 	int result                     = 0;
 
-	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
-	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
-
-	FWSI_TEST_RUN(
-	 "libfwsi_item_list_initialize",
-	 fwsi_test_item_list_initialize );
-
-	FWSI_TEST_RUN(
-	 "libfwsi_item_list_free",
-	 fwsi_test_item_list_free );
-
-	FWSI_TEST_RUN(
-	 "libfwsi_item_list_copy_from_byte_stream",
-	 fwsi_test_item_list_copy_from_byte_stream );
-
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-
-	/* Initialize item_list for tests
+	/* Initialize test
 	 */
 	result = libfwsi_item_list_initialize(
 	          &item_list,
@@ -686,11 +690,14 @@ int main(
 	 "error",
 	 error );
 
-	result = libfwsi_item_list_copy_from_byte_stream(
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_parse(
 	          item_list,
-	          fwsi_test_item_list_data1,
-	          345,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
 	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -702,14 +709,3619 @@ int main(
 	 "error",
 	 error );
 
-	FWSI_TEST_RUN_WITH_ARGS(
-	 "libfwsi_item_list_get_data_size",
-	 fwsi_test_item_list_get_data_size,
-	 item_list );
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
 
-	FWSI_TEST_RUN_WITH_ARGS(
-	 "libfwsi_item_list_get_number_of_items",
-	 fwsi_test_item_list_get_number_of_items,
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          4,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The extension blocks are read on first access
+	 */
+	result = libfwsi_item_get_number_of_extension_blocks(
+	          item,
+	          &number_of_extension_blocks,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_parse(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          345,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          NULL,
+	          345,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          345,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0x80,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that the item types of items with deferred decoding do not change
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_parse_deferred_item_types(
+     void )
+{
+	int expected_item_types[ 3 ] = {
+		LIBFWSI_ITEM_TYPE_UNKNOWN, LIBFWSI_ITEM_TYPE_UNKNOWN, LIBFWSI_ITEM_TYPE_URI };
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	uint8_t parse_flags            = 0;
+	int item_index                 = 0;
+	int item_type                  = 0;
+	int number_of_extension_blocks = 0;
+	int number_of_items            = 0;
+	int pass                       = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first pass defers decoding, the second pass decodes the items when parsing
+	 * and the item types should be the same in both passes
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( pass == 0 )
+		{
+			parse_flags = LIBFWSI_PARSE_FLAG_DEFER_DECODING;
+		}
+		else
+		{
+			parse_flags = 0;
+		}
+		result = libfwsi_item_list_reparse(
+		          item_list,
+		          fwsi_test_item_list_data2,
+		          87,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          parse_flags,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_number_of_items(
+		          item_list,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 3 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			result = libfwsi_item_list_get_item(
+			          item_list,
+			          item_index,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item",
+			 item );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_type(
+			          item,
+			          &item_type,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "item_type",
+			 item_type,
+			 expected_item_types[ item_index ] );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* Reading the item values should not change the item type
+			 */
+			result = libfwsi_item_get_number_of_extension_blocks(
+			          item,
+			          &number_of_extension_blocks,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_type(
+			          item,
+			          &item_type,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "item_type",
+			 item_type,
+			 expected_item_types[ item_index ] );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_free(
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_reset(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t data_size               = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_reset(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reset of an item list that was already reset
+	 */
+	result = libfwsi_item_list_reset(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_reset(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_reparse function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_reparse(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int item_type                  = 0;
+	int iterator                   = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 3;
+	     iterator++ )
+	{
+		result = libfwsi_item_list_reparse(
+		          item_list,
+		          &( fwsi_test_item_list_data1[ 2 ] ),
+		          343,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          0,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_number_of_items(
+		          item_list,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 5 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_item(
+		          item_list,
+		          1,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_type(
+		          item,
+		          &item_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "item_type",
+		 item_type,
+		 LIBFWSI_ITEM_TYPE_VOLUME );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test reparse with deferred decoding of a borrowed byte stream
+	 */
+	result = libfwsi_item_list_reparse(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_reparse(
+	          NULL,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_reparse(
+	          item_list,
+	          NULL,
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_reparse(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0xff,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_parse_with_parent function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_parse_with_parent(
+     void )
+{
+	uint8_t expected_utf8_path[ 38 ] = {
+		'M', 'y', ' ', 'C', 'o', 'm', 'p', 'u', 't', 'e', 'r', '\\', 'C', ':', '\\', 'U',
+		's', 'e', 'r', 's', '\\', 't', 'e', 's', 't', '\\', 'C', 'O', 'P', 'Y', 'I', 'N',
+		'G', '.', 't', 'x', 't', 0 };
+
+	uint8_t utf8_path[ 64 ];
+
+	libcerror_error_t *error                  = NULL;
+	libfwsi_item_t *child_item                = NULL;
+	libfwsi_item_t *item                      = NULL;
+	libfwsi_item_t *parent_item               = NULL;
+	libfwsi_item_list_t *child_item_list      = NULL;
+	libfwsi_item_list_t *grandchild_item_list = NULL;
+	libfwsi_item_list_t *parent_item_list     = NULL;
+	const uint8_t *cached_utf8_path           = NULL;
+	size_t cached_utf8_path_length            = 0;
+	int common_prefix_length                  = 0;
+	int item_type                             = 0;
+	int number_of_items                       = 0;
+	int relation                              = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &parent_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_item_list",
+	 parent_item_list );
+
+	result = libfwsi_item_list_initialize(
+	          &child_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "child_item_list",
+	 child_item_list );
+
+	result = libfwsi_item_list_initialize(
+	          &grandchild_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "grandchild_item_list",
+	 grandchild_item_list );
+
+	/* The parent item list contains the root folder, volume and "Users" file entry items
+	 */
+	result = libfwsi_item_list_parse(
+	          parent_item_list,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          165,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_parse_with_parent(
+	          child_item_list,
+	          parent_item_list,
+	          &( fwsi_test_item_list_data1[ 167 ] ),
+	          78,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_parse_with_parent(
+	          grandchild_item_list,
+	          child_item_list,
+	          &( fwsi_test_item_list_data1[ 245 ] ),
+	          100,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The items of the shared parent item lists are not compared
+	 */
+	result = libfwsi_item_list_diff(
+	          parent_item_list,
+	          grandchild_item_list,
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_ANCESTOR );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          grandchild_item_list,
+	          child_item_list,
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_DESCENDANT );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 4 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          grandchild_item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	/* The items of the parent item list are shared
+	 */
+	result = libfwsi_item_list_get_item(
+	          parent_item_list,
+	          2,
+	          &parent_item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          grandchild_item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item == parent_item",
+	 (int) ( item == parent_item ),
+	 1 );
+
+	/* The first item of the child item list is classified relative to the last item of the parent item list
+	 */
+	result = libfwsi_item_list_get_item(
+	          grandchild_item_list,
+	          3,
+	          &child_item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          child_item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	result = libfwsi_item_list_get_item(
+	          grandchild_item_list,
+	          4,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	/* The path is derived from the cached path of the parent item lists
+	 */
+	result = libfwsi_item_list_get_cached_utf8_path(
+	          grandchild_item_list,
+	          &cached_utf8_path,
+	          &cached_utf8_path_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_utf8_path_length",
+	 cached_utf8_path_length,
+	 (size_t) 37 );
+
+	result = memory_compare(
+	          cached_utf8_path,
+	          expected_utf8_path,
+	          38 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          grandchild_item_list,
+	          0,
+	          0,
+	          utf8_path,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          expected_utf8_path,
+	          38 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a path separator that cannot be derived from the cached path of the parent item lists
+	 */
+	result = libfwsi_item_list_get_utf8_path(
+	          grandchild_item_list,
+	          (uint8_t) '/',
+	          0,
+	          utf8_path,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_path[ 11 ]",
+	 (int) utf8_path[ 11 ],
+	 (int) '/' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_path[ 25 ]",
+	 (int) utf8_path[ 25 ],
+	 (int) '/' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_path[ 37 ]",
+	 (int) utf8_path[ 37 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_parse_with_parent(
+	          NULL,
+	          parent_item_list,
+	          &( fwsi_test_item_list_data1[ 167 ] ),
+	          78,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_parse_with_parent(
+	          child_item_list,
+	          NULL,
+	          &( fwsi_test_item_list_data1[ 167 ] ),
+	          78,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an item list that already contains items
+	 */
+	result = libfwsi_item_list_parse_with_parent(
+	          child_item_list,
+	          parent_item_list,
+	          &( fwsi_test_item_list_data1[ 167 ] ),
+	          78,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an item list that is an ancestor of the parent item list
+	 */
+	result = libfwsi_item_list_reset(
+	          parent_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_parse_with_parent(
+	          parent_item_list,
+	          grandchild_item_list,
+	          &( fwsi_test_item_list_data1[ 167 ] ),
+	          78,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &grandchild_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "grandchild_item_list",
+	 grandchild_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &child_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "child_item_list",
+	 child_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &parent_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parent_item_list",
+	 parent_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( grandchild_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &grandchild_item_list,
+		 NULL );
+	}
+	if( child_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &child_item_list,
+		 NULL );
+	}
+	if( parent_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &parent_item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_data_size(
+     libfwsi_item_list_t *item_list )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int data_size_is_set     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( data_size_is_set != 0 )
+	{
+		result = libfwsi_item_list_get_data_size(
+		          item_list,
+		          NULL,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_number_of_items(
+     libfwsi_item_list_t *item_list )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_number_of_items(
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_hash(
+     libfwsi_item_list_t *item_list )
+{
+	uint8_t item_list_data[ 343 ];
+
+	libcerror_error_t *error              = NULL;
+	libfwsi_item_list_t *second_item_list = NULL;
+	uint64_t hash                         = 0;
+	uint64_t second_hash                  = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_hash(
+	          item_list,
+	          0,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Modify the access time of the file entry extension block of the "Users" item
+	 */
+	memory_copy(
+	 item_list_data,
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	item_list_data[ 77 ] = 0x00;
+	item_list_data[ 78 ] = 0x00;
+	item_list_data[ 79 ] = 0x00;
+	item_list_data[ 80 ] = 0x00;
+
+	result = libfwsi_item_list_initialize(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          second_item_list,
+	          item_list_data,
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_hash(
+	          second_item_list,
+	          0,
+	          &second_hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( hash != second_hash );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_item_list_get_hash(
+	          item_list,
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_hash(
+	          second_item_list,
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &second_hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "second_hash",
+	 second_hash,
+	 hash );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_hash(
+	          NULL,
+	          0,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_hash(
+	          item_list,
+	          0xff,
+	          &hash,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_hash(
+	          item_list,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &second_item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_common_prefix_length function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_common_prefix_length(
+     void )
+{
+	uint8_t item_list_data[ 1196 ];
+
+	libfwsi_item_list_t *item_lists[ 4 ] = { NULL, NULL, NULL, NULL };
+	size_t item_list_offsets[ 4 ]        = { 0, 343, 510, 853 };
+	size_t item_list_sizes[ 4 ]          = { 343, 167, 343, 343 };
+	libcerror_error_t *error             = NULL;
+	int common_prefix_length             = 0;
+	int item_list_index                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 * The second item list contains the first 3 items, the third item list
+	 * a modified name of the 4th item and the fourth item list a modified
+	 * access time of the 3rd item
+	 */
+	memory_copy(
+	 &( item_list_data[ 0 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	memory_copy(
+	 &( item_list_data[ 343 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 165 );
+
+	item_list_data[ 508 ] = 0x00;
+	item_list_data[ 509 ] = 0x00;
+
+	memory_copy(
+	 &( item_list_data[ 510 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	item_list_data[ 510 + 179 ] = 'T';
+
+	memory_copy(
+	 &( item_list_data[ 853 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	item_list_data[ 853 + 77 ] = 0x00;
+
+	for( item_list_index = 0;
+	     item_list_index < 4;
+	     item_list_index++ )
+	{
+		result = libfwsi_item_list_initialize(
+		          &( item_lists[ item_list_index ] ),
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_lists[ item_list_index ],
+		          &( item_list_data[ item_list_offsets[ item_list_index ] ] ),
+		          item_list_sizes[ item_list_index ],
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 0 ],
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 1 ],
+	          item_lists[ 0 ],
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 2 ],
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 3 ],
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 3 ],
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_common_prefix_length(
+	          NULL,
+	          item_lists[ 1 ],
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          NULL,
+	          0,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0xff,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_common_prefix_length(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( item_list_index = 0;
+	     item_list_index < 4;
+	     item_list_index++ )
+	{
+		result = libfwsi_item_list_free(
+		          &( item_lists[ item_list_index ] ),
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( item_list_index = 0;
+	     item_list_index < 4;
+	     item_list_index++ )
+	{
+		if( item_lists[ item_list_index ] != NULL )
+		{
+			libfwsi_item_list_free(
+			 &( item_lists[ item_list_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_diff function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_diff(
+     void )
+{
+	uint8_t item_list_data[ 1196 ];
+
+	libfwsi_item_list_t *item_lists[ 4 ] = { NULL, NULL, NULL, NULL };
+	size_t item_list_offsets[ 4 ]        = { 0, 343, 510, 853 };
+	size_t item_list_sizes[ 4 ]          = { 343, 167, 343, 343 };
+	libcerror_error_t *error             = NULL;
+	int common_prefix_length             = 0;
+	int item_list_index                  = 0;
+	int relation                         = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 * The second item list contains the first 3 items, the third item list
+	 * a modified name of the 4th item and the fourth item list a modified
+	 * access time of the 3rd item
+	 */
+	memory_copy(
+	 &( item_list_data[ 0 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	memory_copy(
+	 &( item_list_data[ 343 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 165 );
+
+	item_list_data[ 508 ] = 0x00;
+	item_list_data[ 509 ] = 0x00;
+
+	memory_copy(
+	 &( item_list_data[ 510 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	item_list_data[ 510 + 179 ] = 'T';
+
+	memory_copy(
+	 &( item_list_data[ 853 ] ),
+	 &( fwsi_test_item_list_data1[ 2 ] ),
+	 343 );
+
+	item_list_data[ 853 + 77 ] = 0x00;
+
+	for( item_list_index = 0;
+	     item_list_index < 4;
+	     item_list_index++ )
+	{
+		result = libfwsi_item_list_initialize(
+		          &( item_lists[ item_list_index ] ),
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_lists[ item_list_index ],
+		          &( item_list_data[ item_list_offsets[ item_list_index ] ] ),
+		          item_list_sizes[ item_list_index ],
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 0 ],
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_EQUAL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 1 ],
+	          item_lists[ 0 ],
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_ANCESTOR );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_DESCENDANT );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 2 ],
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_DIVERGENT );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 3 ],
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_DIVERGENT );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 3 ],
+	          LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "relation",
+	 relation,
+	 LIBFWSI_ITEM_LIST_RELATION_EQUAL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "common_prefix_length",
+	 common_prefix_length,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_diff(
+	          NULL,
+	          item_lists[ 1 ],
+	          0,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0xff,
+	          &relation,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0,
+	          NULL,
+	          &common_prefix_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_diff(
+	          item_lists[ 0 ],
+	          item_lists[ 1 ],
+	          0,
+	          &relation,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( item_list_index = 0;
+	     item_list_index < 4;
+	     item_list_index++ )
+	{
+		result = libfwsi_item_list_free(
+		          &( item_lists[ item_list_index ] ),
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( item_list_index = 0;
+	     item_list_index < 4;
+	     item_list_index++ )
+	{
+		if( item_lists[ item_list_index ] != NULL )
+		{
+			libfwsi_item_list_free(
+			 &( item_lists[ item_list_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_timestamps function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_timestamps(
+     libfwsi_item_list_t *item_list )
+{
+	libfwsi_timestamp_t timestamps[ 16 ];
+
+	uint32_t expected_fat_date_times[ 9 ] = {
+		0xb12446aeUL, 0x14f24699UL, 0xb12446aeUL,
+		0xb18c46aeUL, 0xb12446aeUL, 0xb18c46aeUL,
+		0xb24e46aeUL, 0xb24e46aeUL, 0xb24e46aeUL };
+
+	uint64_t expected_filetimes[ 9 ] = {
+		0x01d08e92992d5a00ULL, 0x01d07f01118ea400ULL, 0x01d08e92992d5a00ULL,
+		0x01d08e930e009400ULL, 0x01d08e92992d5a00ULL, 0x01d08e930e009400ULL,
+		0x01d08e93e6f69200ULL, 0x01d08e93e6f69200ULL, 0x01d08e93e6f69200ULL };
+
+	uint8_t expected_types[ 3 ] = {
+		LIBFWSI_TIMESTAMP_TYPE_MODIFICATION_TIME,
+		LIBFWSI_TIMESTAMP_TYPE_CREATION_TIME,
+		LIBFWSI_TIMESTAMP_TYPE_ACCESS_TIME };
+
+	libcerror_error_t *error = NULL;
+	int number_of_timestamps = 0;
+	int result               = 0;
+	int timestamp_index      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_timestamps(
+	          item_list,
+	          timestamps,
+	          16,
+	          &number_of_timestamps,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_timestamps",
+	 number_of_timestamps,
+	 9 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The root folder and volume items have no timestamps, every file entry item
+	 * has a modification time and a file entry extension with a creation and access time
+	 */
+	for( timestamp_index = 0;
+	     timestamp_index < 9;
+	     timestamp_index++ )
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "timestamps[ timestamp_index ].item_index",
+		 timestamps[ timestamp_index ].item_index,
+		 2 + ( timestamp_index / 3 ) );
+
+		FWSI_TEST_ASSERT_EQUAL_UINT8(
+		 "timestamps[ timestamp_index ].type",
+		 timestamps[ timestamp_index ].type,
+		 expected_types[ timestamp_index % 3 ] );
+
+		FWSI_TEST_ASSERT_EQUAL_UINT32(
+		 "timestamps[ timestamp_index ].fat_date_time",
+		 timestamps[ timestamp_index ].fat_date_time,
+		 expected_fat_date_times[ timestamp_index ] );
+
+		FWSI_TEST_ASSERT_EQUAL_UINT64(
+		 "timestamps[ timestamp_index ].filetime",
+		 timestamps[ timestamp_index ].filetime,
+		 expected_filetimes[ timestamp_index ] );
+	}
+	/* Test that at most the maximum number of timestamps are stored
+	 */
+	timestamps[ 4 ].item_index = -1;
+
+	result = libfwsi_item_list_get_timestamps(
+	          item_list,
+	          timestamps,
+	          4,
+	          &number_of_timestamps,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_timestamps",
+	 number_of_timestamps,
+	 9 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "timestamps[ 4 ].item_index",
+	 timestamps[ 4 ].item_index,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving only the number of timestamps
+	 */
+	result = libfwsi_item_list_get_timestamps(
+	          item_list,
+	          NULL,
+	          0,
+	          &number_of_timestamps,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_timestamps",
+	 number_of_timestamps,
+	 9 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_timestamps(
+	          NULL,
+	          timestamps,
+	          16,
+	          &number_of_timestamps,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_timestamps(
+	          item_list,
+	          timestamps,
+	          -1,
+	          &number_of_timestamps,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_timestamps(
+	          item_list,
+	          NULL,
+	          16,
+	          &number_of_timestamps,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_timestamps(
+	          item_list,
+	          timestamps,
+	          16,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_utf8_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_utf8_path_size(
+     libfwsi_item_list_t *item_list )
+{
+	libcerror_error_t *error  = NULL;
+	size_t utf8_string_size  = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_utf8_path_size(
+	          item_list,
+	          0,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 38 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_utf8_path_size(
+	          item_list,
+	          0,
+	          LIBFWSI_PATH_FLAG_GUID_STRINGS,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 67 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_utf8_path_size(
+	          NULL,
+	          0,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path_size(
+	          item_list,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_utf8_path(
+     libfwsi_item_list_t *item_list )
+{
+	uint8_t expected_utf8_string1[ 38 ] = {
+		'M', 'y', ' ', 'C', 'o', 'm', 'p', 'u', 't', 'e', 'r', '\\', 'C', ':', '\\', 'U',
+		's', 'e', 'r', 's', '\\', 't', 'e', 's', 't', '\\', 'C', 'O', 'P', 'Y', 'I', 'N',
+		'G', '.', 't', 'x', 't', 0 };
+
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0,
+	          0,
+	          utf8_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string1,
+	          sizeof( uint8_t ) * 38 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a different path separator, the trailing separator of the volume name is retained
+	 */
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          (uint8_t) '/',
+	          LIBFWSI_PATH_FLAG_SHORT_NAMES,
+	          utf8_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 11 ]",
+	 (int) utf8_string[ 11 ],
+	 (int) '/' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 14 ]",
+	 (int) utf8_string[ 14 ],
+	 (int) '\\' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 20 ]",
+	 (int) utf8_string[ 20 ],
+	 (int) '/' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 37 ]",
+	 (int) utf8_string[ 37 ],
+	 0 );
+
+	/* Test with the root folder formatted as a GUID string
+	 */
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0,
+	          LIBFWSI_PATH_FLAG_GUID_STRINGS,
+	          utf8_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 0 ]",
+	 (int) utf8_string[ 0 ],
+	 (int) ':' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 3 ]",
+	 (int) utf8_string[ 3 ],
+	 (int) '2' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 39 ]",
+	 (int) utf8_string[ 39 ],
+	 (int) '}' );
+
+	result = memory_compare(
+	          &( utf8_string[ 40 ] ),
+	          &( expected_utf8_string1[ 11 ] ),
+	          sizeof( uint8_t ) * 27 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_utf8_path(
+	          NULL,
+	          0,
+	          0,
+	          utf8_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0,
+	          0,
+	          NULL,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0,
+	          0,
+	          utf8_string,
+	          37,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0,
+	          0,
+	          utf8_string,
+	          13,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          0xe9,
+	          0,
+	          utf8_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_utf16_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_utf16_path_size(
+     libfwsi_item_list_t *item_list )
+{
+	libcerror_error_t *error  = NULL;
+	size_t utf16_string_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_utf16_path_size(
+	          item_list,
+	          0,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 38 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_utf16_path_size(
+	          item_list,
+	          0,
+	          LIBFWSI_PATH_FLAG_GUID_STRINGS,
+	          &utf16_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 67 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_utf16_path_size(
+	          NULL,
+	          0,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path_size(
+	          item_list,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_utf16_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_utf16_path(
+     libfwsi_item_list_t *item_list )
+{
+	uint16_t expected_utf16_string1[ 38 ] = {
+		'M', 'y', ' ', 'C', 'o', 'm', 'p', 'u', 't', 'e', 'r', '\\', 'C', ':', '\\', 'U',
+		's', 'e', 'r', 's', '\\', 't', 'e', 's', 't', '\\', 'C', 'O', 'P', 'Y', 'I', 'N',
+		'G', '.', 't', 'x', 't', 0 };
+
+	uint16_t utf16_string[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          0,
+	          0,
+	          utf16_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string1,
+	          sizeof( uint16_t ) * 38 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a different path separator, the trailing separator of the volume name is retained
+	 */
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          (uint16_t) '/',
+	          LIBFWSI_PATH_FLAG_SHORT_NAMES,
+	          utf16_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 11 ]",
+	 (int) utf16_string[ 11 ],
+	 (int) '/' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 14 ]",
+	 (int) utf16_string[ 14 ],
+	 (int) '\\' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 20 ]",
+	 (int) utf16_string[ 20 ],
+	 (int) '/' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 37 ]",
+	 (int) utf16_string[ 37 ],
+	 0 );
+
+	/* Test with the root folder formatted as a GUID string
+	 */
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          0,
+	          LIBFWSI_PATH_FLAG_GUID_STRINGS,
+	          utf16_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 0 ]",
+	 (int) utf16_string[ 0 ],
+	 (int) ':' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 3 ]",
+	 (int) utf16_string[ 3 ],
+	 (int) '2' );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 39 ]",
+	 (int) utf16_string[ 39 ],
+	 (int) '}' );
+
+	result = memory_compare(
+	          &( utf16_string[ 40 ] ),
+	          &( expected_utf16_string1[ 11 ] ),
+	          sizeof( uint16_t ) * 27 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_utf16_path(
+	          NULL,
+	          0,
+	          0,
+	          utf16_string,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          0,
+	          0,
+	          NULL,
+	          128,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          0,
+	          0,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          0,
+	          0,
+	          utf16_string,
+	          37,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          0,
+	          0,
+	          utf16_string,
+	          13,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int result                     = 0;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_initialize",
+	 fwsi_test_item_list_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_free",
+	 fwsi_test_item_list_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream",
+	 fwsi_test_item_list_copy_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_parse_borrowed",
+	 fwsi_test_item_list_parse_borrowed );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_parse",
+	 fwsi_test_item_list_parse );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_parse_deferred_item_types",
+	 fwsi_test_item_list_parse_deferred_item_types );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_reset",
+	 fwsi_test_item_list_reset );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_reparse",
+	 fwsi_test_item_list_reparse );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_parse_with_parent",
+	 fwsi_test_item_list_parse_with_parent );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_common_prefix_length",
+	 fwsi_test_item_list_get_common_prefix_length );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_diff",
+	 fwsi_test_item_list_diff );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize item_list for tests
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          345,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_data_size",
+	 fwsi_test_item_list_get_data_size,
+	 item_list );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_number_of_items",
+	 fwsi_test_item_list_get_number_of_items,
+	 item_list );
+
+	/* The shell item list starts at offset 2 of the test data
+	 */
+	result = libfwsi_item_list_reparse(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_hash",
+	 fwsi_test_item_list_get_hash,
+	 item_list );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_timestamps",
+	 fwsi_test_item_list_get_timestamps,
+	 item_list );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_utf8_path_size",
+	 fwsi_test_item_list_get_utf8_path_size,
+	 item_list );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_utf8_path",
+	 fwsi_test_item_list_get_utf8_path,
+	 item_list );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_utf16_path_size",
+	 fwsi_test_item_list_get_utf16_path_size,
+	 item_list );
+
+	FWSI_TEST_RUN_WITH_ARGS(
+	 "libfwsi_item_list_get_utf16_path",
+	 fwsi_test_item_list_get_utf16_path,
 	 item_list );
 
 	/* TODO: add tests for libfwsi_item_list_get_item */
@@ -0,0 +1,851 @@
+/*
+ * Library item_list_iterator type test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+unsigned char fwsi_test_item_list_iterator_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_item_list_iterator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_iterator_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_item_list_iterator_t *iterator = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 2;
+	int number_of_memset_fail_tests        = 2;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "iterator",
+	 iterator );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_iterator_free(
+	          &iterator,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "iterator",
+	 iterator );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_iterator_initialize(
+	          NULL,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	iterator = (libfwsi_item_list_iterator_t *) 0x12345678UL;
+
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	iterator = NULL;
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          NULL,
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          343,
+	          -1,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0x80,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_item_list_iterator_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_item_list_iterator_initialize(
+		          &iterator,
+		          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+		          343,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          0,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( iterator != NULL )
+			{
+				libfwsi_item_list_iterator_free(
+				 &iterator,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "iterator",
+			 iterator );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_item_list_iterator_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_item_list_iterator_initialize(
+		          &iterator,
+		          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+		          343,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          0,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( iterator != NULL )
+			{
+				libfwsi_item_list_iterator_free(
+				 &iterator,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "iterator",
+			 iterator );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( iterator != NULL )
+	{
+		libfwsi_item_list_iterator_free(
+		 &iterator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_iterator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_iterator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_iterator_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_iterator_next function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_iterator_next(
+     void )
+{
+	int expected_item_types[ 5 ] = {
+		LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+		LIBFWSI_ITEM_TYPE_VOLUME,
+		LIBFWSI_ITEM_TYPE_FILE_ENTRY,
+		LIBFWSI_ITEM_TYPE_FILE_ENTRY,
+		LIBFWSI_ITEM_TYPE_FILE_ENTRY };
+
+	libcerror_error_t *error               = NULL;
+	libfwsi_item_list_iterator_t *iterator = NULL;
+	libfwsi_item_t *item                   = NULL;
+	size_t offset                          = 0;
+	uint8_t parse_flags                    = 0;
+	int item_index                         = 0;
+	int item_type                          = 0;
+	int number_of_extension_blocks         = 0;
+	int result                             = 0;
+
+	for( parse_flags = 0;
+	     parse_flags <= LIBFWSI_PARSE_FLAG_DEFER_DECODING;
+	     parse_flags += LIBFWSI_PARSE_FLAG_DEFER_DECODING )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_list_iterator_initialize(
+		          &iterator,
+		          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+		          343,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          parse_flags,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "iterator",
+		 iterator );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		for( item_index = 0;
+		     item_index < 5;
+		     item_index++ )
+		{
+			result = libfwsi_item_list_iterator_next(
+			          iterator,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item",
+			 item );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_type(
+			          item,
+			          &item_type,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "item_type",
+			 item_type,
+			 expected_item_types[ item_index ] );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_number_of_extension_blocks(
+			          item,
+			          &number_of_extension_blocks,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_extension_blocks",
+			 number_of_extension_blocks,
+			 ( item_index >= 2 ) ? 1 : 0 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfwsi_item_list_iterator_next(
+		          iterator,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_iterator_get_offset(
+		          iterator,
+		          &offset,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "offset",
+		 offset,
+		 (size_t) 343 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libfwsi_item_list_iterator_free(
+		          &iterator,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "iterator",
+		 iterator );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_iterator_next(
+	          NULL,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfwsi_item_list_iterator_next with a shell item size that exceeds the byte stream
+	 */
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          100,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_iterator_next(
+	          iterator,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( item_index = 0;
+	     item_index < 2;
+	     item_index++ )
+	{
+		result = libfwsi_item_list_iterator_next(
+		          iterator,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwsi_item_list_iterator_next(
+	          iterator,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_iterator_free(
+	          &iterator,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( iterator != NULL )
+	{
+		libfwsi_item_list_iterator_free(
+		 &iterator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_iterator_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_iterator_get_offset(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_item_list_iterator_t *iterator = NULL;
+	libfwsi_item_t *item                   = NULL;
+	size_t offset                          = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_iterator_initialize(
+	          &iterator,
+	          &( fwsi_test_item_list_iterator_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_iterator_next(
+	          iterator,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_iterator_get_offset(
+	          iterator,
+	          &offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 20 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_iterator_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_iterator_get_offset(
+	          iterator,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_iterator_free(
+	          &iterator,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( iterator != NULL )
+	{
+		libfwsi_item_list_iterator_free(
+		 &iterator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_iterator_initialize",
+	 fwsi_test_item_list_iterator_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_iterator_free",
+	 fwsi_test_item_list_iterator_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_iterator_next",
+	 fwsi_test_item_list_iterator_next );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_iterator_get_offset",
+	 fwsi_test_item_list_iterator_get_offset );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
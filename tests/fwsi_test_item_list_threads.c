@@ -0,0 +1,853 @@
+/*
+ * Library item_list concurrent access test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libcthreads.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+unsigned char fwsi_test_item_list_threads_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* A file entry that is too small, data that matches a compressed folder pattern
+ * but is not supported and a URI
+ */
+unsigned char fwsi_test_item_list_threads_data2[ 87 ] = {
+	0x0a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x61, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 0x70,
+	0x3a, 0x2f, 0x2f, 0x78, 0x00, 0x00, 0x00 };
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS		5
+#define FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS2		3
+#define FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ROUNDS		32
+#define FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS		8
+#define FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITERATIONS	256
+
+typedef struct fwsi_test_item_list_threads_expected fwsi_test_item_list_threads_expected_t;
+
+struct fwsi_test_item_list_threads_expected
+{
+	int item_type;
+	int number_of_extension_blocks;
+	uint64_t hash;
+	size_t utf8_name_size;
+	uint8_t utf8_name[ 64 ];
+};
+
+typedef struct fwsi_test_item_list_threads_context fwsi_test_item_list_threads_context_t;
+
+struct fwsi_test_item_list_threads_context
+{
+	libfwsi_item_list_t *item_list;
+	fwsi_test_item_list_threads_expected_t *expected;
+	int number_of_items;
+	int read_values;
+	int number_of_failures;
+};
+
+/* Reads the expected values of an item
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_item_list_threads_read_expected(
+     libfwsi_item_t *item,
+     fwsi_test_item_list_threads_expected_t *expected,
+     libcerror_error_t **error )
+{
+	if( libfwsi_item_get_type(
+	     item,
+	     &( expected->item_type ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfwsi_item_get_number_of_extension_blocks(
+	     item,
+	     &( expected->number_of_extension_blocks ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The hash is calculated on first retrieval
+	 */
+	if( libfwsi_item_get_hash(
+	     item,
+	     LIBFWSI_COMPARE_FLAG_IGNORE_VOLATILE_VALUES,
+	     &( expected->hash ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	expected->utf8_name_size = 0;
+
+	if( expected->item_type == LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+	{
+		if( libfwsi_file_entry_get_utf8_name_size(
+		     item,
+		     &( expected->utf8_name_size ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( expected->utf8_name_size > 64 )
+		{
+			return( -1 );
+		}
+		if( libfwsi_file_entry_get_utf8_name(
+		     item,
+		     expected->utf8_name,
+		     expected->utf8_name_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the items of an item list and compares them with the expected values
+ * This function is the callback of the test threads
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_item_list_threads_read_items(
+     fwsi_test_item_list_threads_context_t *context )
+{
+	fwsi_test_item_list_threads_expected_t value;
+
+	fwsi_test_item_list_threads_expected_t *expected = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfwsi_item_t *item                             = NULL;
+	const uint8_t *cached_utf8_name                  = NULL;
+	size_t cached_utf8_name_length                   = 0;
+	int expected_index                               = 0;
+	int item_index                                   = 0;
+	int iterator                                     = 0;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	for( iterator = 0;
+	     iterator < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITERATIONS;
+	     iterator++ )
+	{
+		for( item_index = 0;
+		     item_index < context->number_of_items;
+		     item_index++ )
+		{
+			/* Alternate the order in which the items are accessed
+			 */
+			if( ( iterator % 2 ) == 0 )
+			{
+				expected_index = item_index;
+			}
+			else
+			{
+				expected_index = context->number_of_items - 1 - item_index;
+			}
+			expected = &( context->expected[ expected_index ] );
+
+			if( libfwsi_item_list_get_item(
+			     context->item_list,
+			     expected_index,
+			     &item,
+			     &error ) != 1 )
+			{
+				context->number_of_failures += 1;
+
+				libcerror_error_free(
+				 &error );
+
+				continue;
+			}
+			/* Retrieve the item type while other threads read the item values
+			 */
+			if( context->read_values == 0 )
+			{
+				if( libfwsi_item_get_type(
+				     item,
+				     &( value.item_type ),
+				     &error ) != 1 )
+				{
+					context->number_of_failures += 1;
+
+					libcerror_error_free(
+					 &error );
+				}
+				else if( value.item_type != expected->item_type )
+				{
+					context->number_of_failures += 1;
+				}
+				continue;
+			}
+			if( fwsi_test_item_list_threads_read_expected(
+			     item,
+			     &value,
+			     &error ) != 1 )
+			{
+				context->number_of_failures += 1;
+
+				libcerror_error_free(
+				 &error );
+
+				continue;
+			}
+			if( ( value.item_type != expected->item_type )
+			 || ( value.number_of_extension_blocks != expected->number_of_extension_blocks )
+			 || ( value.hash != expected->hash )
+			 || ( value.utf8_name_size != expected->utf8_name_size ) )
+			{
+				context->number_of_failures += 1;
+			}
+			else if( ( value.utf8_name_size > 0 )
+			      && ( memory_compare(
+			            value.utf8_name,
+			            expected->utf8_name,
+			            value.utf8_name_size ) != 0 ) )
+			{
+				context->number_of_failures += 1;
+			}
+			/* The first thread to retrieve the cached name converts and caches it
+			 */
+			if( value.item_type == LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+			{
+				if( libfwsi_file_entry_get_cached_utf8_name(
+				     item,
+				     &cached_utf8_name,
+				     &cached_utf8_name_length,
+				     &error ) != 1 )
+				{
+					context->number_of_failures += 1;
+
+					libcerror_error_free(
+					 &error );
+
+					continue;
+				}
+				if( ( ( cached_utf8_name_length + 1 ) != expected->utf8_name_size )
+				 || ( memory_compare(
+				       cached_utf8_name,
+				       expected->utf8_name,
+				       expected->utf8_name_size ) != 0 ) )
+				{
+					context->number_of_failures += 1;
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Tests concurrent read access to the items of an item list
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_threads_concurrent_read(
+     void )
+{
+	fwsi_test_item_list_threads_context_t contexts[ FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS ];
+	fwsi_test_item_list_threads_expected_t expected[ FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS ];
+	libcthreads_thread_t *threads[ FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int item_index                 = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+	int round_index                = 0;
+	int thread_index               = 0;
+
+	for( thread_index = 0;
+	     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Determine the expected values from an item list that is decoded while parsing
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          &( fwsi_test_item_list_threads_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS;
+	     item_index++ )
+	{
+		result = libfwsi_item_list_get_item(
+		          item_list,
+		          item_index,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fwsi_test_item_list_threads_read_expected(
+		          item,
+		          &( expected[ item_index ] ),
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "expected[ 4 ].item_type",
+	 expected[ 4 ].item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	/* Test concurrent access to item lists with deferred decoding,
+	 * where the first access of an item decodes its values
+	 */
+	for( round_index = 0;
+	     round_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ROUNDS;
+	     round_index++ )
+	{
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_parse(
+		          item_list,
+		          &( fwsi_test_item_list_threads_data1[ 2 ] ),
+		          343,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( thread_index = 0;
+		     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			contexts[ thread_index ].item_list          = item_list;
+			contexts[ thread_index ].expected           = expected;
+			contexts[ thread_index ].number_of_items    = FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS;
+			contexts[ thread_index ].read_values        = 1;
+			contexts[ thread_index ].number_of_failures = 0;
+
+			result = libcthreads_thread_create(
+			          &( threads[ thread_index ] ),
+			          NULL,
+			          (int (*)(void *)) &fwsi_test_item_list_threads_read_items,
+			          (void *) &( contexts[ thread_index ] ),
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( thread_index = 0;
+		     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			result = libcthreads_thread_join(
+			          &( threads[ thread_index ] ),
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_failures",
+			 contexts[ thread_index ].number_of_failures,
+			 0 );
+		}
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests retrieving the item types concurrently with reading the item values
+ * of an item list with deferred decoding
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_threads_concurrent_get_type(
+     void )
+{
+	fwsi_test_item_list_threads_context_t contexts[ FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS ];
+	fwsi_test_item_list_threads_expected_t expected[ FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS2 ];
+	libcthreads_thread_t *threads[ FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int item_index                 = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+	int round_index                = 0;
+	int thread_index               = 0;
+
+	for( thread_index = 0;
+	     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Determine the expected values from an item list that is decoded while parsing
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          fwsi_test_item_list_threads_data2,
+	          87,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS2;
+	     item_index++ )
+	{
+		result = libfwsi_item_list_get_item(
+		          item_list,
+		          item_index,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fwsi_test_item_list_threads_read_expected(
+		          item,
+		          &( expected[ item_index ] ),
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "expected[ 1 ].item_type",
+	 expected[ 1 ].item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "expected[ 2 ].item_type",
+	 expected[ 2 ].item_type,
+	 LIBFWSI_ITEM_TYPE_URI );
+
+	/* Test concurrent access to item lists with deferred decoding,
+	 * where half of the threads only retrieve the item types
+	 */
+	for( round_index = 0;
+	     round_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ROUNDS;
+	     round_index++ )
+	{
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_parse(
+		          item_list,
+		          fwsi_test_item_list_threads_data2,
+		          87,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          LIBFWSI_PARSE_FLAG_BORROW_BYTE_STREAM | LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( thread_index = 0;
+		     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			contexts[ thread_index ].item_list          = item_list;
+			contexts[ thread_index ].expected           = expected;
+			contexts[ thread_index ].number_of_items    = FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_ITEMS2;
+			contexts[ thread_index ].read_values        = thread_index % 2;
+			contexts[ thread_index ].number_of_failures = 0;
+
+			result = libcthreads_thread_create(
+			          &( threads[ thread_index ] ),
+			          NULL,
+			          (int (*)(void *)) &fwsi_test_item_list_threads_read_items,
+			          (void *) &( contexts[ thread_index ] ),
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( thread_index = 0;
+		     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			result = libcthreads_thread_join(
+			          &( threads[ thread_index ] ),
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_failures",
+			 contexts[ thread_index ].number_of_failures,
+			 0 );
+		}
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < FWSI_TEST_ITEM_LIST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_concurrent_read",
+	 fwsi_test_item_list_threads_concurrent_read );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_concurrent_get_type",
+	 fwsi_test_item_list_threads_concurrent_get_type );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -0,0 +1,439 @@
+/*
+ * Library callback parser functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+unsigned char fwsi_test_parser_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+typedef struct fwsi_test_parser_context fwsi_test_parser_context_t;
+
+struct fwsi_test_parser_context
+{
+	int number_of_items;
+	int number_of_items_ended;
+	int number_of_file_entries;
+	int number_of_volumes;
+	int number_of_extension_blocks;
+	int last_item_type;
+	size_t last_name_size;
+	int stop_at_item_index;
+};
+
+/* Item begin test callback
+ * Returns 1 to continue or 0 to stop
+ */
+int fwsi_test_parser_on_item_begin(
+     void *user_data,
+     int item_index,
+     int item_type,
+     uint8_t class_type FWSI_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	fwsi_test_parser_context_t *context = (fwsi_test_parser_context_t *) user_data;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( class_type )
+	FWSI_TEST_UNREFERENCED_PARAMETER( data )
+	FWSI_TEST_UNREFERENCED_PARAMETER( data_size )
+
+	if( item_index == context->stop_at_item_index )
+	{
+		return( 0 );
+	}
+	context->number_of_items += 1;
+	context->last_item_type   = item_type;
+
+	return( 1 );
+}
+
+/* File entry test callback
+ * Returns 1 to continue
+ */
+int fwsi_test_parser_on_file_entry(
+     void *user_data,
+     uint32_t file_size FWSI_TEST_ATTRIBUTE_UNUSED,
+     uint32_t modification_time FWSI_TEST_ATTRIBUTE_UNUSED,
+     uint16_t file_attribute_flags FWSI_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *name FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t name_size,
+     uint8_t is_unicode FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	fwsi_test_parser_context_t *context = (fwsi_test_parser_context_t *) user_data;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( file_size )
+	FWSI_TEST_UNREFERENCED_PARAMETER( modification_time )
+	FWSI_TEST_UNREFERENCED_PARAMETER( file_attribute_flags )
+	FWSI_TEST_UNREFERENCED_PARAMETER( name )
+	FWSI_TEST_UNREFERENCED_PARAMETER( is_unicode )
+
+	context->number_of_file_entries += 1;
+	context->last_name_size          = name_size;
+
+	return( 1 );
+}
+
+/* Volume test callback
+ * Returns 1 to continue
+ */
+int fwsi_test_parser_on_volume(
+     void *user_data,
+     const uint8_t *name FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t name_size FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	fwsi_test_parser_context_t *context = (fwsi_test_parser_context_t *) user_data;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( name )
+	FWSI_TEST_UNREFERENCED_PARAMETER( name_size )
+
+	context->number_of_volumes += 1;
+
+	return( 1 );
+}
+
+/* Extension block test callback
+ * Returns 1 to continue or -1 on error
+ */
+int fwsi_test_parser_on_extension_block(
+     void *user_data,
+     uint32_t signature,
+     uint16_t version FWSI_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	fwsi_test_parser_context_t *context = (fwsi_test_parser_context_t *) user_data;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( version )
+	FWSI_TEST_UNREFERENCED_PARAMETER( data )
+	FWSI_TEST_UNREFERENCED_PARAMETER( data_size )
+
+	if( signature != 0xbeef0004UL )
+	{
+		return( -1 );
+	}
+	context->number_of_extension_blocks += 1;
+
+	return( 1 );
+}
+
+/* Item end test callback
+ * Returns 1 to continue
+ */
+int fwsi_test_parser_on_item_end(
+     void *user_data,
+     int item_index FWSI_TEST_ATTRIBUTE_UNUSED,
+     int item_type FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	fwsi_test_parser_context_t *context = (fwsi_test_parser_context_t *) user_data;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( item_index )
+	FWSI_TEST_UNREFERENCED_PARAMETER( item_type )
+
+	context->number_of_items_ended += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfwsi_parse_with_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_parse_with_callbacks(
+     void )
+{
+	fwsi_test_parser_context_t context;
+	libfwsi_parse_callbacks_t callbacks;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	callbacks.on_item_begin      = &fwsi_test_parser_on_item_begin;
+	callbacks.on_file_entry      = &fwsi_test_parser_on_file_entry;
+	callbacks.on_volume          = &fwsi_test_parser_on_volume;
+	callbacks.on_extension_block = &fwsi_test_parser_on_extension_block;
+	callbacks.on_item_end        = &fwsi_test_parser_on_item_end;
+
+	context.number_of_items            = 0;
+	context.number_of_items_ended      = 0;
+	context.number_of_file_entries     = 0;
+	context.number_of_volumes          = 0;
+	context.number_of_extension_blocks = 0;
+	context.last_item_type             = 0;
+	context.last_name_size             = 0;
+	context.stop_at_item_index         = -1;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_parse_with_callbacks(
+	          &( fwsi_test_parser_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_items",
+	 context.number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_items_ended",
+	 context.number_of_items_ended,
+	 5 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_file_entries",
+	 context.number_of_file_entries,
+	 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_volumes",
+	 context.number_of_volumes,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_extension_blocks",
+	 context.number_of_extension_blocks,
+	 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.last_item_type",
+	 context.last_item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "context.last_name_size",
+	 context.last_name_size,
+	 (size_t) 12 );
+
+	/* Test stopping from a callback
+	 */
+	context.number_of_items    = 0;
+	context.stop_at_item_index = 2;
+
+	result = libfwsi_parse_with_callbacks(
+	          &( fwsi_test_parser_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_items",
+	 context.number_of_items,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_parse_with_callbacks(
+	          NULL,
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_parse_with_callbacks(
+	          &( fwsi_test_parser_data1[ 2 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_parse_with_callbacks(
+	          &( fwsi_test_parser_data1[ 2 ] ),
+	          343,
+	          -1,
+	          &callbacks,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_parse_with_callbacks(
+	          &( fwsi_test_parser_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a shell item size that exceeds the byte stream
+	 */
+	context.stop_at_item_index = -1;
+
+	result = libfwsi_parse_with_callbacks(
+	          &( fwsi_test_parser_data1[ 2 ] ),
+	          100,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_parse_with_callbacks",
+	 fwsi_test_parse_with_callbacks );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,457 @@
+/*
+ * Library structural scan functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+unsigned char fwsi_test_scanner_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_item_list_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_scan(
+     void )
+{
+	libfwsi_item_scan_entry_t entries[ 8 ];
+	uint8_t invalid_data[ 345 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int entry_index          = 0;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          entries,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 343 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "entries[ 0 ].offset",
+	 entries[ 0 ].offset,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 0 ].size",
+	 (int) entries[ 0 ].size,
+	 20 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 0 ].class_type",
+	 (int) entries[ 0 ].class_type,
+	 0x1f );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 0 ].item_type",
+	 entries[ 0 ].item_type,
+	 LIBFWSI_ITEM_TYPE_ROOT_FOLDER );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 0 ].number_of_extension_blocks",
+	 entries[ 0 ].number_of_extension_blocks,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "entries[ 1 ].offset",
+	 entries[ 1 ].offset,
+	 (size_t) 20 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 1 ].item_type",
+	 entries[ 1 ].item_type,
+	 LIBFWSI_ITEM_TYPE_VOLUME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 1 ].number_of_extension_blocks",
+	 entries[ 1 ].number_of_extension_blocks,
+	 0 );
+
+	for( entry_index = 2;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "entries[ entry_index ].item_type",
+		 entries[ entry_index ].item_type,
+		 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "entries[ entry_index ].number_of_extension_blocks",
+		 entries[ entry_index ].number_of_extension_blocks,
+		 1 );
+	}
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "entries[ 4 ].offset",
+	 entries[ 4 ].offset,
+	 (size_t) 243 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "entries[ 4 ].size",
+	 (int) entries[ 4 ].size,
+	 98 );
+
+	/* Test scan with less entries than shell items
+	 */
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          entries,
+	          2,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan without entries
+	 */
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          NULL,
+	          0,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 5 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 343 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan of a shell item list without terminator
+	 */
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          341,
+	          entries,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan of a shell item list with an invalid shell item size
+	 */
+	for( entry_index = 0;
+	     entry_index < 345;
+	     entry_index++ )
+	{
+		invalid_data[ entry_index ] = fwsi_test_scanner_data1[ entry_index ];
+	}
+	invalid_data[ 22 ] = 0xff;
+	invalid_data[ 23 ] = 0xff;
+
+	result = libfwsi_item_list_scan(
+	          &( invalid_data[ 2 ] ),
+	          343,
+	          entries,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	invalid_data[ 22 ] = 0x03;
+	invalid_data[ 23 ] = 0x00;
+
+	result = libfwsi_item_list_scan(
+	          &( invalid_data[ 2 ] ),
+	          343,
+	          entries,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_scan(
+	          NULL,
+	          343,
+	          entries,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          entries,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          entries,
+	          -1,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          NULL,
+	          8,
+	          &number_of_items,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          entries,
+	          8,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_scan(
+	          &( fwsi_test_scanner_data1[ 2 ] ),
+	          343,
+	          entries,
+	          8,
+	          &number_of_items,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_scan",
+	 fwsi_test_item_list_scan );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
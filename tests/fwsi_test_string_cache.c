@@ -0,0 +1,935 @@
+/*
+ * Library decoded string cache functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_string_cache.h"
+
+unsigned char fwsi_test_string_cache_data1[ 345 ] = {
+	0x57, 0x01, 0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8,
+	0x08, 0x00, 0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x24, 0xb1, 0x11, 0x00, 0x55, 0x73, 0x65,
+	0x72, 0x73, 0x00, 0x64, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x99, 0x46, 0xf2, 0x14, 0xae,
+	0x46, 0x24, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x29,
+	0x01, 0x55, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x73,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x64,
+	0x00, 0x6c, 0x00, 0x6c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x31,
+	0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae,
+	0x46, 0x8c, 0xb1, 0x10, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x3a, 0x00, 0x09, 0x00, 0x04,
+	0x00, 0xef, 0xbe, 0xae, 0x46, 0x24, 0xb1, 0xae, 0x46, 0x8c, 0xb1, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x9d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x8d, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x62, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x46, 0x4e,
+	0xb2, 0x20, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x49, 0x4e, 0x47, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x48,
+	0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xae, 0x46, 0x4e, 0xb2, 0xae, 0x46, 0x4e, 0xb2, 0x2e,
+	0x00, 0x00, 0x00, 0xa4, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x62, 0xd7, 0x00, 0x43, 0x00, 0x4f,
+	0x00, 0x50, 0x00, 0x59, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x78,
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* The number of times the test string getter functions were called
+ */
+int fwsi_test_string_cache_number_of_calls = 0;
+
+/* Retrieves the size of the test UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_string_cache_owner_get_utf8_string_size(
+     intptr_t *owner FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t *utf8_string_size,
+     libcerror_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( owner )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	fwsi_test_string_cache_number_of_calls++;
+
+	*utf8_string_size = 6;
+
+	return( 1 );
+}
+
+/* Retrieves the test UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_string_cache_owner_get_utf8_string(
+     intptr_t *owner FWSI_TEST_ATTRIBUTE_UNUSED,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( owner )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( utf8_string_size < 6 )
+	{
+		return( -1 );
+	}
+	memory_copy(
+	 utf8_string,
+	 "cache",
+	 6 );
+
+	return( 1 );
+}
+
+/* Retrieves the size of an unavailable UTF-8 string
+ * Returns 0 if not available
+ */
+int fwsi_test_string_cache_owner_get_unavailable_utf8_string_size(
+     intptr_t *owner FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t *utf8_string_size FWSI_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( owner )
+	FWSI_TEST_UNREFERENCED_PARAMETER( utf8_string_size )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+}
+
+/* Retrieves the size of the test UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_string_cache_owner_get_utf16_string_size(
+     intptr_t *owner FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t *utf16_string_size,
+     libcerror_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( owner )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	fwsi_test_string_cache_number_of_calls++;
+
+	*utf16_string_size = 3;
+
+	return( 1 );
+}
+
+/* Retrieves the test UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_string_cache_owner_get_utf16_string(
+     intptr_t *owner FWSI_TEST_ATTRIBUTE_UNUSED,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( owner )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( utf16_string_size < 3 )
+	{
+		return( -1 );
+	}
+	utf16_string[ 0 ] = (uint16_t) 'o';
+	utf16_string[ 1 ] = (uint16_t) 'k';
+	utf16_string[ 2 ] = 0;
+
+	return( 1 );
+}
+
+/* Tests the libfwsi_string_cache_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_cache_get_utf8_string(
+     void )
+{
+	libfwsi_string_cache_t string_cache;
+
+	const uint8_t *cached_string = NULL;
+	const uint8_t *utf8_string   = NULL;
+	libcerror_error_t *error     = NULL;
+	size_t utf8_string_length    = 0;
+	int result                   = 0;
+
+	memory_set(
+	 &string_cache,
+	 0,
+	 sizeof( libfwsi_string_cache_t ) );
+
+	fwsi_test_string_cache_number_of_calls = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          0,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 5 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "cache",
+	          6 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	cached_string = utf8_string;
+
+	/* Test that the string is converted only once
+	 */
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          0,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "fwsi_test_string_cache_number_of_calls",
+	 fwsi_test_string_cache_number_of_calls,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( utf8_string == cached_string );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          1,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_unavailable_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_cache_get_utf8_string(
+	          NULL,
+	          0,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          0,
+	          NULL,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          0,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_cache_get_utf8_string(
+	          &string_cache,
+	          0,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf8_string_size,
+	          &fwsi_test_string_cache_owner_get_utf8_string,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_string_cache_clear(
+	          &string_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfwsi_string_cache_clear(
+	 &string_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_cache_get_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_cache_get_utf16_string(
+     void )
+{
+	libfwsi_string_cache_t string_cache;
+
+	const uint16_t *cached_string = NULL;
+	const uint16_t *utf16_string  = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t utf16_string_length    = 0;
+	int result                    = 0;
+
+	memory_set(
+	 &string_cache,
+	 0,
+	 sizeof( libfwsi_string_cache_t ) );
+
+	fwsi_test_string_cache_number_of_calls = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_cache_get_utf16_string(
+	          &string_cache,
+	          2,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf16_string_size,
+	          &fwsi_test_string_cache_owner_get_utf16_string,
+	          &utf16_string,
+	          &utf16_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf16_string",
+	 utf16_string );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_length",
+	 utf16_string_length,
+	 (size_t) 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 2 ]",
+	 utf16_string[ 2 ],
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_string = utf16_string;
+
+	result = libfwsi_string_cache_get_utf16_string(
+	          &string_cache,
+	          2,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf16_string_size,
+	          &fwsi_test_string_cache_owner_get_utf16_string,
+	          &utf16_string,
+	          &utf16_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "fwsi_test_string_cache_number_of_calls",
+	 fwsi_test_string_cache_number_of_calls,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( utf16_string == cached_string );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_cache_get_utf16_string(
+	          &string_cache,
+	          -1,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf16_string_size,
+	          &fwsi_test_string_cache_owner_get_utf16_string,
+	          &utf16_string,
+	          &utf16_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_cache_get_utf16_string(
+	          &string_cache,
+	          2,
+	          NULL,
+	          &fwsi_test_string_cache_owner_get_utf16_string_size,
+	          NULL,
+	          &utf16_string,
+	          &utf16_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_string_cache_clear(
+	          &string_cache,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfwsi_string_cache_clear(
+	 &string_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* Tests the libfwsi_file_entry_get_cached_utf8_name, libfwsi_file_entry_get_cached_utf16_name
+ * and libfwsi_file_entry_extension_get_cached_utf8_long_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_cache_file_entry(
+     void )
+{
+	uint8_t utf8_name[ 64 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	libfwsi_item_list_t *item_list             = NULL;
+	const uint8_t *cached_utf8_name            = NULL;
+	const uint8_t *utf8_string                 = NULL;
+	const uint16_t *utf16_string               = NULL;
+	size_t utf16_string_length                 = 0;
+	size_t utf8_name_size                      = 0;
+	size_t utf8_string_length                  = 0;
+	int result                                 = 0;
+
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_parse(
+	          item_list,
+	          &( fwsi_test_string_cache_data1[ 2 ] ),
+	          343,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          LIBFWSI_PARSE_FLAG_DEFER_DECODING,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_file_entry_get_utf8_name_size(
+	          item,
+	          &utf8_name_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_file_entry_get_utf8_name(
+	          item,
+	          utf8_name,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_get_cached_utf8_name(
+	          item,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 utf8_name_size - 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          utf8_name,
+	          utf8_name_size );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	cached_utf8_name = utf8_string;
+
+	result = libfwsi_file_entry_get_cached_utf8_name(
+	          item,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( utf8_string == cached_utf8_name );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_file_entry_get_cached_utf16_name(
+	          item,
+	          &utf16_string,
+	          &utf16_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf16_string",
+	 utf16_string );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_length",
+	 utf16_string_length,
+	 utf8_name_size - 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+	          extension_block,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_get_cached_utf8_name(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_get_cached_utf8_name(
+	          item,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          0,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_file_entry_get_cached_utf8_name(
+	          item,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_cache_get_utf8_string",
+	 fwsi_test_string_cache_get_utf8_string );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_cache_get_utf16_string",
+	 fwsi_test_string_cache_get_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_get_cached_utf8_name",
+	 fwsi_test_string_cache_file_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,516 @@
+/*
+ * Library string scanning functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_string_scan.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* The maximum size of the test data
+ */
+#define FWSI_TEST_STRING_SCAN_MAXIMUM_DATA_SIZE	80
+
+/* Finds the first byte with a value of 0 without vector instructions
+ * Returns the offset of the byte or data_size if not found
+ */
+size_t fwsi_test_string_scan_reference_find_byte_terminator(
+        const uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] == 0 )
+		{
+			break;
+		}
+	}
+	return( data_offset );
+}
+
+/* Finds the first 16-bit aligned 16-bit value of 0 without vector instructions
+ * Returns the offset of the 16-bit value or data_size if not found
+ */
+size_t fwsi_test_string_scan_reference_find_utf16_terminator(
+        const uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     ( data_offset + 1 ) < data_size;
+	     data_offset += 2 )
+	{
+		if( ( data[ data_offset ] == 0 )
+		 && ( data[ data_offset + 1 ] == 0 ) )
+		{
+			return( data_offset );
+		}
+	}
+	return( data_size );
+}
+
+/* Fills the test data with non-zero values
+ * The fill pattern contains bytes of 0 that do not form a 16-bit aligned 16-bit value of 0
+ */
+void fwsi_test_string_scan_fill_data(
+      uint8_t *data,
+      size_t data_size,
+      int fill_pattern )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( fill_pattern == 0 )
+		{
+			data[ data_offset ] = (uint8_t) ( 0x80 | ( data_offset & 0x7f ) );
+		}
+		else if( ( data_offset % 4 ) == 1 )
+		{
+			data[ data_offset ] = 0x01;
+		}
+		else if( ( data_offset % 4 ) == 2 )
+		{
+			data[ data_offset ] = 0xff;
+		}
+		else
+		{
+			data[ data_offset ] = 0x00;
+		}
+	}
+}
+
+/* Tests the libfwsi_string_scan_get_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_scan_get_kernel(
+     void )
+{
+	int kernel          = 0;
+	int selected_kernel = 0;
+
+	kernel = libfwsi_string_scan_get_kernel();
+
+	FWSI_TEST_ASSERT_GREATER_THAN_INT(
+	 "kernel",
+	 kernel,
+	 LIBFWSI_STRING_SCAN_KERNEL_PORTABLE - 1 );
+
+	FWSI_TEST_ASSERT_LESS_THAN_INT(
+	 "kernel",
+	 kernel,
+	 LIBFWSI_STRING_SCAN_KERNEL_NEON + 1 );
+
+	/* The kernel is selected on first use
+	 */
+	selected_kernel = libfwsi_string_scan_get_kernel();
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "selected_kernel",
+	 selected_kernel,
+	 kernel );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_scan_find_byte_terminator function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_scan_find_byte_terminator(
+     void )
+{
+	uint8_t *data           = NULL;
+	size_t data_size        = 0;
+	size_t expected_offset  = 0;
+	size_t string_offset    = 0;
+	size_t terminator_index = 0;
+	int kernel              = 0;
+
+	for( kernel = LIBFWSI_STRING_SCAN_KERNEL_PORTABLE;
+	     kernel <= LIBFWSI_STRING_SCAN_KERNEL_NEON;
+	     kernel++ )
+	{
+		for( data_size = 1;
+		     data_size <= FWSI_TEST_STRING_SCAN_MAXIMUM_DATA_SIZE;
+		     data_size++ )
+		{
+			/* The data is allocated with its exact size to detect reads beyond its end
+			 */
+			data = (uint8_t *) memory_allocate(
+			                    data_size );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
+
+			/* A terminator index of data size indicates the data has no terminator
+			 */
+			for( terminator_index = 0;
+			     terminator_index <= data_size;
+			     terminator_index++ )
+			{
+				fwsi_test_string_scan_fill_data(
+				 data,
+				 data_size,
+				 0 );
+
+				if( terminator_index < data_size )
+				{
+					data[ terminator_index ] = 0;
+				}
+				expected_offset = fwsi_test_string_scan_reference_find_byte_terminator(
+				                   data,
+				                   data_size );
+
+				string_offset = libfwsi_string_scan_find_byte_terminator(
+				                 data,
+				                 data_size,
+				                 kernel );
+
+				FWSI_TEST_ASSERT_EQUAL_SIZE(
+				 "string_offset",
+				 string_offset,
+				 expected_offset );
+			}
+			memory_free(
+			 data );
+
+			data = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_scan_find_utf16_terminator function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_scan_find_utf16_terminator(
+     void )
+{
+	uint8_t *data           = NULL;
+	size_t data_size        = 0;
+	size_t expected_offset  = 0;
+	size_t string_offset    = 0;
+	size_t terminator_index = 0;
+	int fill_pattern        = 0;
+	int kernel              = 0;
+
+	for( kernel = LIBFWSI_STRING_SCAN_KERNEL_PORTABLE;
+	     kernel <= LIBFWSI_STRING_SCAN_KERNEL_NEON;
+	     kernel++ )
+	{
+		for( data_size = 1;
+		     data_size <= FWSI_TEST_STRING_SCAN_MAXIMUM_DATA_SIZE;
+		     data_size++ )
+		{
+			data = (uint8_t *) memory_allocate(
+			                    data_size );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
+
+			for( fill_pattern = 0;
+			     fill_pattern <= 1;
+			     fill_pattern++ )
+			{
+				/* The terminator is also placed at odd offsets, which must not match
+				 */
+				for( terminator_index = 0;
+				     terminator_index <= data_size;
+				     terminator_index++ )
+				{
+					fwsi_test_string_scan_fill_data(
+					 data,
+					 data_size,
+					 fill_pattern );
+
+					if( ( terminator_index + 1 ) < data_size )
+					{
+						data[ terminator_index ]     = 0;
+						data[ terminator_index + 1 ] = 0;
+					}
+					expected_offset = fwsi_test_string_scan_reference_find_utf16_terminator(
+					                   data,
+					                   data_size );
+
+					string_offset = libfwsi_string_scan_find_utf16_terminator(
+					                 data,
+					                 data_size,
+					                 kernel );
+
+					FWSI_TEST_ASSERT_EQUAL_SIZE(
+					 "string_offset",
+					 string_offset,
+					 expected_offset );
+				}
+			}
+			memory_free(
+			 data );
+
+			data = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_scan_get_byte_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_scan_get_byte_string_size(
+     void )
+{
+	uint8_t data[ 40 ] = {
+		'n', 'e', 't', 'w', 'o', 'r', 'k', 0, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h',
+		'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x',
+		'y', 'z', 'A', 'B', 'C', 'D', 0, 'E' };
+
+	size_t string_size = 0;
+
+	/* Test regular cases
+	 */
+	string_size = libfwsi_string_scan_get_byte_string_size(
+	               data,
+	               40,
+	               0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 8 );
+
+	string_size = libfwsi_string_scan_get_byte_string_size(
+	               data,
+	               40,
+	               8 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 31 );
+
+	/* Test a string without end-of-string character
+	 */
+	string_size = libfwsi_string_scan_get_byte_string_size(
+	               data,
+	               38,
+	               8 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 30 );
+
+	/* Test a data offset at or beyond the end of the data
+	 */
+	string_size = libfwsi_string_scan_get_byte_string_size(
+	               data,
+	               40,
+	               40 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	string_size = libfwsi_string_scan_get_byte_string_size(
+	               data,
+	               40,
+	               41 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_scan_get_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_scan_get_utf16_string_size(
+     void )
+{
+	uint8_t data[ 41 ] = {
+		'a', 0, 'b', 0, 0, 0, 'c', 0, 0, 'd', 0, 'e', 0, 'f', 0, 'g',
+		0, 'h', 0, 'i', 0, 'j', 0, 'k', 0, 'l', 0, 'm', 0, 'n', 0, 'o',
+		0, 0, 0, 'p', 0, 'q', 0, 0, 0 };
+
+	size_t string_size = 0;
+
+	/* Test regular cases
+	 */
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               41,
+	               0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 6 );
+
+	/* Test that bytes of 0 at odd offsets relative to the data offset do not match
+	 */
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               41,
+	               6 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 28 );
+
+	/* Test a string without end-of-string character and an odd remaining size
+	 */
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               33,
+	               6 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 26 );
+
+	/* Test a data offset at or beyond the end of the data
+	 */
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               41,
+	               40 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	string_size = libfwsi_string_scan_get_utf16_string_size(
+	               data,
+	               41,
+	               42 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_scan_get_kernel",
+	 fwsi_test_string_scan_get_kernel );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_scan_find_byte_terminator",
+	 fwsi_test_string_scan_find_byte_terminator );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_scan_find_utf16_terminator",
+	 fwsi_test_string_scan_find_utf16_terminator );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_scan_get_byte_string_size",
+	 fwsi_test_string_scan_get_byte_string_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_scan_get_utf16_string_size",
+	 fwsi_test_string_scan_get_utf16_string_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+}
+
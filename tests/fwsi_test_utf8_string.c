@@ -0,0 +1,709 @@
+/*
+ * Library UTF-8 string functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_libuna.h"
+#include "../libfwsi/libfwsi_utf8_string.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* The maximum number of characters of the test strings
+ */
+#define FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS	40
+
+/* Creates an UTF-16 little-endian test stream
+ * The characters are ASCII except for the value at non_ascii_index, which is set
+ * to non_ascii_value, and the stream is terminated at terminator_index
+ */
+void fwsi_test_utf8_string_set_utf16_stream(
+      uint8_t *utf16_stream,
+      size_t number_of_values,
+      size_t non_ascii_index,
+      uint16_t non_ascii_value,
+      size_t terminator_index )
+{
+	size_t value_index = 0;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		utf16_stream[ value_index * 2 ]       = (uint8_t) ( 'A' + ( value_index % 26 ) );
+		utf16_stream[ ( value_index * 2 ) + 1 ] = 0;
+
+		if( value_index == non_ascii_index )
+		{
+			utf16_stream[ value_index * 2 ]       = (uint8_t) ( non_ascii_value & 0xff );
+			utf16_stream[ ( value_index * 2 ) + 1 ] = (uint8_t) ( non_ascii_value >> 8 );
+		}
+		else if( value_index == terminator_index )
+		{
+			utf16_stream[ value_index * 2 ] = 0;
+		}
+	}
+}
+
+/* Tests the libfwsi_utf8_string_copy_ascii_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_utf8_string_copy_ascii_from_utf16_stream(
+     void )
+{
+	uint8_t utf16_stream[ FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS * 2 ];
+	uint8_t utf8_string[ FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS ];
+
+	size_t number_of_characters = 0;
+	size_t number_of_values     = 0;
+	size_t non_ascii_index      = 0;
+	size_t value_index          = 0;
+	int result                  = 0;
+
+	for( number_of_values = 0;
+	     number_of_values <= FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS;
+	     number_of_values++ )
+	{
+		/* A non-ASCII index of number of values indicates the stream only contains ASCII characters
+		 */
+		for( non_ascii_index = 0;
+		     non_ascii_index <= number_of_values;
+		     non_ascii_index++ )
+		{
+			fwsi_test_utf8_string_set_utf16_stream(
+			 utf16_stream,
+			 number_of_values,
+			 non_ascii_index,
+			 0x0080,
+			 number_of_values );
+
+			number_of_characters = libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+			                        utf8_string,
+			                        utf16_stream,
+			                        number_of_values );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_characters",
+			 number_of_characters,
+			 non_ascii_index );
+
+			for( value_index = 0;
+			     value_index < number_of_characters;
+			     value_index++ )
+			{
+				result = ( utf8_string[ value_index ] == utf16_stream[ value_index * 2 ] );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+			number_of_characters = libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+			                        NULL,
+			                        utf16_stream,
+			                        number_of_values );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_characters",
+			 number_of_characters,
+			 non_ascii_index );
+
+			/* Test a value with only the upper byte set
+			 */
+			fwsi_test_utf8_string_set_utf16_stream(
+			 utf16_stream,
+			 number_of_values,
+			 non_ascii_index,
+			 0x0141,
+			 number_of_values );
+
+			number_of_characters = libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+			                        NULL,
+			                        utf16_stream,
+			                        number_of_values );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_characters",
+			 number_of_characters,
+			 non_ascii_index );
+
+			/* Test the end-of-string character
+			 */
+			fwsi_test_utf8_string_set_utf16_stream(
+			 utf16_stream,
+			 number_of_values,
+			 number_of_values,
+			 0x0080,
+			 non_ascii_index );
+
+			number_of_characters = libfwsi_utf8_string_copy_ascii_from_utf16_stream(
+			                        NULL,
+			                        utf16_stream,
+			                        number_of_values );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_characters",
+			 number_of_characters,
+			 non_ascii_index );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_utf8_string_copy_ascii_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_utf8_string_copy_ascii_from_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS ];
+	uint8_t utf8_string[ FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS ];
+
+	size_t byte_stream_index    = 0;
+	size_t byte_stream_size     = 0;
+	size_t non_ascii_index      = 0;
+	size_t number_of_characters = 0;
+	int result                  = 0;
+
+	for( byte_stream_size = 0;
+	     byte_stream_size <= FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS;
+	     byte_stream_size++ )
+	{
+		for( non_ascii_index = 0;
+		     non_ascii_index <= byte_stream_size;
+		     non_ascii_index++ )
+		{
+			for( byte_stream_index = 0;
+			     byte_stream_index < byte_stream_size;
+			     byte_stream_index++ )
+			{
+				byte_stream[ byte_stream_index ] = (uint8_t) ( 'a' + ( byte_stream_index % 26 ) );
+			}
+			if( non_ascii_index < byte_stream_size )
+			{
+				byte_stream[ non_ascii_index ] = ( ( non_ascii_index % 2 ) == 0 ) ? 0xe9 : 0x00;
+			}
+			number_of_characters = libfwsi_utf8_string_copy_ascii_from_byte_stream(
+			                        utf8_string,
+			                        byte_stream,
+			                        byte_stream_size );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_characters",
+			 number_of_characters,
+			 non_ascii_index );
+
+			result = memory_compare(
+			          utf8_string,
+			          byte_stream,
+			          number_of_characters );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Compares libfwsi_utf8_string_size_from_utf16_stream and libfwsi_utf8_string_copy_from_utf16_stream
+ * with their libuna counterparts
+ * Returns 1 if the results are the same or 0 if not
+ */
+int fwsi_test_utf8_string_compare_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order )
+{
+	uint8_t expected_utf8_string[ 256 ];
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t expected_utf8_string_size = 0;
+	size_t utf8_string_size         = 0;
+	int expected_result             = 0;
+	int result                      = 0;
+
+	expected_result = libuna_utf8_string_size_from_utf16_stream(
+	                   utf16_stream,
+	                   utf16_stream_size,
+	                   byte_order,
+	                   &expected_utf8_string_size,
+	                   &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_utf8_string_size_from_utf16_stream(
+	          utf16_stream,
+	          utf16_stream_size,
+	          byte_order,
+	          &utf8_string_size,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	if( expected_result != 1 )
+	{
+		return( 1 );
+	}
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 expected_utf8_string_size );
+
+	expected_result = libuna_utf8_string_copy_from_utf16_stream(
+	                   expected_utf8_string,
+	                   expected_utf8_string_size,
+	                   utf16_stream,
+	                   utf16_stream_size,
+	                   byte_order,
+	                   &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size,
+	          utf16_stream,
+	          utf16_stream_size,
+	          byte_order,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          utf8_string_size );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test an UTF-8 string that is too small
+	 */
+	result = libfwsi_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size - 1,
+	          utf16_stream,
+	          utf16_stream_size,
+	          byte_order,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_utf8_string_size_from_utf16_stream and
+ * libfwsi_utf8_string_copy_from_utf16_stream functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_utf8_string_from_utf16_stream(
+     void )
+{
+	uint16_t non_ascii_values[ 5 ] = {
+		0x00e9, 0x20ac, 0xfeff, 0xfffe, 0xd800 };
+
+	uint8_t utf16_stream[ FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS * 2 ];
+
+	size_t non_ascii_index   = 0;
+	size_t number_of_values  = 0;
+	int non_ascii_value_index = 0;
+	int result               = 0;
+
+	for( number_of_values = 1;
+	     number_of_values <= FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS;
+	     number_of_values++ )
+	{
+		for( non_ascii_value_index = 0;
+		     non_ascii_value_index < 5;
+		     non_ascii_value_index++ )
+		{
+			for( non_ascii_index = 0;
+			     non_ascii_index <= number_of_values;
+			     non_ascii_index++ )
+			{
+				/* Test an unterminated string
+				 */
+				fwsi_test_utf8_string_set_utf16_stream(
+				 utf16_stream,
+				 number_of_values,
+				 non_ascii_index,
+				 non_ascii_values[ non_ascii_value_index ],
+				 number_of_values );
+
+				result = fwsi_test_utf8_string_compare_utf16_stream(
+				          utf16_stream,
+				          number_of_values * 2,
+				          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				/* Test a string terminated before or after the non-ASCII character
+				 */
+				fwsi_test_utf8_string_set_utf16_stream(
+				 utf16_stream,
+				 number_of_values,
+				 non_ascii_index,
+				 non_ascii_values[ non_ascii_value_index ],
+				 number_of_values / 2 );
+
+				result = fwsi_test_utf8_string_compare_utf16_stream(
+				          utf16_stream,
+				          number_of_values * 2,
+				          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				result = fwsi_test_utf8_string_compare_utf16_stream(
+				          utf16_stream,
+				          number_of_values * 2,
+				          LIBUNA_ENDIAN_LITTLE );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+		}
+	}
+	/* Test streams that are not handled by the ASCII characters fast path
+	 */
+	fwsi_test_utf8_string_set_utf16_stream(
+	 utf16_stream,
+	 8,
+	 8,
+	 0x0080,
+	 8 );
+
+	result = fwsi_test_utf8_string_compare_utf16_stream(
+	          utf16_stream,
+	          16,
+	          LIBUNA_ENDIAN_BIG );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fwsi_test_utf8_string_compare_utf16_stream(
+	          utf16_stream,
+	          15,
+	          LIBUNA_ENDIAN_LITTLE );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_utf8_string_size_from_byte_stream and
+ * libfwsi_utf8_string_copy_from_byte_stream functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_utf8_string_from_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS ];
+	uint8_t expected_utf8_string[ 256 ];
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t byte_stream_index         = 0;
+	size_t byte_stream_size          = 0;
+	size_t expected_utf8_string_size = 0;
+	size_t non_ascii_index           = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	for( byte_stream_size = 1;
+	     byte_stream_size <= FWSI_TEST_UTF8_STRING_MAXIMUM_NUMBER_OF_CHARACTERS;
+	     byte_stream_size++ )
+	{
+		for( non_ascii_index = 0;
+		     non_ascii_index <= byte_stream_size;
+		     non_ascii_index++ )
+		{
+			for( byte_stream_index = 0;
+			     byte_stream_index < byte_stream_size;
+			     byte_stream_index++ )
+			{
+				byte_stream[ byte_stream_index ] = (uint8_t) ( 'a' + ( byte_stream_index % 26 ) );
+			}
+			if( non_ascii_index < byte_stream_size )
+			{
+				byte_stream[ non_ascii_index ] = 0xe9;
+			}
+			if( byte_stream_size > 8 )
+			{
+				byte_stream[ byte_stream_size - 4 ] = 0;
+			}
+			result = libuna_utf8_string_size_from_byte_stream(
+			          byte_stream,
+			          byte_stream_size,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &expected_utf8_string_size,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libfwsi_utf8_string_size_from_byte_stream(
+			          byte_stream,
+			          byte_stream_size,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &utf8_string_size,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_size",
+			 utf8_string_size,
+			 expected_utf8_string_size );
+
+			result = libuna_utf8_string_copy_from_byte_stream(
+			          expected_utf8_string,
+			          expected_utf8_string_size,
+			          byte_stream,
+			          byte_stream_size,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libfwsi_utf8_string_copy_from_byte_stream(
+			          utf8_string,
+			          utf8_string_size,
+			          byte_stream,
+			          byte_stream_size,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = memory_compare(
+			          utf8_string,
+			          expected_utf8_string,
+			          utf8_string_size );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			/* Test an UTF-8 string that is too small
+			 */
+			result = libfwsi_utf8_string_copy_from_byte_stream(
+			          utf8_string,
+			          utf8_string_size - 1,
+			          byte_stream,
+			          byte_stream_size,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_utf8_string_size_from_byte_stream(
+	          NULL,
+	          8,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_utf8_string_copy_from_byte_stream(
+	          NULL,
+	          8,
+	          byte_stream,
+	          8,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_utf8_string_copy_ascii_from_utf16_stream",
+	 fwsi_test_utf8_string_copy_ascii_from_utf16_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_utf8_string_copy_ascii_from_byte_stream",
+	 fwsi_test_utf8_string_copy_ascii_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_utf8_string_copy_from_utf16_stream",
+	 fwsi_test_utf8_string_from_utf16_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_utf8_string_copy_from_byte_stream",
+	 fwsi_test_utf8_string_from_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+}
+
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="cdburn_values compressed_folder_values control_panel_category_values control_panel_cpl_file_values control_panel_item_values delegate_folder_values error extension_block extension_block_0xbeef0000_values extension_block_0xbeef0001_values extension_block_0xbeef0003_values extension_block_0xbeef0005_values extension_block_0xbeef0006_values extension_block_0xbeef000a_values extension_block_0xbeef0013_values extension_block_0xbeef0014_values extension_block_0xbeef0019_values extension_block_0xbeef0025_values file_entry_extension_values file_entry_values game_folder_values item item_list mtp_file_entry_values mtp_volume_values network_location_values notify root_folder_values support uri_values uri_sub_values users_property_view_values volume_values";
+LIBRARY_TESTS="arena batch_parser carver carver_driver cdburn_values classifier compressed_folder_values control_panel_category_values control_panel_cpl_file_values control_panel_item_values delegate_folder_values error extension_block extension_block_0xbeef0000_values extension_block_0xbeef0001_values extension_block_0xbeef0003_values extension_block_0xbeef0005_values extension_block_0xbeef0006_values extension_block_0xbeef000a_values extension_block_0xbeef0013_values extension_block_0xbeef0014_values extension_block_0xbeef0019_values extension_block_0xbeef0025_values fat_date_time file_entry_extension_values file_entry_values game_folder_values guid_registry hash identifier_lookup item item_cache item_list item_list_iterator item_list_threads mtp_file_entry_values mtp_volume_values network_location_values notify parser root_folder_values scanner string_cache string_scan support uri_values uri_sub_values users_property_view_values utf8_string volume_values";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS=();
 